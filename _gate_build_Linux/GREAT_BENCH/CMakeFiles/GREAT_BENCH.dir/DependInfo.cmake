@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/app/GREAT_BENCH/GREAT_BENCH.cpp" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/GREAT_BENCH.cpp.o" "gcc" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/GREAT_BENCH.cpp.o.d"
+  "/root/repo/src/app/GREAT_BENCH/bench_epoch.cpp" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_epoch.cpp.o" "gcc" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_epoch.cpp.o.d"
+  "/root/repo/src/app/GREAT_BENCH/bench_lambda.cpp" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_lambda.cpp.o" "gcc" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_lambda.cpp.o.d"
+  "/root/repo/src/app/GREAT_BENCH/bench_obs.cpp" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_obs.cpp.o" "gcc" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_obs.cpp.o.d"
+  "/root/repo/src/app/GREAT_BENCH/bench_outlier.cpp" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_outlier.cpp.o" "gcc" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_outlier.cpp.o.d"
+  "/root/repo/src/app/GREAT_BENCH/bench_slotcov.cpp" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_slotcov.cpp.o" "gcc" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_slotcov.cpp.o.d"
+  "/root/repo/src/app/GREAT_BENCH/bench_update.cpp" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_update.cpp.o" "gcc" "/root/repo/_gate_build_Linux/GREAT_BENCH/CMakeFiles/GREAT_BENCH.dir/bench_update.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
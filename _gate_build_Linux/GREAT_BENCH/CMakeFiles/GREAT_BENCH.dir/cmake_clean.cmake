@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "/root/repo/_gate_build_Linux/Bin/GREAT_BENCH"
+  "/root/repo/_gate_build_Linux/Bin/GREAT_BENCH.pdb"
+  "CMakeFiles/GREAT_BENCH.dir/GREAT_BENCH.cpp.o"
+  "CMakeFiles/GREAT_BENCH.dir/GREAT_BENCH.cpp.o.d"
+  "CMakeFiles/GREAT_BENCH.dir/bench_epoch.cpp.o"
+  "CMakeFiles/GREAT_BENCH.dir/bench_epoch.cpp.o.d"
+  "CMakeFiles/GREAT_BENCH.dir/bench_lambda.cpp.o"
+  "CMakeFiles/GREAT_BENCH.dir/bench_lambda.cpp.o.d"
+  "CMakeFiles/GREAT_BENCH.dir/bench_obs.cpp.o"
+  "CMakeFiles/GREAT_BENCH.dir/bench_obs.cpp.o.d"
+  "CMakeFiles/GREAT_BENCH.dir/bench_outlier.cpp.o"
+  "CMakeFiles/GREAT_BENCH.dir/bench_outlier.cpp.o.d"
+  "CMakeFiles/GREAT_BENCH.dir/bench_slotcov.cpp.o"
+  "CMakeFiles/GREAT_BENCH.dir/bench_slotcov.cpp.o.d"
+  "CMakeFiles/GREAT_BENCH.dir/bench_update.cpp.o"
+  "CMakeFiles/GREAT_BENCH.dir/bench_update.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GREAT_BENCH.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
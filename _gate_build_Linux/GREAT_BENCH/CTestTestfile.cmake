@@ -0,0 +1,18 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/app/GREAT_BENCH
+# Build directory: /root/repo/_gate_build_Linux/GREAT_BENCH
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(bench_obs "/root/repo/_gate_build_Linux/Bin/GREAT_BENCH" "obs" "-check")
+set_tests_properties(bench_obs PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;58;add_test;/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;0;")
+add_test(bench_gappy "/root/repo/_gate_build_Linux/Bin/GREAT_BENCH" "gappy" "-check")
+set_tests_properties(bench_gappy PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;59;add_test;/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;0;")
+add_test(bench_outlier "/root/repo/_gate_build_Linux/Bin/GREAT_BENCH" "outlier" "-check")
+set_tests_properties(bench_outlier PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;60;add_test;/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;0;")
+add_test(bench_update "/root/repo/_gate_build_Linux/Bin/GREAT_BENCH" "update" "-check")
+set_tests_properties(bench_update PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;61;add_test;/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;0;")
+add_test(bench_lambda "/root/repo/_gate_build_Linux/Bin/GREAT_BENCH" "lambda" "-check")
+set_tests_properties(bench_lambda PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;62;add_test;/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;0;")
+add_test(bench_slotcov "/root/repo/_gate_build_Linux/Bin/GREAT_BENCH" "slotcov" "-check")
+set_tests_properties(bench_slotcov PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;63;add_test;/root/repo/src/app/GREAT_BENCH/CMakeLists.txt;0;")
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/app/GREAT_PVT/GREAT_PVT.cpp" "/root/repo/_gate_build_Linux/GREAT_PVT/CMakeFiles/GREAT_PVT.dir/GREAT_PVT.cpp.o" "gcc" "/root/repo/_gate_build_Linux/GREAT_PVT/CMakeFiles/GREAT_PVT.dir/GREAT_PVT.cpp.o.d"
+  "/root/repo/src/app/GREAT_PVT/gcfg_ppp.cpp" "/root/repo/_gate_build_Linux/GREAT_PVT/CMakeFiles/GREAT_PVT.dir/gcfg_ppp.cpp.o" "gcc" "/root/repo/_gate_build_Linux/GREAT_PVT/CMakeFiles/GREAT_PVT.dir/gcfg_ppp.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
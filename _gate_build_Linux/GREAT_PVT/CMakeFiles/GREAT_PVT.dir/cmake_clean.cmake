@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "/root/repo/_gate_build_Linux/Bin/GREAT_PVT"
+  "/root/repo/_gate_build_Linux/Bin/GREAT_PVT.pdb"
+  "CMakeFiles/GREAT_PVT.dir/GREAT_PVT.cpp.o"
+  "CMakeFiles/GREAT_PVT.dir/GREAT_PVT.cpp.o.d"
+  "CMakeFiles/GREAT_PVT.dir/gcfg_ppp.cpp.o"
+  "CMakeFiles/GREAT_PVT.dir/gcfg_ppp.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/GREAT_PVT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/LibGREAT/gambfix/gambcommon.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/gambcommon.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/gambcommon.cpp.o.d"
+  "/root/repo/src/LibGREAT/gambfix/gambiguity.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/gambiguity.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/gambiguity.cpp.o.d"
+  "/root/repo/src/LibGREAT/gambfix/gbdeci.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/gbdeci.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/gbdeci.cpp.o.d"
+  "/root/repo/src/LibGREAT/gambfix/glambda.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/glambda.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/glambda.cpp.o.d"
+  "/root/repo/src/LibGREAT/gambfix/gmwstats.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/gmwstats.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gambfix/gmwstats.cpp.o.d"
+  "/root/repo/src/LibGREAT/gcoders/dvpteph405.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gcoders/dvpteph405.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gcoders/dvpteph405.cpp.o.d"
+  "/root/repo/src/LibGREAT/gcoders/ifcb.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gcoders/ifcb.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gcoders/ifcb.cpp.o.d"
+  "/root/repo/src/LibGREAT/gcoders/poleut1.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gcoders/poleut1.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gcoders/poleut1.cpp.o.d"
+  "/root/repo/src/LibGREAT/gcoders/upd.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gcoders/upd.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gcoders/upd.cpp.o.d"
+  "/root/repo/src/LibGREAT/gdata/gifcb.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gifcb.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gifcb.cpp.o.d"
+  "/root/repo/src/LibGREAT/gdata/gnavde.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gnavde.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gnavde.cpp.o.d"
+  "/root/repo/src/LibGREAT/gdata/gpoleut1.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gpoleut1.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gpoleut1.cpp.o.d"
+  "/root/repo/src/LibGREAT/gdata/gposdata.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gposdata.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gposdata.cpp.o.d"
+  "/root/repo/src/LibGREAT/gdata/gupd.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gupd.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gdata/gupd.cpp.o.d"
+  "/root/repo/src/LibGREAT/gmodels/gattitudemodel.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gattitudemodel.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gattitudemodel.cpp.o.d"
+  "/root/repo/src/LibGREAT/gmodels/gbasemodel.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gbasemodel.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gbasemodel.cpp.o.d"
+  "/root/repo/src/LibGREAT/gmodels/gbiasmodel.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gbiasmodel.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gbiasmodel.cpp.o.d"
+  "/root/repo/src/LibGREAT/gmodels/gcombmodel.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gcombmodel.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gcombmodel.cpp.o.d"
+  "/root/repo/src/LibGREAT/gmodels/gprecisebias.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gprecisebias.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gprecisebias.cpp.o.d"
+  "/root/repo/src/LibGREAT/gmodels/gprecisebiasGPP.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gprecisebiasGPP.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gprecisebiasGPP.cpp.o.d"
+  "/root/repo/src/LibGREAT/gmodels/gsppbias.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gsppbias.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gsppbias.cpp.o.d"
+  "/root/repo/src/LibGREAT/gmodels/gtideIERS.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gtideIERS.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gmodels/gtideIERS.cpp.o.d"
+  "/root/repo/src/LibGREAT/gproc/gfltmatrix.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gproc/gfltmatrix.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gproc/gfltmatrix.cpp.o.d"
+  "/root/repo/src/LibGREAT/gproc/gpppflt.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gproc/gpppflt.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gproc/gpppflt.cpp.o.d"
+  "/root/repo/src/LibGREAT/gproc/gpvtflt.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gproc/gpvtflt.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gproc/gpvtflt.cpp.o.d"
+  "/root/repo/src/LibGREAT/gproc/gqualitycontrol.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gproc/gqualitycontrol.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gproc/gqualitycontrol.cpp.o.d"
+  "/root/repo/src/LibGREAT/gset/gsetamb.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gset/gsetamb.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gset/gsetamb.cpp.o.d"
+  "/root/repo/src/LibGREAT/gset/gsetsnap.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gset/gsetsnap.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gset/gsetsnap.cpp.o.d"
+  "/root/repo/src/LibGREAT/gutils/gstring.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gutils/gstring.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gutils/gstring.cpp.o.d"
+  "/root/repo/src/LibGREAT/gutils/gtrs2crs.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gutils/gtrs2crs.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gutils/gtrs2crs.cpp.o.d"
+  "/root/repo/src/LibGREAT/gutils/gtrs2crsgrid.cpp" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gutils/gtrs2crsgrid.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGREAT/CMakeFiles/LibGREAT.dir/gutils/gtrs2crsgrid.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/DependInfo.cmake"
+  "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,71 @@
+file(REMOVE_RECURSE
+  "/root/repo/_gate_build_Linux/Lib/libLibGREAT.pdb"
+  "/root/repo/_gate_build_Linux/Lib/libLibGREAT.so"
+  "CMakeFiles/LibGREAT.dir/gambfix/gambcommon.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gambfix/gambcommon.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gambfix/gambiguity.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gambfix/gambiguity.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gambfix/gbdeci.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gambfix/gbdeci.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gambfix/glambda.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gambfix/glambda.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gambfix/gmwstats.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gambfix/gmwstats.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gcoders/dvpteph405.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gcoders/dvpteph405.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gcoders/ifcb.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gcoders/ifcb.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gcoders/poleut1.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gcoders/poleut1.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gcoders/upd.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gcoders/upd.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gdata/gifcb.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gdata/gifcb.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gdata/gnavde.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gdata/gnavde.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gdata/gpoleut1.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gdata/gpoleut1.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gdata/gposdata.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gdata/gposdata.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gdata/gupd.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gdata/gupd.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gmodels/gattitudemodel.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gmodels/gattitudemodel.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gmodels/gbasemodel.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gmodels/gbasemodel.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gmodels/gbiasmodel.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gmodels/gbiasmodel.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gmodels/gcombmodel.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gmodels/gcombmodel.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gmodels/gprecisebias.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gmodels/gprecisebias.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gmodels/gprecisebiasGPP.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gmodels/gprecisebiasGPP.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gmodels/gsppbias.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gmodels/gsppbias.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gmodels/gtideIERS.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gmodels/gtideIERS.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gproc/gfltmatrix.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gproc/gfltmatrix.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gproc/gpppflt.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gproc/gpppflt.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gproc/gpvtflt.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gproc/gpvtflt.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gproc/gqualitycontrol.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gproc/gqualitycontrol.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gset/gsetamb.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gset/gsetamb.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gset/gsetsnap.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gset/gsetsnap.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gutils/gstring.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gutils/gstring.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gutils/gtrs2crs.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gutils/gtrs2crs.cpp.o.d"
+  "CMakeFiles/LibGREAT.dir/gutils/gtrs2crsgrid.cpp.o"
+  "CMakeFiles/LibGREAT.dir/gutils/gtrs2crsgrid.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LibGREAT.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
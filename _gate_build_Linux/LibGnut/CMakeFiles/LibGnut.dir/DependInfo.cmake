@@ -0,0 +1,151 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/LibGnut/gall/gallbias.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallbias.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallbias.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallnav.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallnav.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallnav.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallobj.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallobj.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallobj.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallobs.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallobs.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallobs.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallobscol.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallobscol.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallobscol.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallopl.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallopl.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallopl.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallotl.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallotl.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallotl.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallpar.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallpar.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallpar.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallpcv.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallpcv.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallpcv.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallprec.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallprec.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallprec.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallproc.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallproc.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallproc.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallprod.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallprod.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallprod.cpp.o.d"
+  "/root/repo/src/LibGnut/gall/gallrslt.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallrslt.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gall/gallrslt.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/atx.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/atx.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/atx.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/biabernese.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/biabernese.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/biabernese.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/biasinex.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/biasinex.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/biasinex.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/blq.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/blq.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/blq.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/gcoder.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/gcoder.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/gcoder.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/gcoder_buffer.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/gcoder_buffer.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/gcoder_buffer.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/rinexc.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexc.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexc.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/rinexn.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexn.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexn.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/rinexo.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexo.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexo.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/rinexo2.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexo2.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexo2.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/rinexo3.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexo3.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/rinexo3.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/sinex.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/sinex.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/sinex.cpp.o.d"
+  "/root/repo/src/LibGnut/gcoders/sp3.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/sp3.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gcoders/sp3.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gdata.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gdata.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gdata.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/geph.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/geph.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/geph.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gephprec.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gephprec.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gephprec.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gnav.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnav.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnav.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gnavbds.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavbds.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavbds.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gnavgal.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavgal.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavgal.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gnavglo.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavglo.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavglo.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gnavgps.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavgps.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavgps.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gnavirn.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavirn.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavirn.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gnavqzs.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavqzs.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavqzs.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gnavsbs.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavsbs.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gnavsbs.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gobj.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gobj.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gobj.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gobsgnss.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gobsgnss.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gobsgnss.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gprecindex.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gprecindex.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gprecindex.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/grec.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/grec.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/grec.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/grnxhdr.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/grnxhdr.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/grnxhdr.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/grxnhdr.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/grxnhdr.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/grxnhdr.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gsatdata.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gsatdata.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gsatdata.cpp.o.d"
+  "/root/repo/src/LibGnut/gdata/gtrn.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gtrn.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gdata/gtrn.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/gasyncout.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gasyncout.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gasyncout.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/gepochqueue.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gepochqueue.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gepochqueue.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/gfile.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gfile.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gfile.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/gio.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gio.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gio.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/giof.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/giof.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/giof.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/gkmlout.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gkmlout.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gkmlout.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/gmmapfile.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gmmapfile.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gmmapfile.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/gnote.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gnote.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gnote.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/gobsstream.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gobsstream.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gobsstream.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/great_log.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/great_log.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/great_log.cpp.o.d"
+  "/root/repo/src/LibGnut/gio/gxml.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gxml.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gio/gxml.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gbancroft.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gbancroft.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gbancroft.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gbias.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gbias.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gbias.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gbiastable.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gbiastable.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gbiastable.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gdop.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gdop.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gdop.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/geop.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/geop.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/geop.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/geop80.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/geop80.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/geop80.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gephplan.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gephplan.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gephplan.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/ggmf.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/ggmf.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/ggmf.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/ggpt.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/ggpt.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/ggpt.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/ginterp.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/ginterp.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/ginterp.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gmodel.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gmodel.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gmodel.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gotl.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gotl.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gotl.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gpar.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gpar.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gpar.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gpcv.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gpcv.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gpcv.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gpoly.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gpoly.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gpoly.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gpppmodel.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gpppmodel.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gpppmodel.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gsppmodel.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gsppmodel.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gsppmodel.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gstochasticmodel.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gstochasticmodel.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gstochasticmodel.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gtide.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gtide.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gtide.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gtide2010.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gtide2010.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gtide2010.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gtide96.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gtide96.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gtide96.cpp.o.d"
+  "/root/repo/src/LibGnut/gmodels/gtropo.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gtropo.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gmodels/gtropo.cpp.o.d"
+  "/root/repo/src/LibGnut/gproc/gflt.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gflt.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gflt.cpp.o.d"
+  "/root/repo/src/LibGnut/gproc/gppp.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gppp.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gppp.cpp.o.d"
+  "/root/repo/src/LibGnut/gproc/gpreproc.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gpreproc.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gpreproc.cpp.o.d"
+  "/root/repo/src/LibGnut/gproc/gspp.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gspp.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gspp.cpp.o.d"
+  "/root/repo/src/LibGnut/gproc/gsppflt.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gsppflt.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gproc/gsppflt.cpp.o.d"
+  "/root/repo/src/LibGnut/gprod/gprod.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gprod/gprod.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gprod/gprod.cpp.o.d"
+  "/root/repo/src/LibGnut/gprod/gprodclk.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gprod/gprodclk.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gprod/gprodclk.cpp.o.d"
+  "/root/repo/src/LibGnut/gprod/gprodcrd.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gprod/gprodcrd.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gprod/gprodcrd.cpp.o.d"
+  "/root/repo/src/LibGnut/gset/gsetbase.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetbase.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetbase.cpp.o.d"
+  "/root/repo/src/LibGnut/gset/gsetflt.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetflt.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetflt.cpp.o.d"
+  "/root/repo/src/LibGnut/gset/gsetgen.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetgen.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetgen.cpp.o.d"
+  "/root/repo/src/LibGnut/gset/gsetgnss.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetgnss.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetgnss.cpp.o.d"
+  "/root/repo/src/LibGnut/gset/gsetinp.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetinp.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetinp.cpp.o.d"
+  "/root/repo/src/LibGnut/gset/gsetout.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetout.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetout.cpp.o.d"
+  "/root/repo/src/LibGnut/gset/gsetproc.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetproc.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetproc.cpp.o.d"
+  "/root/repo/src/LibGnut/gset/gsetrec.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetrec.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gset/gsetrec.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gcommon.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gcommon.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gcommon.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gconst.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gconst.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gconst.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gfileconv.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gfileconv.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gfileconv.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gmatrixconv.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gmatrixconv.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gmatrixconv.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gmutex.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gmutex.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gmutex.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gnss.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gnss.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gnss.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gobs.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gobs.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gobs.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gpair.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gpair.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gpair.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gslotcov.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gslotcov.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gslotcov.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gsys.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gsys.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gsys.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gsysconv.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gsysconv.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gsysconv.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gtime.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gtime.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gtime.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gtimesync.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gtimesync.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gtimesync.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gtriple.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gtriple.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gtriple.cpp.o.d"
+  "/root/repo/src/LibGnut/gutils/gtypeconv.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gtypeconv.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/gutils/gtypeconv.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/bandmat.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/bandmat.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/bandmat.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/cholesky.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/cholesky.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/cholesky.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/evalue.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/evalue.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/evalue.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/fft.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/fft.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/fft.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/hholder.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/hholder.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/hholder.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/jacobi.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/jacobi.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/jacobi.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/myexcept.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/myexcept.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/myexcept.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newfft.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newfft.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newfft.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmat1.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat1.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat1.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmat2.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat2.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat2.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmat3.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat3.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat3.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmat4.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat4.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat4.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmat5.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat5.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat5.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmat6.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat6.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat6.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmat7.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat7.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat7.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmat8.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat8.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat8.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmat9.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat9.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmat9.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmatex.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmatex.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmatex.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/newmatrm.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmatrm.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/newmatrm.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/nm_misc.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/nm_misc.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/nm_misc.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/sort.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/sort.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/sort.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/submat.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/submat.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/submat.cpp.o.d"
+  "/root/repo/src/LibGnut/newmat/svd.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/svd.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/newmat/svd.cpp.o.d"
+  "/root/repo/src/LibGnut/pugixml/src/pugixml.cpp" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/pugixml/src/pugixml.cpp.o" "gcc" "/root/repo/_gate_build_Linux/LibGnut/CMakeFiles/LibGnut.dir/pugixml/src/pugixml.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,275 @@
+file(REMOVE_RECURSE
+  "/root/repo/_gate_build_Linux/Lib/libLibGnut.pdb"
+  "/root/repo/_gate_build_Linux/Lib/libLibGnut.so"
+  "CMakeFiles/LibGnut.dir/gall/gallbias.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallbias.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallnav.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallnav.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallobj.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallobj.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallobs.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallobs.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallobscol.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallobscol.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallopl.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallopl.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallotl.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallotl.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallpar.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallpar.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallpcv.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallpcv.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallprec.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallprec.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallproc.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallproc.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallprod.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallprod.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gall/gallrslt.cpp.o"
+  "CMakeFiles/LibGnut.dir/gall/gallrslt.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/atx.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/atx.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/biabernese.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/biabernese.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/biasinex.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/biasinex.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/blq.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/blq.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/gcoder.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/gcoder.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/gcoder_buffer.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/gcoder_buffer.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexc.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexc.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexn.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexn.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexo.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexo.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexo2.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexo2.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexo3.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/rinexo3.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/sinex.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/sinex.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gcoders/sp3.cpp.o"
+  "CMakeFiles/LibGnut.dir/gcoders/sp3.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gdata.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gdata.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/geph.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/geph.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gephprec.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gephprec.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gnav.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gnav.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gnavbds.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gnavbds.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gnavgal.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gnavgal.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gnavglo.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gnavglo.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gnavgps.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gnavgps.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gnavirn.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gnavirn.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gnavqzs.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gnavqzs.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gnavsbs.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gnavsbs.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gobj.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gobj.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gobsgnss.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gobsgnss.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gprecindex.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gprecindex.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/grec.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/grec.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/grnxhdr.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/grnxhdr.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/grxnhdr.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/grxnhdr.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gsatdata.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gsatdata.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gdata/gtrn.cpp.o"
+  "CMakeFiles/LibGnut.dir/gdata/gtrn.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/gasyncout.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/gasyncout.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/gepochqueue.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/gepochqueue.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/gfile.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/gfile.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/gio.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/gio.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/giof.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/giof.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/gkmlout.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/gkmlout.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/gmmapfile.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/gmmapfile.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/gnote.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/gnote.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/gobsstream.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/gobsstream.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/great_log.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/great_log.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gio/gxml.cpp.o"
+  "CMakeFiles/LibGnut.dir/gio/gxml.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gbancroft.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gbancroft.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gbias.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gbias.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gbiastable.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gbiastable.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gdop.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gdop.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/geop.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/geop.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/geop80.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/geop80.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gephplan.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gephplan.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/ggmf.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/ggmf.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/ggpt.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/ggpt.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/ginterp.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/ginterp.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gmodel.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gmodel.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gotl.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gotl.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gpar.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gpar.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gpcv.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gpcv.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gpoly.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gpoly.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gpppmodel.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gpppmodel.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gsppmodel.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gsppmodel.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gstochasticmodel.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gstochasticmodel.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gtide.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gtide.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gtide2010.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gtide2010.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gtide96.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gtide96.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gmodels/gtropo.cpp.o"
+  "CMakeFiles/LibGnut.dir/gmodels/gtropo.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gproc/gflt.cpp.o"
+  "CMakeFiles/LibGnut.dir/gproc/gflt.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gproc/gppp.cpp.o"
+  "CMakeFiles/LibGnut.dir/gproc/gppp.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gproc/gpreproc.cpp.o"
+  "CMakeFiles/LibGnut.dir/gproc/gpreproc.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gproc/gspp.cpp.o"
+  "CMakeFiles/LibGnut.dir/gproc/gspp.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gproc/gsppflt.cpp.o"
+  "CMakeFiles/LibGnut.dir/gproc/gsppflt.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gprod/gprod.cpp.o"
+  "CMakeFiles/LibGnut.dir/gprod/gprod.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gprod/gprodclk.cpp.o"
+  "CMakeFiles/LibGnut.dir/gprod/gprodclk.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gprod/gprodcrd.cpp.o"
+  "CMakeFiles/LibGnut.dir/gprod/gprodcrd.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gset/gsetbase.cpp.o"
+  "CMakeFiles/LibGnut.dir/gset/gsetbase.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gset/gsetflt.cpp.o"
+  "CMakeFiles/LibGnut.dir/gset/gsetflt.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gset/gsetgen.cpp.o"
+  "CMakeFiles/LibGnut.dir/gset/gsetgen.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gset/gsetgnss.cpp.o"
+  "CMakeFiles/LibGnut.dir/gset/gsetgnss.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gset/gsetinp.cpp.o"
+  "CMakeFiles/LibGnut.dir/gset/gsetinp.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gset/gsetout.cpp.o"
+  "CMakeFiles/LibGnut.dir/gset/gsetout.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gset/gsetproc.cpp.o"
+  "CMakeFiles/LibGnut.dir/gset/gsetproc.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gset/gsetrec.cpp.o"
+  "CMakeFiles/LibGnut.dir/gset/gsetrec.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gcommon.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gcommon.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gconst.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gconst.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gfileconv.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gfileconv.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gmatrixconv.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gmatrixconv.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gmutex.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gmutex.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gnss.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gnss.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gobs.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gobs.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gpair.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gpair.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gslotcov.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gslotcov.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gsys.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gsys.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gsysconv.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gsysconv.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gtime.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gtime.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gtimesync.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gtimesync.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gtriple.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gtriple.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/gutils/gtypeconv.cpp.o"
+  "CMakeFiles/LibGnut.dir/gutils/gtypeconv.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/bandmat.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/bandmat.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/cholesky.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/cholesky.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/evalue.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/evalue.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/fft.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/fft.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/hholder.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/hholder.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/jacobi.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/jacobi.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/myexcept.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/myexcept.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newfft.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newfft.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmat1.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmat1.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmat2.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmat2.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmat3.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmat3.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmat4.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmat4.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmat5.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmat5.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmat6.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmat6.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmat7.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmat7.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmat8.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmat8.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmat9.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmat9.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmatex.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmatex.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/newmatrm.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/newmatrm.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/nm_misc.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/nm_misc.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/sort.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/sort.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/submat.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/submat.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/newmat/svd.cpp.o"
+  "CMakeFiles/LibGnut.dir/newmat/svd.cpp.o.d"
+  "CMakeFiles/LibGnut.dir/pugixml/src/pugixml.cpp.o"
+  "CMakeFiles/LibGnut.dir/pugixml/src/pugixml.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LibGnut.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
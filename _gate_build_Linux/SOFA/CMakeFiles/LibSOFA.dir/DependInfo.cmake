@@ -0,0 +1,265 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/third-party/SOFA/a2af.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/a2af.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/a2af.c.o.d"
+  "/root/repo/src/third-party/SOFA/a2tf.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/a2tf.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/a2tf.c.o.d"
+  "/root/repo/src/third-party/SOFA/ab.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ab.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ab.c.o.d"
+  "/root/repo/src/third-party/SOFA/ae2hd.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ae2hd.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ae2hd.c.o.d"
+  "/root/repo/src/third-party/SOFA/af2a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/af2a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/af2a.c.o.d"
+  "/root/repo/src/third-party/SOFA/anp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/anp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/anp.c.o.d"
+  "/root/repo/src/third-party/SOFA/anpm.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/anpm.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/anpm.c.o.d"
+  "/root/repo/src/third-party/SOFA/apcg.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apcg.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apcg.c.o.d"
+  "/root/repo/src/third-party/SOFA/apcg13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apcg13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apcg13.c.o.d"
+  "/root/repo/src/third-party/SOFA/apci.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apci.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apci.c.o.d"
+  "/root/repo/src/third-party/SOFA/apci13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apci13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apci13.c.o.d"
+  "/root/repo/src/third-party/SOFA/apco.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apco.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apco.c.o.d"
+  "/root/repo/src/third-party/SOFA/apco13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apco13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apco13.c.o.d"
+  "/root/repo/src/third-party/SOFA/apcs.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apcs.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apcs.c.o.d"
+  "/root/repo/src/third-party/SOFA/apcs13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apcs13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apcs13.c.o.d"
+  "/root/repo/src/third-party/SOFA/aper.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/aper.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/aper.c.o.d"
+  "/root/repo/src/third-party/SOFA/aper13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/aper13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/aper13.c.o.d"
+  "/root/repo/src/third-party/SOFA/apio.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apio.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apio.c.o.d"
+  "/root/repo/src/third-party/SOFA/apio13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apio13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/apio13.c.o.d"
+  "/root/repo/src/third-party/SOFA/atcc13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atcc13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atcc13.c.o.d"
+  "/root/repo/src/third-party/SOFA/atccq.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atccq.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atccq.c.o.d"
+  "/root/repo/src/third-party/SOFA/atci13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atci13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atci13.c.o.d"
+  "/root/repo/src/third-party/SOFA/atciq.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atciq.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atciq.c.o.d"
+  "/root/repo/src/third-party/SOFA/atciqn.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atciqn.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atciqn.c.o.d"
+  "/root/repo/src/third-party/SOFA/atciqz.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atciqz.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atciqz.c.o.d"
+  "/root/repo/src/third-party/SOFA/atco13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atco13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atco13.c.o.d"
+  "/root/repo/src/third-party/SOFA/atic13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atic13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atic13.c.o.d"
+  "/root/repo/src/third-party/SOFA/aticq.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/aticq.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/aticq.c.o.d"
+  "/root/repo/src/third-party/SOFA/aticqn.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/aticqn.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/aticqn.c.o.d"
+  "/root/repo/src/third-party/SOFA/atio13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atio13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atio13.c.o.d"
+  "/root/repo/src/third-party/SOFA/atioq.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atioq.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atioq.c.o.d"
+  "/root/repo/src/third-party/SOFA/atoc13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atoc13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atoc13.c.o.d"
+  "/root/repo/src/third-party/SOFA/atoi13.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atoi13.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atoi13.c.o.d"
+  "/root/repo/src/third-party/SOFA/atoiq.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atoiq.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/atoiq.c.o.d"
+  "/root/repo/src/third-party/SOFA/bi00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/bi00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/bi00.c.o.d"
+  "/root/repo/src/third-party/SOFA/bp00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/bp00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/bp00.c.o.d"
+  "/root/repo/src/third-party/SOFA/bp06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/bp06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/bp06.c.o.d"
+  "/root/repo/src/third-party/SOFA/bpn2xy.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/bpn2xy.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/bpn2xy.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2i00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2i00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2i00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2i00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2i00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2i00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2i06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2i06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2i06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2ibpn.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2ibpn.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2ibpn.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2ixy.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2ixy.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2ixy.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2ixys.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2ixys.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2ixys.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2s.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2s.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2s.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2t00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2t00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2t00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2t00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2t00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2t00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2t06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2t06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2t06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2tcio.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2tcio.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2tcio.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2teqx.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2teqx.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2teqx.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2tpe.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2tpe.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2tpe.c.o.d"
+  "/root/repo/src/third-party/SOFA/c2txy.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2txy.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/c2txy.c.o.d"
+  "/root/repo/src/third-party/SOFA/cal2jd.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/cal2jd.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/cal2jd.c.o.d"
+  "/root/repo/src/third-party/SOFA/cp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/cp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/cp.c.o.d"
+  "/root/repo/src/third-party/SOFA/cpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/cpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/cpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/cr.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/cr.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/cr.c.o.d"
+  "/root/repo/src/third-party/SOFA/d2dtf.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/d2dtf.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/d2dtf.c.o.d"
+  "/root/repo/src/third-party/SOFA/d2tf.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/d2tf.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/d2tf.c.o.d"
+  "/root/repo/src/third-party/SOFA/dat.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/dat.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/dat.c.o.d"
+  "/root/repo/src/third-party/SOFA/dtdb.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/dtdb.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/dtdb.c.o.d"
+  "/root/repo/src/third-party/SOFA/dtf2d.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/dtf2d.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/dtf2d.c.o.d"
+  "/root/repo/src/third-party/SOFA/eceq06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eceq06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eceq06.c.o.d"
+  "/root/repo/src/third-party/SOFA/ecm06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ecm06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ecm06.c.o.d"
+  "/root/repo/src/third-party/SOFA/ee00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ee00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ee00.c.o.d"
+  "/root/repo/src/third-party/SOFA/ee00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ee00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ee00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/ee00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ee00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ee00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/ee06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ee06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ee06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/eect00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eect00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eect00.c.o.d"
+  "/root/repo/src/third-party/SOFA/eform.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eform.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eform.c.o.d"
+  "/root/repo/src/third-party/SOFA/eo06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eo06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eo06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/eors.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eors.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eors.c.o.d"
+  "/root/repo/src/third-party/SOFA/epb.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epb.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epb.c.o.d"
+  "/root/repo/src/third-party/SOFA/epb2jd.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epb2jd.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epb2jd.c.o.d"
+  "/root/repo/src/third-party/SOFA/epj.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epj.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epj.c.o.d"
+  "/root/repo/src/third-party/SOFA/epj2jd.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epj2jd.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epj2jd.c.o.d"
+  "/root/repo/src/third-party/SOFA/epv00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epv00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/epv00.c.o.d"
+  "/root/repo/src/third-party/SOFA/eqec06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eqec06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eqec06.c.o.d"
+  "/root/repo/src/third-party/SOFA/eqeq94.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eqeq94.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/eqeq94.c.o.d"
+  "/root/repo/src/third-party/SOFA/era00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/era00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/era00.c.o.d"
+  "/root/repo/src/third-party/SOFA/fad03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fad03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fad03.c.o.d"
+  "/root/repo/src/third-party/SOFA/fae03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fae03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fae03.c.o.d"
+  "/root/repo/src/third-party/SOFA/faf03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/faf03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/faf03.c.o.d"
+  "/root/repo/src/third-party/SOFA/faju03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/faju03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/faju03.c.o.d"
+  "/root/repo/src/third-party/SOFA/fal03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fal03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fal03.c.o.d"
+  "/root/repo/src/third-party/SOFA/falp03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/falp03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/falp03.c.o.d"
+  "/root/repo/src/third-party/SOFA/fama03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fama03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fama03.c.o.d"
+  "/root/repo/src/third-party/SOFA/fame03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fame03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fame03.c.o.d"
+  "/root/repo/src/third-party/SOFA/fane03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fane03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fane03.c.o.d"
+  "/root/repo/src/third-party/SOFA/faom03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/faom03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/faom03.c.o.d"
+  "/root/repo/src/third-party/SOFA/fapa03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fapa03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fapa03.c.o.d"
+  "/root/repo/src/third-party/SOFA/fasa03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fasa03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fasa03.c.o.d"
+  "/root/repo/src/third-party/SOFA/faur03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/faur03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/faur03.c.o.d"
+  "/root/repo/src/third-party/SOFA/fave03.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fave03.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fave03.c.o.d"
+  "/root/repo/src/third-party/SOFA/fk425.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk425.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk425.c.o.d"
+  "/root/repo/src/third-party/SOFA/fk45z.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk45z.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk45z.c.o.d"
+  "/root/repo/src/third-party/SOFA/fk524.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk524.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk524.c.o.d"
+  "/root/repo/src/third-party/SOFA/fk52h.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk52h.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk52h.c.o.d"
+  "/root/repo/src/third-party/SOFA/fk54z.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk54z.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk54z.c.o.d"
+  "/root/repo/src/third-party/SOFA/fk5hip.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk5hip.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk5hip.c.o.d"
+  "/root/repo/src/third-party/SOFA/fk5hz.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk5hz.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fk5hz.c.o.d"
+  "/root/repo/src/third-party/SOFA/fw2m.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fw2m.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fw2m.c.o.d"
+  "/root/repo/src/third-party/SOFA/fw2xy.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fw2xy.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/fw2xy.c.o.d"
+  "/root/repo/src/third-party/SOFA/g2icrs.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/g2icrs.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/g2icrs.c.o.d"
+  "/root/repo/src/third-party/SOFA/gc2gd.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gc2gd.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gc2gd.c.o.d"
+  "/root/repo/src/third-party/SOFA/gc2gde.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gc2gde.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gc2gde.c.o.d"
+  "/root/repo/src/third-party/SOFA/gd2gc.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gd2gc.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gd2gc.c.o.d"
+  "/root/repo/src/third-party/SOFA/gd2gce.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gd2gce.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gd2gce.c.o.d"
+  "/root/repo/src/third-party/SOFA/gmst00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gmst00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gmst00.c.o.d"
+  "/root/repo/src/third-party/SOFA/gmst06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gmst06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gmst06.c.o.d"
+  "/root/repo/src/third-party/SOFA/gmst82.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gmst82.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gmst82.c.o.d"
+  "/root/repo/src/third-party/SOFA/gst00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/gst00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/gst06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst06.c.o.d"
+  "/root/repo/src/third-party/SOFA/gst06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/gst94.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst94.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/gst94.c.o.d"
+  "/root/repo/src/third-party/SOFA/h2fk5.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/h2fk5.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/h2fk5.c.o.d"
+  "/root/repo/src/third-party/SOFA/hd2ae.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/hd2ae.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/hd2ae.c.o.d"
+  "/root/repo/src/third-party/SOFA/hd2pa.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/hd2pa.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/hd2pa.c.o.d"
+  "/root/repo/src/third-party/SOFA/hfk5z.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/hfk5z.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/hfk5z.c.o.d"
+  "/root/repo/src/third-party/SOFA/icrs2g.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/icrs2g.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/icrs2g.c.o.d"
+  "/root/repo/src/third-party/SOFA/ir.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ir.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ir.c.o.d"
+  "/root/repo/src/third-party/SOFA/jd2cal.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/jd2cal.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/jd2cal.c.o.d"
+  "/root/repo/src/third-party/SOFA/jdcalf.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/jdcalf.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/jdcalf.c.o.d"
+  "/root/repo/src/third-party/SOFA/ld.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ld.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ld.c.o.d"
+  "/root/repo/src/third-party/SOFA/ldn.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ldn.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ldn.c.o.d"
+  "/root/repo/src/third-party/SOFA/ldsun.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ldsun.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ldsun.c.o.d"
+  "/root/repo/src/third-party/SOFA/lteceq.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/lteceq.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/lteceq.c.o.d"
+  "/root/repo/src/third-party/SOFA/ltecm.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltecm.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltecm.c.o.d"
+  "/root/repo/src/third-party/SOFA/lteqec.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/lteqec.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/lteqec.c.o.d"
+  "/root/repo/src/third-party/SOFA/ltp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltp.c.o.d"
+  "/root/repo/src/third-party/SOFA/ltpb.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltpb.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltpb.c.o.d"
+  "/root/repo/src/third-party/SOFA/ltpecl.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltpecl.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltpecl.c.o.d"
+  "/root/repo/src/third-party/SOFA/ltpequ.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltpequ.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ltpequ.c.o.d"
+  "/root/repo/src/third-party/SOFA/moon98.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/moon98.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/moon98.c.o.d"
+  "/root/repo/src/third-party/SOFA/num00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/num00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/num00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/num00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/num00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/num00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/num06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/num06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/num06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/numat.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/numat.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/numat.c.o.d"
+  "/root/repo/src/third-party/SOFA/nut00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nut00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nut00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/nut00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nut00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nut00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/nut06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nut06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nut06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/nut80.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nut80.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nut80.c.o.d"
+  "/root/repo/src/third-party/SOFA/nutm80.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nutm80.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/nutm80.c.o.d"
+  "/root/repo/src/third-party/SOFA/obl06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/obl06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/obl06.c.o.d"
+  "/root/repo/src/third-party/SOFA/obl80.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/obl80.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/obl80.c.o.d"
+  "/root/repo/src/third-party/SOFA/p06e.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/p06e.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/p06e.c.o.d"
+  "/root/repo/src/third-party/SOFA/p2pv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/p2pv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/p2pv.c.o.d"
+  "/root/repo/src/third-party/SOFA/p2s.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/p2s.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/p2s.c.o.d"
+  "/root/repo/src/third-party/SOFA/pap.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pap.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pap.c.o.d"
+  "/root/repo/src/third-party/SOFA/pas.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pas.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pas.c.o.d"
+  "/root/repo/src/third-party/SOFA/pb06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pb06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pb06.c.o.d"
+  "/root/repo/src/third-party/SOFA/pdp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pdp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pdp.c.o.d"
+  "/root/repo/src/third-party/SOFA/pfw06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pfw06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pfw06.c.o.d"
+  "/root/repo/src/third-party/SOFA/plan94.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/plan94.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/plan94.c.o.d"
+  "/root/repo/src/third-party/SOFA/pm.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pm.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pm.c.o.d"
+  "/root/repo/src/third-party/SOFA/pmat00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmat00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmat00.c.o.d"
+  "/root/repo/src/third-party/SOFA/pmat06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmat06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmat06.c.o.d"
+  "/root/repo/src/third-party/SOFA/pmat76.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmat76.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmat76.c.o.d"
+  "/root/repo/src/third-party/SOFA/pmp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmp.c.o.d"
+  "/root/repo/src/third-party/SOFA/pmpx.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmpx.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmpx.c.o.d"
+  "/root/repo/src/third-party/SOFA/pmsafe.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmsafe.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pmsafe.c.o.d"
+  "/root/repo/src/third-party/SOFA/pn.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn.c.o.d"
+  "/root/repo/src/third-party/SOFA/pn00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn00.c.o.d"
+  "/root/repo/src/third-party/SOFA/pn00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/pn00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/pn06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn06.c.o.d"
+  "/root/repo/src/third-party/SOFA/pn06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pn06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/pnm00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pnm00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pnm00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/pnm00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pnm00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pnm00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/pnm06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pnm06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pnm06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/pnm80.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pnm80.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pnm80.c.o.d"
+  "/root/repo/src/third-party/SOFA/pom00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pom00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pom00.c.o.d"
+  "/root/repo/src/third-party/SOFA/ppp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ppp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ppp.c.o.d"
+  "/root/repo/src/third-party/SOFA/ppsp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ppsp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ppsp.c.o.d"
+  "/root/repo/src/third-party/SOFA/pr00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pr00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pr00.c.o.d"
+  "/root/repo/src/third-party/SOFA/prec76.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/prec76.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/prec76.c.o.d"
+  "/root/repo/src/third-party/SOFA/pv2p.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pv2p.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pv2p.c.o.d"
+  "/root/repo/src/third-party/SOFA/pv2s.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pv2s.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pv2s.c.o.d"
+  "/root/repo/src/third-party/SOFA/pvdpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvdpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvdpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/pvm.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvm.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvm.c.o.d"
+  "/root/repo/src/third-party/SOFA/pvmpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvmpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvmpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/pvppv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvppv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvppv.c.o.d"
+  "/root/repo/src/third-party/SOFA/pvstar.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvstar.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvstar.c.o.d"
+  "/root/repo/src/third-party/SOFA/pvtob.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvtob.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvtob.c.o.d"
+  "/root/repo/src/third-party/SOFA/pvu.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvu.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvu.c.o.d"
+  "/root/repo/src/third-party/SOFA/pvup.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvup.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvup.c.o.d"
+  "/root/repo/src/third-party/SOFA/pvxpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvxpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pvxpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/pxp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pxp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/pxp.c.o.d"
+  "/root/repo/src/third-party/SOFA/refco.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/refco.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/refco.c.o.d"
+  "/root/repo/src/third-party/SOFA/rm2v.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rm2v.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rm2v.c.o.d"
+  "/root/repo/src/third-party/SOFA/rv2m.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rv2m.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rv2m.c.o.d"
+  "/root/repo/src/third-party/SOFA/rx.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rx.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rx.c.o.d"
+  "/root/repo/src/third-party/SOFA/rxp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rxp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rxp.c.o.d"
+  "/root/repo/src/third-party/SOFA/rxpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rxpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rxpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/rxr.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rxr.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rxr.c.o.d"
+  "/root/repo/src/third-party/SOFA/ry.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ry.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ry.c.o.d"
+  "/root/repo/src/third-party/SOFA/rz.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rz.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/rz.c.o.d"
+  "/root/repo/src/third-party/SOFA/s00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s00.c.o.d"
+  "/root/repo/src/third-party/SOFA/s00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/s00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/s06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s06.c.o.d"
+  "/root/repo/src/third-party/SOFA/s06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/s2c.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s2c.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s2c.c.o.d"
+  "/root/repo/src/third-party/SOFA/s2p.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s2p.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s2p.c.o.d"
+  "/root/repo/src/third-party/SOFA/s2pv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s2pv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s2pv.c.o.d"
+  "/root/repo/src/third-party/SOFA/s2xpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s2xpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/s2xpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/sepp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/sepp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/sepp.c.o.d"
+  "/root/repo/src/third-party/SOFA/seps.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/seps.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/seps.c.o.d"
+  "/root/repo/src/third-party/SOFA/sp00.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/sp00.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/sp00.c.o.d"
+  "/root/repo/src/third-party/SOFA/starpm.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/starpm.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/starpm.c.o.d"
+  "/root/repo/src/third-party/SOFA/starpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/starpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/starpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/sxp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/sxp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/sxp.c.o.d"
+  "/root/repo/src/third-party/SOFA/sxpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/sxpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/sxpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/taitt.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/taitt.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/taitt.c.o.d"
+  "/root/repo/src/third-party/SOFA/taiut1.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/taiut1.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/taiut1.c.o.d"
+  "/root/repo/src/third-party/SOFA/taiutc.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/taiutc.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/taiutc.c.o.d"
+  "/root/repo/src/third-party/SOFA/tcbtdb.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tcbtdb.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tcbtdb.c.o.d"
+  "/root/repo/src/third-party/SOFA/tcgtt.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tcgtt.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tcgtt.c.o.d"
+  "/root/repo/src/third-party/SOFA/tdbtcb.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tdbtcb.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tdbtcb.c.o.d"
+  "/root/repo/src/third-party/SOFA/tdbtt.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tdbtt.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tdbtt.c.o.d"
+  "/root/repo/src/third-party/SOFA/tf2a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tf2a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tf2a.c.o.d"
+  "/root/repo/src/third-party/SOFA/tf2d.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tf2d.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tf2d.c.o.d"
+  "/root/repo/src/third-party/SOFA/tpors.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpors.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpors.c.o.d"
+  "/root/repo/src/third-party/SOFA/tporv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tporv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tporv.c.o.d"
+  "/root/repo/src/third-party/SOFA/tpsts.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpsts.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpsts.c.o.d"
+  "/root/repo/src/third-party/SOFA/tpstv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpstv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpstv.c.o.d"
+  "/root/repo/src/third-party/SOFA/tpxes.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpxes.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpxes.c.o.d"
+  "/root/repo/src/third-party/SOFA/tpxev.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpxev.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tpxev.c.o.d"
+  "/root/repo/src/third-party/SOFA/tr.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tr.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tr.c.o.d"
+  "/root/repo/src/third-party/SOFA/trxp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/trxp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/trxp.c.o.d"
+  "/root/repo/src/third-party/SOFA/trxpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/trxpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/trxpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/tttai.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tttai.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tttai.c.o.d"
+  "/root/repo/src/third-party/SOFA/tttcg.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tttcg.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tttcg.c.o.d"
+  "/root/repo/src/third-party/SOFA/tttdb.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tttdb.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/tttdb.c.o.d"
+  "/root/repo/src/third-party/SOFA/ttut1.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ttut1.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ttut1.c.o.d"
+  "/root/repo/src/third-party/SOFA/ut1tai.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ut1tai.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ut1tai.c.o.d"
+  "/root/repo/src/third-party/SOFA/ut1tt.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ut1tt.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ut1tt.c.o.d"
+  "/root/repo/src/third-party/SOFA/ut1utc.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ut1utc.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/ut1utc.c.o.d"
+  "/root/repo/src/third-party/SOFA/utctai.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/utctai.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/utctai.c.o.d"
+  "/root/repo/src/third-party/SOFA/utcut1.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/utcut1.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/utcut1.c.o.d"
+  "/root/repo/src/third-party/SOFA/xy06.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/xy06.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/xy06.c.o.d"
+  "/root/repo/src/third-party/SOFA/xys00a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/xys00a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/xys00a.c.o.d"
+  "/root/repo/src/third-party/SOFA/xys00b.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/xys00b.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/xys00b.c.o.d"
+  "/root/repo/src/third-party/SOFA/xys06a.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/xys06a.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/xys06a.c.o.d"
+  "/root/repo/src/third-party/SOFA/zp.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/zp.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/zp.c.o.d"
+  "/root/repo/src/third-party/SOFA/zpv.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/zpv.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/zpv.c.o.d"
+  "/root/repo/src/third-party/SOFA/zr.c" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/zr.c.o" "gcc" "/root/repo/_gate_build_Linux/SOFA/CMakeFiles/LibSOFA.dir/zr.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,503 @@
+file(REMOVE_RECURSE
+  "/root/repo/_gate_build_Linux/Lib/libLibSOFA.a"
+  "/root/repo/_gate_build_Linux/Lib/libLibSOFA.pdb"
+  "CMakeFiles/LibSOFA.dir/a2af.c.o"
+  "CMakeFiles/LibSOFA.dir/a2af.c.o.d"
+  "CMakeFiles/LibSOFA.dir/a2tf.c.o"
+  "CMakeFiles/LibSOFA.dir/a2tf.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ab.c.o"
+  "CMakeFiles/LibSOFA.dir/ab.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ae2hd.c.o"
+  "CMakeFiles/LibSOFA.dir/ae2hd.c.o.d"
+  "CMakeFiles/LibSOFA.dir/af2a.c.o"
+  "CMakeFiles/LibSOFA.dir/af2a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/anp.c.o"
+  "CMakeFiles/LibSOFA.dir/anp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/anpm.c.o"
+  "CMakeFiles/LibSOFA.dir/anpm.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apcg.c.o"
+  "CMakeFiles/LibSOFA.dir/apcg.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apcg13.c.o"
+  "CMakeFiles/LibSOFA.dir/apcg13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apci.c.o"
+  "CMakeFiles/LibSOFA.dir/apci.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apci13.c.o"
+  "CMakeFiles/LibSOFA.dir/apci13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apco.c.o"
+  "CMakeFiles/LibSOFA.dir/apco.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apco13.c.o"
+  "CMakeFiles/LibSOFA.dir/apco13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apcs.c.o"
+  "CMakeFiles/LibSOFA.dir/apcs.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apcs13.c.o"
+  "CMakeFiles/LibSOFA.dir/apcs13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/aper.c.o"
+  "CMakeFiles/LibSOFA.dir/aper.c.o.d"
+  "CMakeFiles/LibSOFA.dir/aper13.c.o"
+  "CMakeFiles/LibSOFA.dir/aper13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apio.c.o"
+  "CMakeFiles/LibSOFA.dir/apio.c.o.d"
+  "CMakeFiles/LibSOFA.dir/apio13.c.o"
+  "CMakeFiles/LibSOFA.dir/apio13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atcc13.c.o"
+  "CMakeFiles/LibSOFA.dir/atcc13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atccq.c.o"
+  "CMakeFiles/LibSOFA.dir/atccq.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atci13.c.o"
+  "CMakeFiles/LibSOFA.dir/atci13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atciq.c.o"
+  "CMakeFiles/LibSOFA.dir/atciq.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atciqn.c.o"
+  "CMakeFiles/LibSOFA.dir/atciqn.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atciqz.c.o"
+  "CMakeFiles/LibSOFA.dir/atciqz.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atco13.c.o"
+  "CMakeFiles/LibSOFA.dir/atco13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atic13.c.o"
+  "CMakeFiles/LibSOFA.dir/atic13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/aticq.c.o"
+  "CMakeFiles/LibSOFA.dir/aticq.c.o.d"
+  "CMakeFiles/LibSOFA.dir/aticqn.c.o"
+  "CMakeFiles/LibSOFA.dir/aticqn.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atio13.c.o"
+  "CMakeFiles/LibSOFA.dir/atio13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atioq.c.o"
+  "CMakeFiles/LibSOFA.dir/atioq.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atoc13.c.o"
+  "CMakeFiles/LibSOFA.dir/atoc13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atoi13.c.o"
+  "CMakeFiles/LibSOFA.dir/atoi13.c.o.d"
+  "CMakeFiles/LibSOFA.dir/atoiq.c.o"
+  "CMakeFiles/LibSOFA.dir/atoiq.c.o.d"
+  "CMakeFiles/LibSOFA.dir/bi00.c.o"
+  "CMakeFiles/LibSOFA.dir/bi00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/bp00.c.o"
+  "CMakeFiles/LibSOFA.dir/bp00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/bp06.c.o"
+  "CMakeFiles/LibSOFA.dir/bp06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/bpn2xy.c.o"
+  "CMakeFiles/LibSOFA.dir/bpn2xy.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2i00a.c.o"
+  "CMakeFiles/LibSOFA.dir/c2i00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2i00b.c.o"
+  "CMakeFiles/LibSOFA.dir/c2i00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2i06a.c.o"
+  "CMakeFiles/LibSOFA.dir/c2i06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2ibpn.c.o"
+  "CMakeFiles/LibSOFA.dir/c2ibpn.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2ixy.c.o"
+  "CMakeFiles/LibSOFA.dir/c2ixy.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2ixys.c.o"
+  "CMakeFiles/LibSOFA.dir/c2ixys.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2s.c.o"
+  "CMakeFiles/LibSOFA.dir/c2s.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2t00a.c.o"
+  "CMakeFiles/LibSOFA.dir/c2t00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2t00b.c.o"
+  "CMakeFiles/LibSOFA.dir/c2t00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2t06a.c.o"
+  "CMakeFiles/LibSOFA.dir/c2t06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2tcio.c.o"
+  "CMakeFiles/LibSOFA.dir/c2tcio.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2teqx.c.o"
+  "CMakeFiles/LibSOFA.dir/c2teqx.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2tpe.c.o"
+  "CMakeFiles/LibSOFA.dir/c2tpe.c.o.d"
+  "CMakeFiles/LibSOFA.dir/c2txy.c.o"
+  "CMakeFiles/LibSOFA.dir/c2txy.c.o.d"
+  "CMakeFiles/LibSOFA.dir/cal2jd.c.o"
+  "CMakeFiles/LibSOFA.dir/cal2jd.c.o.d"
+  "CMakeFiles/LibSOFA.dir/cp.c.o"
+  "CMakeFiles/LibSOFA.dir/cp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/cpv.c.o"
+  "CMakeFiles/LibSOFA.dir/cpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/cr.c.o"
+  "CMakeFiles/LibSOFA.dir/cr.c.o.d"
+  "CMakeFiles/LibSOFA.dir/d2dtf.c.o"
+  "CMakeFiles/LibSOFA.dir/d2dtf.c.o.d"
+  "CMakeFiles/LibSOFA.dir/d2tf.c.o"
+  "CMakeFiles/LibSOFA.dir/d2tf.c.o.d"
+  "CMakeFiles/LibSOFA.dir/dat.c.o"
+  "CMakeFiles/LibSOFA.dir/dat.c.o.d"
+  "CMakeFiles/LibSOFA.dir/dtdb.c.o"
+  "CMakeFiles/LibSOFA.dir/dtdb.c.o.d"
+  "CMakeFiles/LibSOFA.dir/dtf2d.c.o"
+  "CMakeFiles/LibSOFA.dir/dtf2d.c.o.d"
+  "CMakeFiles/LibSOFA.dir/eceq06.c.o"
+  "CMakeFiles/LibSOFA.dir/eceq06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ecm06.c.o"
+  "CMakeFiles/LibSOFA.dir/ecm06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ee00.c.o"
+  "CMakeFiles/LibSOFA.dir/ee00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ee00a.c.o"
+  "CMakeFiles/LibSOFA.dir/ee00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ee00b.c.o"
+  "CMakeFiles/LibSOFA.dir/ee00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ee06a.c.o"
+  "CMakeFiles/LibSOFA.dir/ee06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/eect00.c.o"
+  "CMakeFiles/LibSOFA.dir/eect00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/eform.c.o"
+  "CMakeFiles/LibSOFA.dir/eform.c.o.d"
+  "CMakeFiles/LibSOFA.dir/eo06a.c.o"
+  "CMakeFiles/LibSOFA.dir/eo06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/eors.c.o"
+  "CMakeFiles/LibSOFA.dir/eors.c.o.d"
+  "CMakeFiles/LibSOFA.dir/epb.c.o"
+  "CMakeFiles/LibSOFA.dir/epb.c.o.d"
+  "CMakeFiles/LibSOFA.dir/epb2jd.c.o"
+  "CMakeFiles/LibSOFA.dir/epb2jd.c.o.d"
+  "CMakeFiles/LibSOFA.dir/epj.c.o"
+  "CMakeFiles/LibSOFA.dir/epj.c.o.d"
+  "CMakeFiles/LibSOFA.dir/epj2jd.c.o"
+  "CMakeFiles/LibSOFA.dir/epj2jd.c.o.d"
+  "CMakeFiles/LibSOFA.dir/epv00.c.o"
+  "CMakeFiles/LibSOFA.dir/epv00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/eqec06.c.o"
+  "CMakeFiles/LibSOFA.dir/eqec06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/eqeq94.c.o"
+  "CMakeFiles/LibSOFA.dir/eqeq94.c.o.d"
+  "CMakeFiles/LibSOFA.dir/era00.c.o"
+  "CMakeFiles/LibSOFA.dir/era00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fad03.c.o"
+  "CMakeFiles/LibSOFA.dir/fad03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fae03.c.o"
+  "CMakeFiles/LibSOFA.dir/fae03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/faf03.c.o"
+  "CMakeFiles/LibSOFA.dir/faf03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/faju03.c.o"
+  "CMakeFiles/LibSOFA.dir/faju03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fal03.c.o"
+  "CMakeFiles/LibSOFA.dir/fal03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/falp03.c.o"
+  "CMakeFiles/LibSOFA.dir/falp03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fama03.c.o"
+  "CMakeFiles/LibSOFA.dir/fama03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fame03.c.o"
+  "CMakeFiles/LibSOFA.dir/fame03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fane03.c.o"
+  "CMakeFiles/LibSOFA.dir/fane03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/faom03.c.o"
+  "CMakeFiles/LibSOFA.dir/faom03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fapa03.c.o"
+  "CMakeFiles/LibSOFA.dir/fapa03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fasa03.c.o"
+  "CMakeFiles/LibSOFA.dir/fasa03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/faur03.c.o"
+  "CMakeFiles/LibSOFA.dir/faur03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fave03.c.o"
+  "CMakeFiles/LibSOFA.dir/fave03.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fk425.c.o"
+  "CMakeFiles/LibSOFA.dir/fk425.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fk45z.c.o"
+  "CMakeFiles/LibSOFA.dir/fk45z.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fk524.c.o"
+  "CMakeFiles/LibSOFA.dir/fk524.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fk52h.c.o"
+  "CMakeFiles/LibSOFA.dir/fk52h.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fk54z.c.o"
+  "CMakeFiles/LibSOFA.dir/fk54z.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fk5hip.c.o"
+  "CMakeFiles/LibSOFA.dir/fk5hip.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fk5hz.c.o"
+  "CMakeFiles/LibSOFA.dir/fk5hz.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fw2m.c.o"
+  "CMakeFiles/LibSOFA.dir/fw2m.c.o.d"
+  "CMakeFiles/LibSOFA.dir/fw2xy.c.o"
+  "CMakeFiles/LibSOFA.dir/fw2xy.c.o.d"
+  "CMakeFiles/LibSOFA.dir/g2icrs.c.o"
+  "CMakeFiles/LibSOFA.dir/g2icrs.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gc2gd.c.o"
+  "CMakeFiles/LibSOFA.dir/gc2gd.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gc2gde.c.o"
+  "CMakeFiles/LibSOFA.dir/gc2gde.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gd2gc.c.o"
+  "CMakeFiles/LibSOFA.dir/gd2gc.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gd2gce.c.o"
+  "CMakeFiles/LibSOFA.dir/gd2gce.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gmst00.c.o"
+  "CMakeFiles/LibSOFA.dir/gmst00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gmst06.c.o"
+  "CMakeFiles/LibSOFA.dir/gmst06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gmst82.c.o"
+  "CMakeFiles/LibSOFA.dir/gmst82.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gst00a.c.o"
+  "CMakeFiles/LibSOFA.dir/gst00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gst00b.c.o"
+  "CMakeFiles/LibSOFA.dir/gst00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gst06.c.o"
+  "CMakeFiles/LibSOFA.dir/gst06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gst06a.c.o"
+  "CMakeFiles/LibSOFA.dir/gst06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/gst94.c.o"
+  "CMakeFiles/LibSOFA.dir/gst94.c.o.d"
+  "CMakeFiles/LibSOFA.dir/h2fk5.c.o"
+  "CMakeFiles/LibSOFA.dir/h2fk5.c.o.d"
+  "CMakeFiles/LibSOFA.dir/hd2ae.c.o"
+  "CMakeFiles/LibSOFA.dir/hd2ae.c.o.d"
+  "CMakeFiles/LibSOFA.dir/hd2pa.c.o"
+  "CMakeFiles/LibSOFA.dir/hd2pa.c.o.d"
+  "CMakeFiles/LibSOFA.dir/hfk5z.c.o"
+  "CMakeFiles/LibSOFA.dir/hfk5z.c.o.d"
+  "CMakeFiles/LibSOFA.dir/icrs2g.c.o"
+  "CMakeFiles/LibSOFA.dir/icrs2g.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ir.c.o"
+  "CMakeFiles/LibSOFA.dir/ir.c.o.d"
+  "CMakeFiles/LibSOFA.dir/jd2cal.c.o"
+  "CMakeFiles/LibSOFA.dir/jd2cal.c.o.d"
+  "CMakeFiles/LibSOFA.dir/jdcalf.c.o"
+  "CMakeFiles/LibSOFA.dir/jdcalf.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ld.c.o"
+  "CMakeFiles/LibSOFA.dir/ld.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ldn.c.o"
+  "CMakeFiles/LibSOFA.dir/ldn.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ldsun.c.o"
+  "CMakeFiles/LibSOFA.dir/ldsun.c.o.d"
+  "CMakeFiles/LibSOFA.dir/lteceq.c.o"
+  "CMakeFiles/LibSOFA.dir/lteceq.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ltecm.c.o"
+  "CMakeFiles/LibSOFA.dir/ltecm.c.o.d"
+  "CMakeFiles/LibSOFA.dir/lteqec.c.o"
+  "CMakeFiles/LibSOFA.dir/lteqec.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ltp.c.o"
+  "CMakeFiles/LibSOFA.dir/ltp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ltpb.c.o"
+  "CMakeFiles/LibSOFA.dir/ltpb.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ltpecl.c.o"
+  "CMakeFiles/LibSOFA.dir/ltpecl.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ltpequ.c.o"
+  "CMakeFiles/LibSOFA.dir/ltpequ.c.o.d"
+  "CMakeFiles/LibSOFA.dir/moon98.c.o"
+  "CMakeFiles/LibSOFA.dir/moon98.c.o.d"
+  "CMakeFiles/LibSOFA.dir/num00a.c.o"
+  "CMakeFiles/LibSOFA.dir/num00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/num00b.c.o"
+  "CMakeFiles/LibSOFA.dir/num00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/num06a.c.o"
+  "CMakeFiles/LibSOFA.dir/num06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/numat.c.o"
+  "CMakeFiles/LibSOFA.dir/numat.c.o.d"
+  "CMakeFiles/LibSOFA.dir/nut00a.c.o"
+  "CMakeFiles/LibSOFA.dir/nut00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/nut00b.c.o"
+  "CMakeFiles/LibSOFA.dir/nut00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/nut06a.c.o"
+  "CMakeFiles/LibSOFA.dir/nut06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/nut80.c.o"
+  "CMakeFiles/LibSOFA.dir/nut80.c.o.d"
+  "CMakeFiles/LibSOFA.dir/nutm80.c.o"
+  "CMakeFiles/LibSOFA.dir/nutm80.c.o.d"
+  "CMakeFiles/LibSOFA.dir/obl06.c.o"
+  "CMakeFiles/LibSOFA.dir/obl06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/obl80.c.o"
+  "CMakeFiles/LibSOFA.dir/obl80.c.o.d"
+  "CMakeFiles/LibSOFA.dir/p06e.c.o"
+  "CMakeFiles/LibSOFA.dir/p06e.c.o.d"
+  "CMakeFiles/LibSOFA.dir/p2pv.c.o"
+  "CMakeFiles/LibSOFA.dir/p2pv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/p2s.c.o"
+  "CMakeFiles/LibSOFA.dir/p2s.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pap.c.o"
+  "CMakeFiles/LibSOFA.dir/pap.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pas.c.o"
+  "CMakeFiles/LibSOFA.dir/pas.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pb06.c.o"
+  "CMakeFiles/LibSOFA.dir/pb06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pdp.c.o"
+  "CMakeFiles/LibSOFA.dir/pdp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pfw06.c.o"
+  "CMakeFiles/LibSOFA.dir/pfw06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/plan94.c.o"
+  "CMakeFiles/LibSOFA.dir/plan94.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pm.c.o"
+  "CMakeFiles/LibSOFA.dir/pm.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pmat00.c.o"
+  "CMakeFiles/LibSOFA.dir/pmat00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pmat06.c.o"
+  "CMakeFiles/LibSOFA.dir/pmat06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pmat76.c.o"
+  "CMakeFiles/LibSOFA.dir/pmat76.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pmp.c.o"
+  "CMakeFiles/LibSOFA.dir/pmp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pmpx.c.o"
+  "CMakeFiles/LibSOFA.dir/pmpx.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pmsafe.c.o"
+  "CMakeFiles/LibSOFA.dir/pmsafe.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pn.c.o"
+  "CMakeFiles/LibSOFA.dir/pn.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pn00.c.o"
+  "CMakeFiles/LibSOFA.dir/pn00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pn00a.c.o"
+  "CMakeFiles/LibSOFA.dir/pn00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pn00b.c.o"
+  "CMakeFiles/LibSOFA.dir/pn00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pn06.c.o"
+  "CMakeFiles/LibSOFA.dir/pn06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pn06a.c.o"
+  "CMakeFiles/LibSOFA.dir/pn06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pnm00a.c.o"
+  "CMakeFiles/LibSOFA.dir/pnm00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pnm00b.c.o"
+  "CMakeFiles/LibSOFA.dir/pnm00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pnm06a.c.o"
+  "CMakeFiles/LibSOFA.dir/pnm06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pnm80.c.o"
+  "CMakeFiles/LibSOFA.dir/pnm80.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pom00.c.o"
+  "CMakeFiles/LibSOFA.dir/pom00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ppp.c.o"
+  "CMakeFiles/LibSOFA.dir/ppp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ppsp.c.o"
+  "CMakeFiles/LibSOFA.dir/ppsp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pr00.c.o"
+  "CMakeFiles/LibSOFA.dir/pr00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/prec76.c.o"
+  "CMakeFiles/LibSOFA.dir/prec76.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pv2p.c.o"
+  "CMakeFiles/LibSOFA.dir/pv2p.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pv2s.c.o"
+  "CMakeFiles/LibSOFA.dir/pv2s.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pvdpv.c.o"
+  "CMakeFiles/LibSOFA.dir/pvdpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pvm.c.o"
+  "CMakeFiles/LibSOFA.dir/pvm.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pvmpv.c.o"
+  "CMakeFiles/LibSOFA.dir/pvmpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pvppv.c.o"
+  "CMakeFiles/LibSOFA.dir/pvppv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pvstar.c.o"
+  "CMakeFiles/LibSOFA.dir/pvstar.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pvtob.c.o"
+  "CMakeFiles/LibSOFA.dir/pvtob.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pvu.c.o"
+  "CMakeFiles/LibSOFA.dir/pvu.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pvup.c.o"
+  "CMakeFiles/LibSOFA.dir/pvup.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pvxpv.c.o"
+  "CMakeFiles/LibSOFA.dir/pvxpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/pxp.c.o"
+  "CMakeFiles/LibSOFA.dir/pxp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/refco.c.o"
+  "CMakeFiles/LibSOFA.dir/refco.c.o.d"
+  "CMakeFiles/LibSOFA.dir/rm2v.c.o"
+  "CMakeFiles/LibSOFA.dir/rm2v.c.o.d"
+  "CMakeFiles/LibSOFA.dir/rv2m.c.o"
+  "CMakeFiles/LibSOFA.dir/rv2m.c.o.d"
+  "CMakeFiles/LibSOFA.dir/rx.c.o"
+  "CMakeFiles/LibSOFA.dir/rx.c.o.d"
+  "CMakeFiles/LibSOFA.dir/rxp.c.o"
+  "CMakeFiles/LibSOFA.dir/rxp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/rxpv.c.o"
+  "CMakeFiles/LibSOFA.dir/rxpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/rxr.c.o"
+  "CMakeFiles/LibSOFA.dir/rxr.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ry.c.o"
+  "CMakeFiles/LibSOFA.dir/ry.c.o.d"
+  "CMakeFiles/LibSOFA.dir/rz.c.o"
+  "CMakeFiles/LibSOFA.dir/rz.c.o.d"
+  "CMakeFiles/LibSOFA.dir/s00.c.o"
+  "CMakeFiles/LibSOFA.dir/s00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/s00a.c.o"
+  "CMakeFiles/LibSOFA.dir/s00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/s00b.c.o"
+  "CMakeFiles/LibSOFA.dir/s00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/s06.c.o"
+  "CMakeFiles/LibSOFA.dir/s06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/s06a.c.o"
+  "CMakeFiles/LibSOFA.dir/s06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/s2c.c.o"
+  "CMakeFiles/LibSOFA.dir/s2c.c.o.d"
+  "CMakeFiles/LibSOFA.dir/s2p.c.o"
+  "CMakeFiles/LibSOFA.dir/s2p.c.o.d"
+  "CMakeFiles/LibSOFA.dir/s2pv.c.o"
+  "CMakeFiles/LibSOFA.dir/s2pv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/s2xpv.c.o"
+  "CMakeFiles/LibSOFA.dir/s2xpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/sepp.c.o"
+  "CMakeFiles/LibSOFA.dir/sepp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/seps.c.o"
+  "CMakeFiles/LibSOFA.dir/seps.c.o.d"
+  "CMakeFiles/LibSOFA.dir/sp00.c.o"
+  "CMakeFiles/LibSOFA.dir/sp00.c.o.d"
+  "CMakeFiles/LibSOFA.dir/starpm.c.o"
+  "CMakeFiles/LibSOFA.dir/starpm.c.o.d"
+  "CMakeFiles/LibSOFA.dir/starpv.c.o"
+  "CMakeFiles/LibSOFA.dir/starpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/sxp.c.o"
+  "CMakeFiles/LibSOFA.dir/sxp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/sxpv.c.o"
+  "CMakeFiles/LibSOFA.dir/sxpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/taitt.c.o"
+  "CMakeFiles/LibSOFA.dir/taitt.c.o.d"
+  "CMakeFiles/LibSOFA.dir/taiut1.c.o"
+  "CMakeFiles/LibSOFA.dir/taiut1.c.o.d"
+  "CMakeFiles/LibSOFA.dir/taiutc.c.o"
+  "CMakeFiles/LibSOFA.dir/taiutc.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tcbtdb.c.o"
+  "CMakeFiles/LibSOFA.dir/tcbtdb.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tcgtt.c.o"
+  "CMakeFiles/LibSOFA.dir/tcgtt.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tdbtcb.c.o"
+  "CMakeFiles/LibSOFA.dir/tdbtcb.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tdbtt.c.o"
+  "CMakeFiles/LibSOFA.dir/tdbtt.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tf2a.c.o"
+  "CMakeFiles/LibSOFA.dir/tf2a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tf2d.c.o"
+  "CMakeFiles/LibSOFA.dir/tf2d.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tpors.c.o"
+  "CMakeFiles/LibSOFA.dir/tpors.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tporv.c.o"
+  "CMakeFiles/LibSOFA.dir/tporv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tpsts.c.o"
+  "CMakeFiles/LibSOFA.dir/tpsts.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tpstv.c.o"
+  "CMakeFiles/LibSOFA.dir/tpstv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tpxes.c.o"
+  "CMakeFiles/LibSOFA.dir/tpxes.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tpxev.c.o"
+  "CMakeFiles/LibSOFA.dir/tpxev.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tr.c.o"
+  "CMakeFiles/LibSOFA.dir/tr.c.o.d"
+  "CMakeFiles/LibSOFA.dir/trxp.c.o"
+  "CMakeFiles/LibSOFA.dir/trxp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/trxpv.c.o"
+  "CMakeFiles/LibSOFA.dir/trxpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tttai.c.o"
+  "CMakeFiles/LibSOFA.dir/tttai.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tttcg.c.o"
+  "CMakeFiles/LibSOFA.dir/tttcg.c.o.d"
+  "CMakeFiles/LibSOFA.dir/tttdb.c.o"
+  "CMakeFiles/LibSOFA.dir/tttdb.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ttut1.c.o"
+  "CMakeFiles/LibSOFA.dir/ttut1.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ut1tai.c.o"
+  "CMakeFiles/LibSOFA.dir/ut1tai.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ut1tt.c.o"
+  "CMakeFiles/LibSOFA.dir/ut1tt.c.o.d"
+  "CMakeFiles/LibSOFA.dir/ut1utc.c.o"
+  "CMakeFiles/LibSOFA.dir/ut1utc.c.o.d"
+  "CMakeFiles/LibSOFA.dir/utctai.c.o"
+  "CMakeFiles/LibSOFA.dir/utctai.c.o.d"
+  "CMakeFiles/LibSOFA.dir/utcut1.c.o"
+  "CMakeFiles/LibSOFA.dir/utcut1.c.o.d"
+  "CMakeFiles/LibSOFA.dir/xy06.c.o"
+  "CMakeFiles/LibSOFA.dir/xy06.c.o.d"
+  "CMakeFiles/LibSOFA.dir/xys00a.c.o"
+  "CMakeFiles/LibSOFA.dir/xys00a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/xys00b.c.o"
+  "CMakeFiles/LibSOFA.dir/xys00b.c.o.d"
+  "CMakeFiles/LibSOFA.dir/xys06a.c.o"
+  "CMakeFiles/LibSOFA.dir/xys06a.c.o.d"
+  "CMakeFiles/LibSOFA.dir/zp.c.o"
+  "CMakeFiles/LibSOFA.dir/zp.c.o.d"
+  "CMakeFiles/LibSOFA.dir/zpv.c.o"
+  "CMakeFiles/LibSOFA.dir/zpv.c.o.d"
+  "CMakeFiles/LibSOFA.dir/zr.c.o"
+  "CMakeFiles/LibSOFA.dir/zr.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/LibSOFA.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "/root/repo/_gate_build_Linux/Lib/libLibSOFA.a"
+)
@@ -66,6 +66,8 @@ namespace great
         _map_WL_decision = dynamic_cast<t_gsetamb*>(_gset)->get_amb_decision("WL");
         _map_NL_decision = dynamic_cast<t_gsetamb*>(_gset)->get_amb_decision("NL");
         _ratio = dynamic_cast<t_gsetamb*>(_gset)->lambda_ratio();
+        _lambda.search(dynamic_cast<t_gsetamb*>(_gset)->lambda_search());
+        _lambda_cands = dynamic_cast<t_gsetamb*>(_gset)->lambda_cands();
         _boot = dynamic_cast<t_gsetamb*>(_gset)->bootstrapping();
         _frequency = dynamic_cast<t_gsetproc*>(_gset)->frequency();
         _full_fix_num = dynamic_cast<t_gsetamb*>(_gset)->full_fix_num();
@@ -552,8 +554,8 @@ namespace great
     {
         const string strCprogName = "check_amb_depend";
         const double dEPS = 1e-12;
-        static int iNdim_ow = 0;
-        static int iNdim_for_check = 0;
+        thread_local int iNdim_ow = 0;
+        thread_local int iNdim_for_check = 0;
         int i, j;
         const double dOper[4] = {1.0, -1.0, -1.0, 1.0};
         double dC_dot;
@@ -973,52 +975,35 @@ namespace great
         }
     }
 
-    bool t_gambiguity::_getSingleUpd(string mode, t_gtime t, string sat, double& value, double& sigma)
+    bool t_gambiguity::_getSingleUpd(const UPDTYPE& upd_type, const t_gtime& t, const string& sat, double& value, double& sigma)
     {
-        UPDTYPE upd_type = str2updmode(trim(mode));
-        one_epoch_upd epoch_upd = _gupd->get_epo_upd(upd_type, t);
+        int epo = _gupd->epo_index(upd_type, t, &_upd_cursor[static_cast<int>(upd_type)]);
+        const t_updrec* upd = _gupd->sat_upd(upd_type, epo, _gupd->sat_index(sat));
         value = 0.0;
-        if (epoch_upd.find(sat) == epoch_upd.end())
+        if (upd == nullptr)
         {
             return false;
         }
-        if (mode == "EWL" || mode == "EWL24" || mode == "EWL25")
-        {
-            if (epoch_upd[sat]->sigma > 0.2 || epoch_upd[sat]->npoint <= 2)
-            {
-                return false;
-            }
-            value = epoch_upd[sat]->value;
-        }
-        else if (mode == "EWL_epoch")
-        {
-            // one_epoch_upd_epoch epoch_upd_epoch = _gupd_epoch->get_epo_upd_epoch(t);
-            if (epoch_upd[sat]->sigma > 0.2 || epoch_upd[sat]->npoint <= 2)
-            {
-                return false;
-            }
-            value = epoch_upd[sat]->value;
-        }
-        else if (mode == "WL")
+        if (upd_type == UPDTYPE::EWL || upd_type == UPDTYPE::EWL24 || upd_type == UPDTYPE::EWL25 || upd_type == UPDTYPE::WL)
         {
-            if (epoch_upd[sat]->sigma > 0.2 || epoch_upd[sat]->npoint <= 2)
+            if (upd->sigma > 0.2 || upd->npoint <= 2)
             {
                 return false;
             }
-            value = epoch_upd[sat]->value;
+            value = upd->value;
         }
-        else if (mode == "NL")
+        else if (upd_type == UPDTYPE::NL)
         {
-            if (epoch_upd[sat]->sigma > 0.1 || epoch_upd[sat]->npoint <= 3)
+            if (upd->sigma > 0.1 || upd->npoint <= 3)
             {
                 return false;
             }
-            value = epoch_upd[sat]->value;
-            sigma += pow(epoch_upd[sat]->sigma, 2);
+            value = upd->value;
+            sigma += pow(upd->sigma, 2);
         }
         else
         {
-            GREAT_DEBUG("Warning[t_gambiguity::_applySingleUpd] : Undefined UPD Mode (WL/NL) : " + mode);
+            GREAT_DEBUG("Warning[t_gambiguity::_applySingleUpd] : Undefined UPD Mode (WL/NL) : " + updmode2str(upd_type));
             return false;
         }
         return true;
@@ -1055,8 +1040,8 @@ namespace great
                 // get Extrawidelane UPD
                 if (_frequency >= 3 && _obstype == OBSCOMBIN::RAW_ALL)
                 {
-                    if ((!_getSingleUpd("EWL", _ewl_Upd_time, sat1, upd_ewl1, sig) ||
-                         !_getSingleUpd("EWL", _ewl_Upd_time, sat2, upd_ewl2, sig)))
+                    if ((!_getSingleUpd(UPDTYPE::EWL, _ewl_Upd_time, sat1, upd_ewl1, sig) ||
+                         !_getSingleUpd(UPDTYPE::EWL, _ewl_Upd_time, sat2, upd_ewl2, sig)))
                     {
                         if (itdd->ambtype == "AMB_L3")
                         {
@@ -1073,8 +1058,8 @@ namespace great
                 // get Extrawidelane-24 UPD
                 if (_frequency >= 4 && _obstype == OBSCOMBIN::RAW_ALL)
                 {
-                    if ((!_getSingleUpd("EWL24", _ewl24_Upd_time, sat1, upd_ewl24_1, sig) ||
-                         !_getSingleUpd("EWL24", _ewl24_Upd_time, sat2, upd_ewl24_2, sig)))
+                    if ((!_getSingleUpd(UPDTYPE::EWL24, _ewl24_Upd_time, sat1, upd_ewl24_1, sig) ||
+                         !_getSingleUpd(UPDTYPE::EWL24, _ewl24_Upd_time, sat2, upd_ewl24_2, sig)))
                     {
                         if (itdd->ambtype == "AMB_L4")
                         {
@@ -1091,8 +1076,8 @@ namespace great
                 // get Extrawidelane-25 UPD
                 if (_frequency == 5 && _obstype == OBSCOMBIN::RAW_ALL)
                 {
-                    if ((!_getSingleUpd("EWL25", _ewl25_Upd_time, sat1, upd_ewl25_1, sig) ||
-                         !_getSingleUpd("EWL25", _ewl25_Upd_time, sat2, upd_ewl25_2, sig)))
+                    if ((!_getSingleUpd(UPDTYPE::EWL25, _ewl25_Upd_time, sat1, upd_ewl25_1, sig) ||
+                         !_getSingleUpd(UPDTYPE::EWL25, _ewl25_Upd_time, sat2, upd_ewl25_2, sig)))
                     {
                         if (itdd->ambtype == "AMB_L5")
                         {
@@ -1109,7 +1094,7 @@ namespace great
                 // get Widelane UPD
                 if (_upd_mode == UPD_MODE::UPD)
                 {
-                    if (!_getSingleUpd("WL", _wl_Upd_time, sat1, upd_wl1, sig) || !_getSingleUpd("WL", _wl_Upd_time, sat2, upd_wl2, sig))
+                    if (!_getSingleUpd(UPDTYPE::WL, _wl_Upd_time, sat1, upd_wl1, sig) || !_getSingleUpd(UPDTYPE::WL, _wl_Upd_time, sat2, upd_wl2, sig))
                     {
                         GREAT_DEBUG("Warning[t_gambiguity::_applyUpd] : _getSingleUpd Wrong : WL, Sat: " + sat1 + " " + sat2);
                         itdd = _DD.erase(itdd);
@@ -1119,7 +1104,7 @@ namespace great
                 // get Narrowlane UPD
                 if (_upd_mode == UPD_MODE::UPD)
                 {
-                    if (!_getSingleUpd("NL", t, sat1, upd_nl1, sig) || !_getSingleUpd("NL", t, sat2, upd_nl2, sig))
+                    if (!_getSingleUpd(UPDTYPE::NL, t, sat1, upd_nl1, sig) || !_getSingleUpd(UPDTYPE::NL, t, sat2, upd_nl2, sig))
                     {
                         GREAT_DEBUG("Warning[t_gambiguity::_applyUpd] : _getSingleUpd Wrong : NL, Sat: " + sat1 + " " + sat2);
                         itdd = _DD.erase(itdd);
@@ -1281,8 +1266,8 @@ namespace great
                 // get Extrawidelane UPD
                 if (_frequency >= 3 && mode == "EWL")
                 {
-                    if ((!_getSingleUpd("EWL", _ewl_Upd_time, sat1, upd_ewl1, sig)) ||
-                        (!_getSingleUpd("EWL", _ewl_Upd_time, sat2, upd_ewl2, sig) && mode == "EWL"))
+                    if ((!_getSingleUpd(UPDTYPE::EWL, _ewl_Upd_time, sat1, upd_ewl1, sig)) ||
+                        (!_getSingleUpd(UPDTYPE::EWL, _ewl_Upd_time, sat2, upd_ewl2, sig) && mode == "EWL"))
                     {
                         GREAT_DEBUG("Warning[t_gambiguity::_applyUpd] : _getSingleUpd Wrong : EWL, Sat: " + sat1 + " " + sat2);
                         itdd = _DD.erase(itdd);
@@ -1291,8 +1276,8 @@ namespace great
                 }
                 else if (_frequency >= 4 && mode == "EWL24")
                 {
-                    if (!_getSingleUpd("EWL24", _ewl24_Upd_time, sat1, upd_ewl1, sig) ||
-                        (!_getSingleUpd("EWL24", _ewl24_Upd_time, sat2, upd_ewl2, sig) && mode == "EWL24"))
+                    if (!_getSingleUpd(UPDTYPE::EWL24, _ewl24_Upd_time, sat1, upd_ewl1, sig) ||
+                        (!_getSingleUpd(UPDTYPE::EWL24, _ewl24_Upd_time, sat2, upd_ewl2, sig) && mode == "EWL24"))
                     {
                         GREAT_DEBUG("Warning[t_gambiguity::_applyUpd] : _getSingleUpd Wrong : EWL24, Sat: " + sat1 + " " + sat2);
                         itdd = _DD.erase(itdd);
@@ -1301,8 +1286,8 @@ namespace great
                 }
                 else if (_frequency == 5 && mode == "EWL25")
                 {
-                    if (!_getSingleUpd("EWL25", _ewl25_Upd_time, sat1, upd_ewl1, sig) ||
-                        (!_getSingleUpd("EWL25", _ewl25_Upd_time, sat2, upd_ewl2, sig) && mode == "EWL25"))
+                    if (!_getSingleUpd(UPDTYPE::EWL25, _ewl25_Upd_time, sat1, upd_ewl1, sig) ||
+                        (!_getSingleUpd(UPDTYPE::EWL25, _ewl25_Upd_time, sat2, upd_ewl2, sig) && mode == "EWL25"))
                     {
                         GREAT_DEBUG("Warning[t_gambiguity::_applyUpd] : _getSingleUpd Wrong : EWL25, Sat: " + sat1 + " " + sat2);
                         itdd = _DD.erase(itdd);
@@ -1310,7 +1295,7 @@ namespace great
                     }
                 }
                 // get Widelane UPD
-                if (!_getSingleUpd("WL", _wl_Upd_time, sat1, upd_wl1, sig) || !_getSingleUpd("WL", _wl_Upd_time, sat2, upd_wl2, sig))
+                if (!_getSingleUpd(UPDTYPE::WL, _wl_Upd_time, sat1, upd_wl1, sig) || !_getSingleUpd(UPDTYPE::WL, _wl_Upd_time, sat2, upd_wl2, sig))
                 {
                     GREAT_DEBUG("Warning[t_gambiguity::_applyUpd] : _getSingleUpd Wrong : WL, Sat: " + sat1 + " " + sat2);
                     itdd = _DD.erase(itdd);
@@ -1885,16 +1870,19 @@ namespace great
 
     double t_gambiguity::_lambdaSearch(const Matrix& anor, const vector<double>& fltpar, vector<int>& ibias, double* boot)
     {
-        const int maxcan = 2;
+        const int maxcan = _lambda_cands;
         int namb = fltpar.size();
         int ncan = 0, ipos = 0;
         double ratio = 0.0;
         int i, j;
-        double disall[maxcan] = {0};
-        double* fbias = new double[namb]{0};
-        double* Q = new double[namb * namb]{0};
-        double* cands = new double[namb * maxcan]{0};
-        t_glambda* lambda = new t_glambda();
+        _lambda_Q.resize(namb * namb);
+        _lambda_a.resize(namb);
+        _lambda_cand.assign(namb * maxcan, 0.0);
+        _lambda_disall.assign(maxcan, 0.0);
+        double* disall = _lambda_disall.data();
+        double* fbias = _lambda_a.data();
+        double* Q = _lambda_Q.data();
+        double* cands = _lambda_cand.data();
 
         try
         {
@@ -1915,11 +1903,7 @@ namespace great
                 }
             }
 
-            for (i = 0; i < maxcan; i++)
-            {
-                disall[i] = 0.0;
-            }
-            lambda->LAMBDA4(maxcan, namb, Q, fbias, &ncan, &ipos, cands, disall, boot);
+            _lambda.LAMBDA4(maxcan, namb, Q, fbias, &ncan, &ipos, cands, disall, boot);
 
             if (double_eq(disall[1], 0.0))
             {
@@ -1930,13 +1914,13 @@ namespace great
                 ratio = disall[1] / disall[0];
             }
 
-            if (!double_eq(ratio, 0.0) && _part_fix && lambda->pDia != NULL)
+            if (!double_eq(ratio, 0.0) && _part_fix && _lambda.pDia != NULL)
             {
                 _mDia.ReSize(namb);
                 _mDia = 0;
                 for (i = 0; i < namb; i++)
                 {
-                    _mDia(i + 1) = lambda->pDia[i];
+                    _mDia(i + 1) = _lambda.pDia[i];
                 }
             }
 
@@ -1951,40 +1935,11 @@ namespace great
                     ibias[i] += round(cands[i * maxcan + 0]);
                 }
             }
-            delete[] fbias;
-            fbias = NULL;
-            delete[] Q;
-            Q = NULL;
-            delete[] cands;
-            cands = NULL;
-            delete lambda;
-            lambda = NULL;
 
             return ratio;
         }
         catch (...)
         {
-            if (fbias != NULL)
-            {
-                delete[] fbias;
-                fbias = NULL;
-            }
-            if (Q != NULL)
-            {
-                delete[] Q;
-                Q = NULL;
-            }
-            if (cands != NULL)
-            {
-                delete[] cands;
-                cands = NULL;
-            }
-            if (lambda != NULL)
-            {
-                delete lambda;
-                lambda = NULL;
-            }
-
             ibias.clear();
             return 0.0;
         }
@@ -2590,7 +2545,7 @@ namespace great
             if (mapSat.find(sat1) == mapSat.end())
             {
                 mapSat.insert(sat1);
-                if (_getSingleUpd("WL", _wl_Upd_time, sat1, upd, sig))
+                if (_getSingleUpd(UPDTYPE::WL, _wl_Upd_time, sat1, upd, sig))
                 {
                     wl_sig.push_back(make_pair(_MW[sat1][2] - upd, 1.0));
                     npnt++;
@@ -2599,7 +2554,7 @@ namespace great
             if (mapSat.find(sat2) == mapSat.end())
             {
                 mapSat.insert(sat2);
-                if (_getSingleUpd("WL", _wl_Upd_time, sat2, upd, sig))
+                if (_getSingleUpd(UPDTYPE::WL, _wl_Upd_time, sat2, upd, sig))
                 {
                     wl_sig.push_back(make_pair(_MW[sat2][2] - upd, 1.0));
                     npnt++;
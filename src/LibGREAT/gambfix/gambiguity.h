@@ -320,6 +320,13 @@ namespace great
 
         ColumnVector _mDia;
 
+        t_glambda _lambda;             ///< lambda search (work arrays reused)
+        int _lambda_cands = 2;         ///< number of lambda candidates
+        vector<double> _lambda_Q;      ///< lambda input covariance
+        vector<double> _lambda_a;      ///< lambda input float ambiguities
+        vector<double> _lambda_cand;   ///< lambda candidates
+        vector<double> _lambda_disall; ///< lambda squared norms
+
         double _outRatio;             ///< outRatio
         t_giof* _ratiofile = nullptr; ///< ratio file
         t_giof* _bootfile = nullptr;  ///< BootStrapping file
@@ -346,14 +353,15 @@ namespace great
         int _ctrl_last_fixepo_gap = 999999;                      ///< ctrl last fixepoch gap
         int _ctrl_min_fixed_num = 0;                             ///< ctrl min fixed number
         int _full_fix_num;                                       ///< full fix number
+        vector<int> _upd_cursor = vector<int>(static_cast<int>(UPDTYPE::NONE) + 1, -1); ///< last upd epoch index by type
 
     protected:
         /**
          * @brief get UPD correction for sat
-         * @param[in] mode - UPD mode[optional choose: NL WL]
+         * @param[in] upd_type - UPD type[optional choose: EWL EWL24 EWL25 WL NL]
          * @return     true - compute successfully , false - failure
          */
-        bool _getSingleUpd(string mode, t_gtime t, string sat, double& value, double& sigma);
+        bool _getSingleUpd(const UPDTYPE& upd_type, const t_gtime& t, const string& sat, double& value, double& sigma);
 
         /**
          * @brief apply UPD correction for sat
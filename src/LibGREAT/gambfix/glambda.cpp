@@ -13,6 +13,7 @@
 #include <string>
 #include <string.h>
 #include <stdio.h>
+#include <algorithm>
 using namespace std;
 
 namespace great
@@ -40,18 +41,22 @@ namespace great
         int i, j, k, iMu;
         for (i = iLast; i >= iFirst; i--)
         {
+            double* pdLi = pdL + _col(iN, i);
+            double* pdZi = pdZti + (i - 1) * iN;
             for (j = i + 1; j <= iN; j++)
             {
-                iMu = round(pdL[(j - 1) * iN + i - 1]);
+                iMu = round(pdLi[j]);
                 if (iMu != 0)
                 {
+                    const double* pdLj = pdL + _col(iN, j);
                     for (k = j; k <= iN; k++)
                     {
-                        pdL[(k - 1) * iN + i - 1] -= iMu * pdL[(k - 1) * iN + j - 1];
+                        pdLi[k] -= iMu * pdLj[k];
                     }
-                    for (k = 1; k <= iN; k++)
+                    double* pdZj = pdZti + (j - 1) * iN;
+                    for (k = 0; k < iN; k++)
                     {
-                        pdZti[(k - 1) * iN + j - 1] += iMu * pdZti[(k - 1) * iN + i - 1];
+                        pdZj[k] += iMu * pdZi[k];
                     }
                     pdA[i - 1] -= iMu * pdA[j - 1];
                 }
@@ -148,42 +153,50 @@ namespace great
 
         for (j = iN; j >= 1; j--)
         {
+            double* pdLj = pdL + _col(iN, j);
             for (i = iN; i >= j + 1; i--)
             {
+                const double* pdLi = pdL + _col(iN, i);
                 dSum = 0.0;
                 for (k = i + 1; k <= iN; k++)
                 {
-                    dSum += pdL[(k - 1) * iN + j - 1] * pdL[(k - 1) * iN + i - 1];
+                    dSum += pdLj[k] * pdLi[k];
                 }
-                pdL[(i - 1) * iN + j - 1] = (pdL[(i - 1) * iN + j - 1] - dSum) / pdL[(i - 1) * iN + i - 1];
+                pdLj[i] = (pdLj[i] - dSum) / pdLi[i];
             }
             dSum = 0.0;
 
             for (k = j + 1; k <= iN; k++)
             {
-                dSum += pdL[(k - 1) * iN + j - 1] * pdL[(k - 1) * iN + j - 1];
+                dSum += pdLj[k] * pdLj[k];
             }
-            dT = pdL[(j - 1) * iN + j - 1] - dSum;
-            if (dT <= pdL[(j - 1) * iN + j - 1] * dEps)
+            dT = pdLj[j] - dSum;
+            if (dT <= pdLj[j] * dEps)
             {
                 return -1;
             }
-            dGooge = dT / pdL[(j - 1) * iN + j - 1];
+            dGooge = dT / pdLj[j];
             if (dGooge < dGomi)
             {
                 dGomi = dGooge;
             }
-            pdL[(j - 1) * iN + j - 1] = sqrt(dT);
+            pdLj[j] = sqrt(dT);
         }
 
+        // scale the columns by the diagonal of their rows
         for (i = 1; i <= iN; i++)
         {
-            for (j = 1; j <= i - 1; j++)
+            pdD[i - 1] = pdL[_col(iN, i) + i];
+        }
+        for (j = 1; j <= iN; j++)
+        {
+            double* pdLj = pdL + _col(iN, j);
+            for (i = j + 1; i <= iN; i++)
             {
-                pdL[(i - 1) * iN + j - 1] /= pdL[(i - 1) * iN + i - 1];
+                pdLj[i] /= pdD[i - 1];
             }
-            pdD[i - 1] = pdL[(i - 1) * iN + i - 1] * pdL[(i - 1) * iN + i - 1];
-            pdL[(i - 1) * iN + i - 1] = 1e0;
+            pdD[j - 1] *= pdD[j - 1];
+            pdLj[j] = 1e0;
         }
 
         return 0;
@@ -197,21 +210,22 @@ namespace great
         {
             for (j = 1; j <= i - 1; j++)
             {
-                pdVec[j - 1] = pdL[(i - 1) * iN + j - 1];
+                pdVec[j - 1] = pdL[_col(iN, j) + i];
             }
 
             for (j = 1; j <= i - 1; j++)
             {
+                const double* pdLmj = pdLm + _col(iN, j);
                 dAiude = 0.0;
 
                 for (k = j; k <= i - 1; k++)
                 {
-                    dAiude += pdLm[(k - 1) * iN + j - 1] * pdVec[k - 1];
+                    dAiude += pdLmj[k] * pdVec[k - 1];
                 }
-                pdLm[(i - 1) * iN + j - 1] = -dAiude / pdL[(i - 1) * iN + i - 1];
+                pdLm[_col(iN, j) + i] = -dAiude / pdL[_col(iN, i) + i];
             }
 
-            pdLm[(i - 1) * iN + i - 1] = 1e0 / pdL[(i - 1) * iN + i - 1];
+            pdLm[_col(iN, i) + i] = 1e0 / pdL[_col(iN, i) + i];
         }
         return;
     }
@@ -221,7 +235,7 @@ namespace great
         double dt_glambda[3];
         bool isSwap;
         int i1, i, j;
-        double dDelta, dEta, dHelp;
+        double dDelta, dEta;
         i1 = iN - 1;
         isSwap = true;
 
@@ -242,38 +256,29 @@ namespace great
                             ZTRANi(i, i, iN, pdL, pdA, pdZti);
                         }
 
-                        dDelta = pdD[i - 1] + pow(pdL[i * iN + i - 1], 2) * pdD[i];
+                        double* pdLi = pdL + _col(iN, i);
+                        double* pdLi1 = pdL + _col(iN, i + 1);
+                        dDelta = pdD[i - 1] + pow(pdLi[i + 1], 2) * pdD[i];
                         if (dDelta < pdD[i])
                         {
-                            dt_glambda[2] = pdD[i] * pdL[i * iN + i - 1] / dDelta;
+                            dt_glambda[2] = pdD[i] * pdLi[i + 1] / dDelta;
                             dEta = pdD[i - 1] / dDelta;
                             pdD[i - 1] = dEta * pdD[i];
                             pdD[i] = dDelta;
                             for (j = 1; j <= i - 1; j++)
                             {
-                                dt_glambda[0] = pdL[(i - 1) * iN + j - 1];
-                                dt_glambda[1] = pdL[i * iN + j - 1];
-                                pdL[(i - 1) * iN + j - 1] = dt_glambda[1] - pdL[i * iN + i - 1] * dt_glambda[0];
-                                pdL[i * iN + j - 1] = dt_glambda[2] * dt_glambda[1] + dEta * dt_glambda[0];
+                                double* pdLj = pdL + _col(iN, j);
+                                dt_glambda[0] = pdLj[i];
+                                dt_glambda[1] = pdLj[i + 1];
+                                pdLj[i] = dt_glambda[1] - pdLi[i + 1] * dt_glambda[0];
+                                pdLj[i + 1] = dt_glambda[2] * dt_glambda[1] + dEta * dt_glambda[0];
                             }
 
-                            pdL[i * iN + i - 1] = dt_glambda[2];
+                            pdLi[i + 1] = dt_glambda[2];
 
-                            for (j = i + 2; j <= iN; j++)
-                            {
-                                dHelp = pdL[(j - 1) * iN + i - 1];
-                                pdL[(j - 1) * iN + i - 1] = pdL[(j - 1) * iN + i];
-                                pdL[(j - 1) * iN + i] = dHelp;
-                            }
-                            for (j = 1; j <= iN; j++)
-                            {
-                                dHelp = pdZti[(j - 1) * iN + i - 1];
-                                pdZti[(j - 1) * iN + i - 1] = pdZti[(j - 1) * iN + i];
-                                pdZti[(j - 1) * iN + i] = dHelp;
-                            }
-                            dHelp = pdA[i - 1];
-                            pdA[i - 1] = pdA[i];
-                            pdA[i] = dHelp;
+                            swap_ranges(pdLi + i + 2, pdLi + iN + 1, pdLi1 + i + 2);
+                            swap_ranges(pdZti + (i - 1) * iN, pdZti + i * iN, pdZti + i * iN);
+                            swap(pdA[i - 1], pdA[i]);
                             i1 = i;
                             isSwap = true;
                         }
@@ -305,10 +310,11 @@ namespace great
 
         for (i = 1; i <= iN; i++)
         {
+            const double* pdLi = pdL + _col(iN, i);
             pdE[i - 1] = 0e0;
             for (j = i; j <= iN; j++)
             {
-                pdE[i - 1] += pdL[(j - 1) * iN + i - 1] * pdDist[j - 1];
+                pdE[i - 1] += pdLi[j] * pdDist[j - 1];
             }
         }
 
@@ -328,7 +334,8 @@ namespace great
                 pdT[i - 1] = dT_0;
                 for (j = 1; j <= i; j++)
                 {
-                    pdT[i - 1] = pdT[i - 1] + pdD[j - 1] * pdL[(i - 1) * iN + j - 1] * (2 * pdE[j - 1] + pdL[(i - 1) * iN + j - 1]);
+                    double dLij = pdL[_col(iN, j) + i];
+                    pdT[i - 1] = pdT[i - 1] + pdD[j - 1] * dLij * (2 * pdE[j - 1] + dLij);
                 }
             }
             else
@@ -336,7 +343,8 @@ namespace great
                 pdT[i - 1] = dT_0;
                 for (j = 1; j <= i; j++)
                 {
-                    pdT[i - 1] = pdT[i - 1] - pdD[j - 1] * pdL[(i - 1) * iN + j - 1] * (2 * pdE[j - 1] - pdL[(i - 1) * iN + j - 1]);
+                    double dLij = pdL[_col(iN, j) + i];
+                    pdT[i - 1] = pdT[i - 1] - pdD[j - 1] * dLij * (2 * pdE[j - 1] - dLij);
                 }
             }
 
@@ -356,12 +364,13 @@ namespace great
 
     double t_glambda::DINKi(int iN, double* pdL, double* pdA, int iCol)
     {
+        const double* pdLc = pdL + _col(iN, iCol);
         double dDINKi;
         int i;
         dDINKi = 0.0;
         for (i = iCol + 1; i <= iN; i++)
         {
-            dDINKi += pdL[(i - 1) * iN + iCol - 1] * pdA[i - 1];
+            dDINKi += pdLc[i] * pdA[i - 1];
         }
         return dDINKi;
     }
@@ -433,7 +442,7 @@ namespace great
             }
             if (iold <= i)
             {
-                pdLef[i - 1] += pdL[i * iN + i - 1];
+                pdLef[i - 1] += pdL[_col(iN, i) + i + 1];
             }
             else
             {
@@ -501,6 +510,142 @@ namespace great
         return;
     }
 
+    void t_glambda::SHRINKs(int iMaxCan,
+                            int iN,
+                            double* pdA,
+                            double* pdD,
+                            double* pdL,
+                            double* pdDist,
+                            double* pdZb,
+                            double* pdZ,
+                            double* pdStep,
+                            int* piNcan,
+                            double* pdDisall,
+                            double* pdCands,
+                            int* piPos)
+    {
+        if (iMaxCan < 1)
+        {
+            throw("ERROR in SHRINKs: number of requested candidates < 1");
+        }
+        else if (iN < 2)
+        {
+            throw("ERROR in SHRINKs: dimension of system < 2");
+        }
+
+        int i, j, k, iMax = 0;
+        double dNewdist, dY, dSum;
+        double dMaxdist = 1e99;
+
+        // start at the last (best determined) ambiguity, zig-zag around the conditional estimate
+        *piNcan = 0;
+        k = iN;
+        pdDist[k - 1] = 0.0;
+        pdZb[k - 1] = pdA[k - 1];
+        pdZ[k - 1] = round(pdZb[k - 1]);
+        dY = pdZb[k - 1] - pdZ[k - 1];
+        pdStep[k - 1] = dY <= 0.0 ? -1.0 : 1.0;
+
+        int iLoop;
+        for (iLoop = 0; iLoop < 100000; iLoop++)
+        {
+            dNewdist = pdDist[k - 1] + dY * dY / pdD[k - 1];
+            if (dNewdist < dMaxdist)
+            {
+                if (k != 1)
+                {
+                    // down one level, conditional estimate from the levels fixed above
+                    k--;
+                    pdDist[k - 1] = dNewdist;
+                    const double* pdLk = pdL + _col(iN, k);
+                    dSum = 0.0;
+                    for (j = k + 1; j <= iN; j++)
+                    {
+                        dSum += pdLk[j] * (pdZ[j - 1] - pdZb[j - 1]);
+                    }
+                    pdZb[k - 1] = pdA[k - 1] + dSum;
+                    pdZ[k - 1] = round(pdZb[k - 1]);
+                    dY = pdZb[k - 1] - pdZ[k - 1];
+                    pdStep[k - 1] = dY <= 0.0 ? -1.0 : 1.0;
+                }
+                else
+                {
+                    // candidate found, replace the worst one and shrink the ellipsoid when full
+                    if (*piNcan < iMaxCan)
+                    {
+                        iMax = (*piNcan)++;
+                    }
+                    for (i = 0; i < iN; i++)
+                    {
+                        pdCands[i * iMaxCan + iMax] = pdZ[i];
+                    }
+                    pdDisall[iMax] = dNewdist;
+                    if (*piNcan == iMaxCan)
+                    {
+                        for (i = 0, iMax = 0; i < iMaxCan; i++)
+                        {
+                            if (pdDisall[i] > pdDisall[iMax])
+                            {
+                                iMax = i;
+                            }
+                        }
+                        dMaxdist = pdDisall[iMax];
+                    }
+                    pdZ[0] += pdStep[0];
+                    dY = pdZb[0] - pdZ[0];
+                    pdStep[0] = -pdStep[0] - (pdStep[0] <= 0.0 ? -1.0 : 1.0);
+                }
+            }
+            else
+            {
+                if (k == iN)
+                {
+                    break;
+                }
+                k++;
+                pdZ[k - 1] += pdStep[k - 1];
+                dY = pdZb[k - 1] - pdZ[k - 1];
+                pdStep[k - 1] = -pdStep[k - 1] - (pdStep[k - 1] <= 0.0 ? -1.0 : 1.0);
+            }
+        }
+        if (iLoop >= 100000)
+        {
+            // reported as the candidate overflow of FI71
+            *piNcan = 10000;
+            return;
+        }
+
+        *piPos = 1;
+        for (i = 1; i < *piNcan; i++)
+        {
+            if (pdDisall[i] < pdDisall[*piPos - 1])
+            {
+                *piPos = i + 1;
+            }
+        }
+        return;
+    }
+
+    void t_glambda::_workspace(int iN)
+    {
+        if (iN > _nmax)
+        {
+            _nmax = iN;
+            _L.resize(iN * (iN + 1) / 2);
+            _D.resize(iN);
+            _Zt.resize(iN * iN);
+            _V1.resize(iN);
+            _V2.resize(iN + 1);
+            _V3.resize(iN + 1);
+            _V4.resize(iN);
+            _V5.resize(iN);
+            _V6.resize(iN);
+            _Ak.resize(iN);
+            _Dia.resize(iN);
+        }
+        pDia = _Dia.data();
+    }
+
     void t_glambda::LAMBDA4(int iMaxCan,
                             int iN,
                             double* pdQ,
@@ -511,33 +656,35 @@ namespace great
                             double* pdDisall,
                             double* boot)
     {
-        double* pdL = new double[iN * iN];
-        double* pdD = new double[iN];
-        double* pdZt = new double[iN * iN];
-        double* pdV1 = new double[iN];
-        double* pdV2 = new double[iN + 1];
-        double* pdV3 = new double[iN + 1];
-        double* pdV4 = new double[iN];
-        double* pdV5 = new double[iN];
-        double* pdV6 = new double[iN];
-        double* pdAk = new double[iN];
-        int i, j, k, iz;
-        double dH;
+        _workspace(iN);
+        double* pdL = _L.data();
+        double* pdD = _D.data();
+        double* pdZt = _Zt.data();
+        double* pdV1 = _V1.data();
+        double* pdV2 = _V2.data();
+        double* pdV3 = _V3.data();
+        double* pdV4 = _V4.data();
+        double* pdV5 = _V5.data();
+        double* pdV6 = _V6.data();
+        double* pdAk = _Ak.data();
+        int i, j, k;
         double dEps;
         double dChi_1;
 
         double dt;
 
-        /* initialize Zt=unit matrix*/
-        iz = 0;
-        for (i = 1; i <= iN; i++)
+        /* initialize Zt=unit matrix, L by the lower triangle of Q*/
+        for (j = 1; j <= iN; j++)
         {
-            for (j = 1; j <= iN; j++)
+            double* pdLj = pdL + _col(iN, j);
+            for (i = j; i <= iN; i++)
             {
-                iz++;
-                pdL[(i - 1) * iN + j - 1] = pdQ[iz - 1];
-                pdZt[(i - 1) * iN + j - 1] = 0.0;
+                pdLj[i] = pdQ[(i - 1) * iN + j - 1];
             }
+        }
+        fill(pdZt, pdZt + iN * iN, 0.0);
+        for (i = 1; i <= iN; i++)
+        {
             pdZt[(i - 1) * iN + i - 1] = 1e0;
         }
 
@@ -564,27 +711,6 @@ namespace great
 
         if (t_glambda::FMFAC6(pdL, pdD, iN, dEps) < 0)
         {
-            delete[] pdL;
-            pdL = nullptr;
-            delete[] pdD;
-            pdD = nullptr;
-            delete[] pdZt;
-            pdZt = nullptr;
-            delete[] pdV1;
-            pdV1 = nullptr;
-            delete[] pdV2;
-            pdV2 = nullptr;
-            delete[] pdV3;
-            pdV3 = nullptr;
-            delete[] pdV4;
-            pdV4 = nullptr;
-            delete[] pdV5;
-            pdV5 = nullptr;
-            delete[] pdV6;
-            pdV6 = nullptr;
-            delete[] pdAk;
-            pdAk = nullptr;
-
             throw("ERROR in FMFAC6: LD failed");
         }
 
@@ -597,67 +723,52 @@ namespace great
         {
             dt = sqrt(pdD[i]);
             *boot *= pBootStrapping(dt);
+            pDia[i] = pdD[i];
         }
 
-        /*For the search we need L and D of Q^{ -1 }, see section 4.1, or
-        L^{ -1 } and D^{ -1 } of Q here(in our case we use of course
-        the t_glambda - transformed L and D as they came from SRC1)*/
-        t_glambda::INVLT2d(iN, pdL, pdL, pdV1);
-
-        if (pDia == NULL)
+        if (_search == LAMBDA_SEARCH::SHRINK)
         {
-            pDia = new double[iN];
+            /*search directly with L and D of Q, the ellipsoid shrinks with the candidates found*/
+            t_glambda::SHRINKs(iMaxCan, iN, pdA, pdD, pdL, pdV2, pdV3, pdV4, pdV5, piNcan, pdDisall, pdCands, piPos);
         }
-        //... and D_1
-        for (i = 1; i <= iN; i++)
+        else
         {
-            pDia[i - 1] = pdD[i - 1];
-            pdD[i - 1] = 1e0 / pdD[i - 1];
-        }
+            /*For the search we need L and D of Q^{ -1 }, see section 4.1, or
+            L^{ -1 } and D^{ -1 } of Q here(in our case we use of course
+            the t_glambda - transformed L and D as they came from SRC1)*/
+            t_glambda::INVLT2d(iN, pdL, pdL, pdV1);
 
-        /*find a suitable Chi ^ 2 such that we have two candidates at minimum
-        use an eps to make sure the two candidates are inside the ellipsoid*/
-        dEps = 1e-6;
-        t_glambda::CHIstrt4(iN, pdD, pdL, pdV1, pdV2, pdA, pdV3, pdV4);
-        dChi_1 = pdV3[1] + dEps;
+            //... and D_1
+            for (i = 1; i <= iN; i++)
+            {
+                pdD[i - 1] = 1e0 / pdD[i - 1];
+            }
 
-        /*find the two candidates with minimum norm*/
-        t_glambda::FI71(dChi_1, iMaxCan, iN, pdA, pdD, pdL, pdV1, pdV2, pdV3, pdV4, pdV5, pdV6, piNcan, pdDisall, pdCands, piPos);
+            /*find a suitable Chi ^ 2 such that we have two candidates at minimum
+            use an eps to make sure the two candidates are inside the ellipsoid*/
+            dEps = 1e-6;
+            t_glambda::CHIstrt4(iN, pdD, pdL, pdV1, pdV2, pdA, pdV3, pdV4);
+            dChi_1 = pdV3[1] + dEps;
+
+            /*find the two candidates with minimum norm*/
+            t_glambda::FI71(dChi_1, iMaxCan, iN, pdA, pdD, pdL, pdV1, pdV2, pdV3, pdV4, pdV5, pdV6, piNcan, pdDisall, pdCands, piPos);
+        }
 
         if (*piNcan >= 10000)
         {
-            delete[] pdL;
-            pdL = nullptr;
-            delete[] pdD;
-            pdD = nullptr;
-            delete[] pdZt;
-            pdZt = nullptr;
-            delete[] pdV1;
-            pdV1 = nullptr;
-            delete[] pdV2;
-            pdV2 = nullptr;
-            delete[] pdV3;
-            pdV3 = nullptr;
-            delete[] pdV4;
-            pdV4 = nullptr;
-            delete[] pdV5;
-            pdV5 = nullptr;
-            delete[] pdV6;
-            pdV6 = nullptr;
-            delete[] pdAk;
-            pdAk = nullptr;
-
             throw("ERROR in FMFAC6: D failed");
         }
         /*compute a = Z^-*z*/
         for (k = 1; k <= iMaxCan; k++)
         {
-            for (i = 1; i <= iN; i++)
+            fill(pdV1, pdV1 + iN, 0.0);
+            for (j = 1; j <= iN; j++)
             {
-                pdV1[i - 1] = 0.0;
-                for (j = 1; j <= iN; j++)
+                const double* pdZtj = pdZt + (j - 1) * iN;
+                double dCand = pdCands[(j - 1) * iMaxCan + k - 1];
+                for (i = 0; i < iN; i++)
                 {
-                    pdV1[i - 1] += pdZt[(i - 1) * iN + j - 1] * pdCands[(j - 1) * iMaxCan + k - 1];
+                    pdV1[i] += pdZtj[i] * dCand;
                 }
             }
             for (j = 1; j <= iN; j++)
@@ -672,41 +783,23 @@ namespace great
             pdA[i - 1] = pdCands[(i - 1) * iMaxCan + *piPos - 1] + pdAk[i - 1];
         }
 
-        /*'sort' the vector of squared norms in increasing order
-        (if ipos equals 2, the best candidate is in the second place : so reverse disall)*/
-        if (*piPos == 2)
+        /*sort the vector of squared norms in increasing order
+        (FI71 keeps the candidates in the order found)*/
+        int iNsort = (*piNcan) < iMaxCan ? (*piNcan) : iMaxCan;
+        for (k = 0; k < iNsort; k++)
         {
-            dH = pdDisall[0];
-            pdDisall[0] = pdDisall[1];
-            pdDisall[1] = dH;
-
-            for (i = 1; i <= iN; i++)
+            for (j = k + 1; j < iNsort; j++)
             {
-                dH = pdCands[(i - 1) * iMaxCan];
-                pdCands[(i - 1) * iMaxCan] = pdCands[(i - 1) * iMaxCan + 1];
-                pdCands[(i - 1) * iMaxCan + 1] = dH;
-            }
-        }
-        delete[] pdL;
-        pdL = nullptr;
-        delete[] pdD;
-        pdD = nullptr;
-        delete[] pdZt;
-        pdZt = nullptr;
-        delete[] pdV1;
-        pdV1 = nullptr;
-        delete[] pdV2;
-        pdV2 = nullptr;
-        delete[] pdV3;
-        pdV3 = nullptr;
-        delete[] pdV4;
-        pdV4 = nullptr;
-        delete[] pdV5;
-        pdV5 = nullptr;
-        delete[] pdV6;
-        pdV6 = nullptr;
-        delete[] pdAk;
-        pdAk = nullptr;
+                if (pdDisall[j] < pdDisall[k])
+                {
+                    swap(pdDisall[k], pdDisall[j]);
+                    for (i = 0; i < iN; i++)
+                    {
+                        swap(pdCands[i * iMaxCan + k], pdCands[i * iMaxCan + j]);
+                    }
+                }
+            }
+        }
         return;
     }
 
@@ -11,14 +11,26 @@
 #ifndef GLAMBDA_H
 #define GLAMBDA_H
 
+#include <vector>
 #include "gexport/ExportLibGREAT.h"
 using namespace std;
 
 namespace great
 {
+    /** @brief enum of LAMBDA search strategy. */
+    enum class LAMBDA_SEARCH
+    {
+        FI71,  ///< enumeration in a fixed ellipsoid (chi squared from the rounded candidates).
+        SHRINK ///< depth-first search with the ellipsoid shrinking to the candidates found.
+    };
 
     /**
      *@ brief class for LAMADA search finding fixing ambiguity.
+     *
+     * The work arrays are kept between calls and only grow with the largest dimension,
+     * one object should be reused for the repeated (partial) searches. The lower triangular
+     * L is stored packed by columns (L(i,j) = pdL[_col(iN,j) + i], i >= j, 1-based),
+     * Z (transposed inverse) by columns, so the inner loops run over contiguous memory.
      */
     class LibGREAT_LIBRARY_EXPORT t_glambda
     {
@@ -26,21 +38,40 @@ namespace great
         /** @brief default constructor. */
         t_glambda() {};
 
+        /** @brief copy constructor, the work arrays are not copied. */
+        t_glambda(const t_glambda& other) :
+            _search(other._search)
+        {
+        }
+
+        /** @brief assignment, the work arrays are not copied. */
+        t_glambda& operator=(const t_glambda& other)
+        {
+            _search = other._search;
+            return *this;
+        }
+
         /** @brief default destructor. */
-        virtual ~t_glambda()
+        virtual ~t_glambda() {};
+
+        /** @brief set search strategy. */
+        void search(LAMBDA_SEARCH mode)
+        {
+            _search = mode;
+        }
+
+        /** @brief get search strategy. */
+        LAMBDA_SEARCH search() const
         {
-            if (pDia)
-            {
-                delete[] pDia;
-            }
-        };
+            return _search;
+        }
 
         /**
          * @brief integer estimation with the LAMBDA method
-         * @param[in] iMaxCan
+         * @param[in] iMaxCan   number of candidates
          * @param[in] iN        dimension of matrix
-         * @param[in] pdQ
-         * @param[in] pdA
+         * @param[in] pdQ       covariance matrix (iN x iN, lower triangle by rows is used)
+         * @param[in] pdA       float ambiguities
          * @param[in] piNcan
          * @param[in] piPos
          * @param[in] pdCands   2-dimensional array to store the candidates
@@ -84,7 +115,7 @@ namespace great
          * @param[in] iN          dimension of the system
          * @param[in] pdL      lower triangular matrix L
          * @param[in] pdA      Z (transposed) a, with a the vector of unknowns
-         * @param[in] pdZti      Z (transposed inverse) matrix
+         * @param[in] pdZti      Z (transposed inverse) matrix, stored by columns
          * @param[out] pdL pdA pdZti
          * @return void
          */
@@ -194,9 +225,7 @@ namespace great
          *               matrix(see `The LAMBDA method for integer ambiguity estimation :
          *               implementation aspects', 5.8: The volume of the ellipsoidal region.
          * @param[in] iN      number of ambiguities
-         * @param[in] pdL     lower triangular matrix: Q   = L D L, although L is lower triangular, in this example,
-         *                    program L is stored column-wise in a 2-dimensional array, to avoid the necessity of a
-         * dedicated storage scheme.
+         * @param[in] pdL     lower triangular matrix: Q   = L D L, packed by columns (see _col)
          * @param[in] pdD     diagonal matrix
          * @param[in] pdDist  double precision vector of length n
          * @param[in] pdE     double precision vector of length n
@@ -237,10 +266,7 @@ namespace great
          * @param[in] pdA        the vector with real valued estimates \hat{a} (float solution)
          * @param[in] pdD        | diagonal matrix           -1        *
          * @param[in] pdL        | lower triangular matrix: Q   = L D L
-         *                        | although L is lower triangular, in this example
-         *                        | program L is stored column-wise in a 2-dimensional
-         *                        | array, to avoid the necessity of a dedicated
-         *                        | storage scheme.
+         *                        | packed by columns (see _col)
          * @param[in] pdLef        dp work vector with length = n
          * @param[in] pdLeft     dp work vector with length = n+1
          * @param[in] pdRight    dp work vector with length = n+1
@@ -272,10 +298,61 @@ namespace great
                   double* pdCands,
                   int* piPos);
 
+        /**
+         * @brief finds 'MaxCan' integer vectors closest to 'a' in the metric of Q=transpose(L) D L,
+         *        depth-first (Schnorr-Euchner) with the radius shrinking to the MaxCan-th best candidate.
+         * @param[in] iMaxCan    number of minimum integer vectors requiered
+         * @param[in] iN         dimension of matrix
+         * @param[in] pdA        float solution (decorrelated)
+         * @param[in] pdD        diagonal matrix D of Q (not inverted)
+         * @param[in] pdL        lower triangular matrix L of Q (not inverted)
+         * @param[in] pdDist     dp work vector with length = n + 1
+         * @param[in] pdZb       dp work vector with length = n + 1
+         * @param[in] pdZ        dp work vector with length = n
+         * @param[in] pdStep     dp work vector with length = n
+         * @param[out] piNcan    number of integer vectors found
+         * @param[out] pdDisall  squared norms
+         * @param[out] pdCands   candidates (integer vectors)
+         * @param[out] piPos     column of the best candidate
+         * @return void
+         */
+        void SHRINKs(int iMaxCan,
+                     int iN,
+                     double* pdA,
+                     double* pdD,
+                     double* pdL,
+                     double* pdDist,
+                     double* pdZb,
+                     double* pdZ,
+                     double* pdStep,
+                     int* piNcan,
+                     double* pdDisall,
+                     double* pdCands,
+                     int* piPos);
+
         double pBootStrapping(const double& sig);
 
     public:
-        double* pDia = NULL;
+        double* pDia = NULL; ///< diagonal D of the decorrelated covariance (last call)
+
+    protected:
+        /** @brief offset of column j of the packed L, L(i,j) = pdL[_col(iN,j) + i] (1-based) */
+        static inline int _col(int iN, int j)
+        {
+            return (j - 1) * iN - (j - 1) * (j - 2) / 2 - j;
+        }
+
+        /** @brief grow the work arrays to dimension iN */
+        void _workspace(int iN);
+
+        LAMBDA_SEARCH _search = LAMBDA_SEARCH::SHRINK; ///< search strategy
+        int _nmax = 0;                               ///< dimension of the work arrays
+        vector<double> _L;                           ///< packed L
+        vector<double> _D;                           ///< D
+        vector<double> _Zt;                          ///< Z (transposed inverse)
+        vector<double> _V1, _V2, _V3, _V4, _V5, _V6; ///< work vectors
+        vector<double> _Ak;                          ///< integer shifts of a
+        vector<double> _Dia;                         ///< storage of pDia
     };
 
 } // namespace great
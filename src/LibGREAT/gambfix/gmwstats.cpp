@@ -0,0 +1,128 @@
+/**
+ * @file         gmwstats.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Bounded running statistics of the Melbourne-Wubbena combination
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+#include "gambfix/gmwstats.h"
+#include "gutils/gtypeconv.h"
+#include <cmath>
+
+namespace great
+{
+    t_gmwstats::t_gmwstats(size_t depth) :
+        _depth(depth < 2 ? 2 : depth)
+    {
+    }
+
+    t_gmwstats::~t_gmwstats()
+    {
+    }
+
+    const t_mwstat& t_gmwstats::add(const string& sat, const t_gtime& crt, const t_gtime& pre, double mw, double ele, bool slip)
+    {
+        t_ring& ring = _sats[sat];
+        if (ring.rows.empty())
+        {
+            ring.rows.resize(_depth);
+            ring.last = _depth - 1;
+        }
+
+        // continued arc, copied before its row could be overwritten
+        const t_mwstat* prev = find(sat, pre);
+        bool cont = (prev != nullptr && !double_eq(prev->obs, 0.0) && !slip);
+        t_mwstat pre_stat = cont ? *prev : t_mwstat();
+
+        // the same epoch again replaces its row
+        size_t row = (ring.rows[ring.last].epoch == crt) ? ring.last : (ring.last + 1) % _depth;
+        ring.last = row;
+
+        t_mwstat& stat = ring.rows[row];
+        stat = t_mwstat();
+        stat.epoch = crt;
+        if (double_eq(mw, 0.0))
+        {
+            return stat;
+        }
+
+        stat.obs = mw;
+        stat.ele = ele;
+        if (cont)
+        {
+            stat.num = pre_stat.num + 1;
+            if (!double_eq(stat.num, 1.0) && stat.num > 1.0)
+            {
+                stat.var = pre_stat.var * (stat.num - 2) / (stat.num - 1) + pow(mw - pre_stat.mean, 2) / stat.num;
+            }
+            else
+            {
+                stat.var = pre_stat.var;
+            }
+            stat.mean = pre_stat.mean + (mw - pre_stat.mean) / stat.num;
+        }
+        else
+        {
+            stat.num = 1;
+            stat.var = 0.0;
+            stat.mean = mw;
+        }
+        return stat;
+    }
+
+    const t_mwstat* t_gmwstats::find(const string& sat, const t_gtime& t) const
+    {
+        auto itSAT = _sats.find(sat);
+        if (itSAT == _sats.end())
+        {
+            return nullptr;
+        }
+        for (const auto& row : itSAT->second.rows)
+        {
+            if (row.epoch == t)
+            {
+                return &row;
+            }
+        }
+        return nullptr;
+    }
+
+    map<string, map<int, double>> t_gmwstats::epoch(const t_gtime& t) const
+    {
+        map<string, map<int, double>> mw;
+        for (const auto& itSAT : _sats)
+        {
+            const t_mwstat& row = itSAT.second.rows[itSAT.second.last];
+            if (row.epoch != t)
+            {
+                continue;
+            }
+            map<int, double>& out = mw[itSAT.first];
+            out[1] = row.num;
+            out[2] = row.mean;
+            out[3] = row.var;
+            out[4] = row.obs;
+            out[5] = row.ele;
+        }
+        return mw;
+    }
+
+    size_t t_gmwstats::memory() const
+    {
+        size_t bytes = sizeof(*this);
+        for (const auto& itSAT : _sats)
+        {
+            bytes += sizeof(itSAT) + itSAT.first.capacity() + itSAT.second.rows.capacity() * sizeof(t_mwstat);
+        }
+        return bytes + _sats.bucket_count() * sizeof(void*);
+    }
+
+    void t_gmwstats::clear()
+    {
+        _sats.clear();
+    }
+
+} // namespace great
@@ -0,0 +1,99 @@
+/**
+ * @file         gmwstats.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Bounded running statistics of the Melbourne-Wubbena combination
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+#ifndef GMWSTATS_H
+#define GMWSTATS_H
+
+#include "gexport/ExportLibGREAT.h"
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "gutils/gtime.h"
+
+using namespace std;
+using namespace gnut;
+
+namespace great
+{
+    /**
+     * @brief running MW statistics of one satellite at one epoch
+     */
+    struct LibGREAT_LIBRARY_EXPORT t_mwstat
+    {
+        t_gtime epoch;     ///< epoch
+        double num = 0.0;  ///< number of epochs in the arc  (t_map_MW index 1)
+        double mean = 0.0; ///< mean MW [cycle]              (t_map_MW index 2)
+        double var = 0.0;  ///< variance of MW [cycle^2]     (t_map_MW index 3)
+        double obs = 0.0;  ///< MW of the epoch [cycle]      (t_map_MW index 4)
+        double ele = 0.0;  ///< elevation [deg]              (t_map_MW index 5)
+    };
+
+    /**
+     * @brief MW statistics of the last epochs for all satellites
+     *
+     * Each satellite keeps a small ring of the last depth() epochs, the new epoch
+     * continues the statistics of the previous one, so an update is O(1) and the
+     * memory does not grow with the length of the processing.
+     */
+    class LibGREAT_LIBRARY_EXPORT t_gmwstats
+    {
+    public:
+        /** @brief constructor with the number of epochs kept per satellite (at least 2). */
+        explicit t_gmwstats(size_t depth = 2);
+
+        /** @brief default destructor. */
+        virtual ~t_gmwstats();
+
+        /**
+         * @brief add MW of the satellite
+         * @param[in]  sat       satellite
+         * @param[in]  crt       current epoch
+         * @param[in]  pre       previous epoch (its statistics are continued)
+         * @param[in]  mw        MW observation [cycle], 0 = not available (statistics reset)
+         * @param[in]  ele       elevation [deg]
+         * @param[in]  slip      cycle slip, the statistics start again
+         * @return statistics of the current epoch
+         */
+        const t_mwstat& add(const string& sat, const t_gtime& crt, const t_gtime& pre, double mw, double ele, bool slip);
+
+        /** @brief statistics of the satellite at the epoch, nullptr if not kept */
+        const t_mwstat* find(const string& sat, const t_gtime& t) const;
+
+        /** @brief statistics of all satellites at the epoch (t_map_MW indexes 1-5) */
+        map<string, map<int, double>> epoch(const t_gtime& t) const;
+
+        /** @brief number of epochs kept per satellite */
+        size_t depth() const
+        {
+            return _depth;
+        }
+
+        /** @brief memory used by the statistics [bytes] */
+        size_t memory() const;
+
+        /** @brief remove all satellites */
+        void clear();
+
+    protected:
+        /** @brief last epochs of one satellite */
+        struct t_ring
+        {
+            vector<t_mwstat> rows; ///< ring of depth() epochs
+            size_t last = 0;       ///< row of the newest epoch
+        };
+
+        size_t _depth;                         ///< number of epochs kept per satellite
+        unordered_map<string, t_ring> _sats;   ///< statistics by satellite
+    };
+
+} // namespace great
+
+#endif
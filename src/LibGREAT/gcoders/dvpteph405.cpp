@@ -8,6 +8,8 @@
  * @copyright Copyright (c) 2024, Wuhan University. All rights reserved.
  *
  */
+#include <climits>
+#include <cstring>
 #include "gdata/gnavde.h"
 #include "gcoders/dvpteph405.h"
 
@@ -18,7 +20,9 @@ namespace great
     t_dvpteph405::t_dvpteph405(t_gsetbase* s, string version, int sz) :
         t_gcoder(s, version, sz),
         _version_de(0),
-        _days(0.0)
+        _days(0.0),
+        _rec_beg(0),
+        _rec_end(INT_MAX)
     {
         _flag = 0;
     }
@@ -53,11 +57,13 @@ namespace great
 
         try
         {
-            string tmp;
-            _decode_buffer.toString(tmp);
-            while (tmp.length() >= 4 * irecsz)
+            // records are read in place from the decode buffer and consumed as a whole
+            const char* data = nullptr;
+            int size = t_gcoder::_getbuffer(data);
+            int pos = 0;
+            while (size - pos >= 4 * irecsz)
             {
-                stringstream ss(tmp);
+                const char* rec = data + pos;
                 // read data of first part
                 if (_flag == 0)
                 {
@@ -67,10 +73,9 @@ namespace great
                     vector<double> constval;
                     int constnum;
                     double au, emrat;
-                    char str[6];
                     double tmpval;
 
-                    if (tmp.length() < 2 * 4 * irecsz)
+                    if (size - pos < 2 * 4 * irecsz)
                     {
                         break;
                     }
@@ -78,43 +83,43 @@ namespace great
                     {
                         for (i = 0; i < 14; i++)
                         {
-                            ss.read(TTL[i][j], sizeof(char) * 6);
+                            _read(rec, TTL[i][j], sizeof(char) * 6);
                         }
                     }
                     for (i = 0; i < 400; i++)
                     {
-                        ss.read(str, sizeof(char) * 6);
-                        constname.push_back(string(str, 6));
+                        constname.push_back(string(rec, 6));
+                        rec += 6;
                     }
                     for (i = 0; i < 3; i++)
                     {
-                        ss.read((char*)&SS[i], SIZE_DBL);
+                        _read(rec, &SS[i], SIZE_DBL);
                     }
                     _beg_de.from_mjd(int(SS[0] - 2400000.5), 0);
                     _end_de.from_mjd(int(SS[1] - 2400000.5), 0);
                     _days = SS[2];
 
-                    ss.read((char*)&constnum, SIZE_INT);
-                    ss.read((char*)&au, SIZE_DBL);
-                    ss.read((char*)&emrat, SIZE_DBL);
+                    _read(rec, &constnum, SIZE_INT);
+                    _read(rec, &au, SIZE_DBL);
+                    _read(rec, &emrat, SIZE_DBL);
                     for (j = 0; j < 12; j++)
                     {
                         for (i = 0; i < 3; i++)
                         {
-                            ss.read((char*)&_ipt[i][j], SIZE_INT);
+                            _read(rec, &_ipt[i][j], SIZE_INT);
                         }
                     }
-                    ss.read((char*)&_version_de, SIZE_INT);
+                    _read(rec, &_version_de, SIZE_INT);
                     for (i = 0; i < 3; i++)
                     {
-                        ss.read((char*)&_ipt[i][12], SIZE_INT);
+                        _read(rec, &_ipt[i][12], SIZE_INT);
                     }
 
                     // second part--value of constants
-                    ss.seekg(irecsz * 4, ios::beg);
+                    rec = data + pos + irecsz * 4;
                     for (i = 0; i < 400; i++)
                     {
-                        ss.read((char*)&tmpval, SIZE_DBL);
+                        _read(rec, &tmpval, SIZE_DBL);
                         constval.push_back(tmpval);
                     }
                     vector<string>::iterator itname = constname.begin() + constnum;
@@ -122,6 +127,16 @@ namespace great
                     constname.erase(itname, constname.end());
                     constval.erase(itval, constval.end());
 
+                    // records of the processing span (one record margin), all without settings
+                    _rec_beg = 0;
+                    _rec_end = INT_MAX;
+                    if (_set && _days > 0.0)
+                    {
+                        double start = SS[0] - 2400000.5;
+                        _rec_beg = max(0, int(floor((_beg.dmjd() - start) / _days)) - 1);
+                        _rec_end = max(_rec_beg, int(floor((_end.dmjd() - start) / _days)) + 1);
+                    }
+
                     // fill head data
                     map<string, t_gdata*>::iterator it = _data.begin();
                     while (it != _data.end())
@@ -132,47 +147,51 @@ namespace great
                         }
                         it++;
                     }
-                    t_gcoder::_consume(2 * 4 * irecsz);
+                    pos += 2 * 4 * irecsz;
                     _flag++;
                 }
                 // Chebychev coefficient
                 else if (_flag > 0)
                 {
-                    vector<double> coeff;
-                    t_gtime tm;
-                    double tmp;
-                    for (i = 0; i < iKsize / 2; i++)
+                    // records outside the processing span are skipped
+                    int index = _flag - 1;
+                    if (index >= _rec_beg && index <= _rec_end)
                     {
-                        ss.read((char*)&tmp, SIZE_DBL);
-                        coeff.push_back(tmp);
-                    }
-                    tm = _beg_de + (_flag - 1) * _days;
+                        vector<double> coeff(iKsize / 2);
+                        _read(rec, coeff.data(), coeff.size() * SIZE_DBL);
 
-                    // fill chebychev coefficient by time
-                    map<string, t_gdata*>::iterator it = _data.begin();
-                    while (it != _data.end())
-                    {
-                        // fill piece coffecient to data
-                        if (it->second->id_type() == t_gdata::ALLDE)
+                        // fill chebychev coefficient by time
+                        map<string, t_gdata*>::iterator it = _data.begin();
+                        while (it != _data.end())
                         {
-                            dynamic_cast<t_gnavde*>(it->second)->add_data(_flag - 1, coeff);
+                            // fill piece coffecient to data
+                            if (it->second->id_type() == t_gdata::ALLDE)
+                            {
+                                dynamic_cast<t_gnavde*>(it->second)->add_data(index, coeff);
+                            }
+                            it++;
                         }
-                        it++;
                     }
                     _flag++;
-                    t_gcoder::_consume(4 * irecsz);
+                    pos += 4 * irecsz;
                 }
-
-                _decode_buffer.toString(tmp);
             }
+            t_gcoder::_consume(pos);
             _mutex.unlock();
             return irecsz;
         }
         catch (...)
         {
             GREAT_ERROR("ERROR : t_dvpteph405::decode_data throw exception");
+            _mutex.unlock();
             return -1;
         }
     }
 
+    void t_dvpteph405::_read(const char*& rec, void* val, size_t sz)
+    {
+        memcpy(val, rec, sz);
+        rec += sz;
+    }
+
 } // namespace great
@@ -60,6 +60,14 @@ namespace great
         virtual int decode_data(char* buff, int bufLen, int& cnt, vector<string>& errmsg);
 
     protected:
+        /**
+         * @brief copy bytes of a record and move behind them.
+         * @param[in,out]  rec     position in the record
+         * @param[out]     val     value
+         * @param[in]      sz      size of the value
+         */
+        void _read(const char*& rec, void* val, size_t sz);
+
     private:
         int _flag;       ///< flag for decoder
         int _version_de; ///< JPL file version
@@ -67,6 +75,8 @@ namespace great
         t_gtime _end_de; ///< end time for JPL data
         double _days;    ///< Sampling interval of data(unit: day)
         int _ipt[3][13]; ///< index of planets for calculating position and speed
+        int _rec_beg;    ///< first record stored (processing span)
+        int _rec_end;    ///< last record stored (processing span)
     };
 } // namespace great
 
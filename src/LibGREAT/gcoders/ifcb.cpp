@@ -105,6 +105,7 @@ namespace great
         catch (...)
         {
             GREAT_ERROR("t_ifcb::decode_data throw exception");
+            _mutex.unlock();
             return -1;
         }
         _mutex.unlock();
@@ -114,6 +114,7 @@ namespace great
         catch (...)
         {
             GREAT_ERROR("ERROR : t_poleut1::decode_head throw exception");
+            _mutex.unlock();
             return -1;
         }
     }
@@ -175,6 +176,7 @@ namespace great
         catch (...)
         {
             GREAT_ERROR("ERROR : t_poleut1::decode_data throw exception");
+            _mutex.unlock();
             return -1;
         }
     }
@@ -106,6 +106,7 @@ namespace great
         catch (...)
         {
             GREAT_ERROR("ERROR: unknown mistake");
+            _mutex.unlock();
             return -1;
         }
         _mutex.unlock();
@@ -191,6 +192,7 @@ namespace great
         catch (...)
         {
             GREAT_ERROR("ERROR: unknown mistake");
+            _mutex.unlock();
             return -1;
         }
         _mutex.unlock();
@@ -10,6 +10,7 @@
  */
 #include "gdata/gnavde.h"
 #include "gutils/gconst.h"
+#include "gutils/gtypeconv.h"
 #include <math.h>
 #include <algorithm>
 using namespace std;
@@ -36,36 +37,60 @@ namespace great
     {
     }
 
-    void t_gnavde::get_pos(const double& tm, const string& plane_tname, t_gtriple& pos)
+    void t_gnavde::get_pos(const double& tm, const PLANET& planet, t_gtriple& pos)
     {
-        // transfer planetname to (int) num
-        int planet = str2planet(plane_tname);
         // get cunrrent time
         double pjd = tm + 2400000.5;
         // get position and velocity
         double rrd[6];
-        _pleph(pjd, planet, 2, rrd);
+        _gmutex.lock();
+        _pleph(pjd, planet, PLANET_EART, rrd);
+        _gmutex.unlock();
         // transfer double[] to t_gtriple
         pos[0] = rrd[0];
         pos[1] = rrd[1];
         pos[2] = rrd[2];
     }
 
-    void t_gnavde::get_pos(const double& tm, const string& planet_name, ColumnVector& pos)
+    void t_gnavde::get_pos(const double& tm, const PLANET& planet, ColumnVector& pos)
     {
-        // transfer planetname to (int) num
-        int planet = str2planet(planet_name);
         // get cunrrent time
         double pjd = tm + 2400000.5;
         // get position and velocity
         double rrd[6];
-        _pleph(pjd, planet, 2, rrd);
+        _gmutex.lock();
+        _pleph(pjd, planet, PLANET_EART, rrd);
+        _gmutex.unlock();
         // transfer
         pos(1) = rrd[0];
         pos(2) = rrd[1];
         pos(3) = rrd[2];
     }
 
+    void t_gnavde::get_pos(const double& tm, const string& plane_tname, t_gtriple& pos)
+    {
+        // transfer planetname to (int) num
+        int planet = str2planet(plane_tname);
+        if (planet < 0)
+        {
+            pos = t_gtriple(0.0, 0.0, 0.0);
+            return;
+        }
+        get_pos(tm, static_cast<PLANET>(planet), pos);
+    }
+
+    void t_gnavde::get_pos(const double& tm, const string& planet_name, ColumnVector& pos)
+    {
+        // transfer planetname to (int) num
+        int planet = str2planet(planet_name);
+        if (planet < 0)
+        {
+            pos(1) = pos(2) = pos(3) = 0.0;
+            return;
+        }
+        get_pos(tm, static_cast<PLANET>(planet), pos);
+    }
+
     void t_gnavde::_pleph(const double& et, const int& planet, const int& center, double* rrd)
     {
         // tag for interpolate
@@ -238,14 +263,19 @@ namespace great
 
         dt[0] = ((pjd[0] - nindex * _days - start) + pjd[3]) / _days;
 
-        vector<double> coeff = _chebycoeff[nindex];
+        const double* coeff = _record(nindex);
+        if (!coeff)
+        {
+            GREAT_WARN("JPL record " + int2str(nindex) + " is not loaded (out of the processing span)");
+            return -1;
+        }
 
         // unit correct
         dt[1] = _days * 86400;
         aufact = 1;
 
         // interpolate sun
-        _interp(coeff, _allplanets[10].ipt, _allplanets[10].ncf, 3, _allplanets[10].na, 2, dt, pv_sun[0]);
+        _interp_body(coeff, nindex, 10, 2, dt, pv_sun[0]);
         for (int i = 0; i < 6; i++)
         {
             pv_sun[i][0] = pv_sun[i][0] * aufact;
@@ -258,7 +288,7 @@ namespace great
             {
                 continue;
             }
-            _interp(coeff, _allplanets[i].ipt, _allplanets[i].ncf, 3, _allplanets[i].na, list[i], dt, tmp);
+            _interp_body(coeff, nindex, i, list[i], dt, tmp);
             for (int j = 0; j < 6; j++)
             {
                 pv[j][i] = tmp[2 * j];
@@ -303,7 +333,39 @@ namespace great
         return;
     }
 
-    void t_gnavde::_interp(const vector<double>& coeff,
+    const double* t_gnavde::_record(const int& index) const
+    {
+        int rec = index - _rec_first;
+        if (rec < 0 || rec >= static_cast<int>(_rec_loaded.size()) || !_rec_loaded[rec])
+        {
+            return nullptr;
+        }
+        return _chebycoeff.data() + static_cast<size_t>(rec) * _rec_size;
+    }
+
+    void t_gnavde::_interp_body(const double* coeff, const int& rec, const int& body, const int& ifl, double dt[], double* pv)
+    {
+        // Sun and Moon of one epoch need the same bodies, each is interpolated once
+        t_cheb_cache& cache = _cache[body];
+        if (cache.rec != rec || cache.dt != dt[0] || cache.ifl < ifl)
+        {
+            _interp(coeff, _allplanets[body].ipt, _allplanets[body].ncf, 3, _allplanets[body].na, ifl, dt, cache.pv);
+            cache.rec = rec;
+            cache.dt = dt[0];
+            cache.ifl = ifl;
+        }
+        // only the elements written by _interp
+        for (int i = 0; i < 3; i++)
+        {
+            pv[2 * i] = cache.pv[2 * i];
+            if (ifl > 1)
+            {
+                pv[2 * i + 6] = cache.pv[2 * i + 6];
+            }
+        }
+    }
+
+    void t_gnavde::_interp(const double* coeff,
                            const int& ipt,
                            const int& ncf,
                            const int& ncm,
@@ -400,6 +462,10 @@ namespace great
 
         _au = au * au * au / (86400.0 * 86400.0);
         _emrat = emrat;
+        for (auto& cache : _cache)
+        {
+            cache.rec = -1;
+        }
 
         for (int i = 0; i < 13; i++)
         {
@@ -433,7 +499,35 @@ namespace great
 
     void t_gnavde::add_data(const int& index, const vector<double>& coeff)
     {
-        _chebycoeff[index] = coeff;
+        _gmutex.lock();
+        // records come in increasing order, the first one fixes the layout
+        if (_rec_loaded.empty())
+        {
+            _rec_first = index;
+            _rec_size = coeff.size();
+        }
+        int rec = index - _rec_first;
+        if (rec < 0 || static_cast<int>(coeff.size()) != _rec_size)
+        {
+            _gmutex.unlock();
+            GREAT_WARN("JPL record " + int2str(index) + " is not stored");
+            return;
+        }
+        if (rec >= static_cast<int>(_rec_loaded.size()))
+        {
+            _rec_loaded.resize(rec + 1, 0);
+            _chebycoeff.resize(_rec_loaded.size() * _rec_size, 0.0);
+        }
+        copy(coeff.begin(), coeff.end(), _chebycoeff.begin() + static_cast<size_t>(rec) * _rec_size);
+        _rec_loaded[rec] = 1;
+        for (auto& cache : _cache)
+        {
+            if (cache.rec == index)
+            {
+                cache.rec = -1;
+            }
+        }
+        _gmutex.unlock();
     }
 
     int t_gnavde::str2planet(const string& tmp) const
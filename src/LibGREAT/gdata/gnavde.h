@@ -63,6 +63,11 @@ namespace great
 
     /**
      *@brief       Class for save DE data mainly include Chebychev coefficient
+     *
+     * The coefficients of the loaded records (usually only those covering the processing
+     * span) are kept in one contiguous array. The last evaluation of every body is cached
+     * with its record and Chebychev time, so the Sun and Moon queries of one epoch
+     * interpolate each body only once.
      */
     class LibGREAT_LIBRARY_EXPORT t_gnavde : public t_gdata
     {
@@ -96,6 +101,22 @@ namespace great
          */
         void add_data(const int& index, const vector<double>& coeff);
 
+        /**
+         * @brief get position of planet in crs(J2000), earth is center body.
+         * @param[in]   tm             dynamic time(mjd)
+         * @param[in]   planet         planet(enum)
+         * @param[out]  pos             position of planet(t_gtriple)
+         */
+        void get_pos(const double& tm, const PLANET& planet, t_gtriple& pos);
+
+        /**
+         * @brief get position of planet in crs(J2000), earth is center body.
+         * @param[in]   tm             dynamic time(mjd)
+         * @param[in]   planet         planet(enum)
+         * @param[out]  pos             position of planet(columnvector)
+         */
+        void get_pos(const double& tm, const PLANET& planet, ColumnVector& pos);
+
         /**
          * @brief get position of planet in crs(J2000), earth is center body.
          * @param[in]   tm             dynamic time(mjd)
@@ -126,12 +147,44 @@ namespace great
         double _days;                         ///< interval time for Chebychev coefficient
         double _au;                           ///< Astronomical unit
         double _emrat;                        ///< Earth-Moon mass ratio.
-        map<int, vector<double>> _chebycoeff; ///< int--index of time  Chebychev coefficient
+        int _rec_first = 0;                   ///< index of the first loaded record
+        int _rec_size = 0;                    ///< # of coefficients of one record
+        vector<double> _chebycoeff;           ///< Chebychev coefficient of the loaded records
+        vector<char> _rec_loaded;             ///< record loaded, by index - _rec_first
         map<int, t_gplanet> _allplanets;      ///< int--planet
 
         double empty_return = 0.0;
 
     private:
+        /** @brief last interpolation of one body */
+        struct t_cheb_cache
+        {
+            int rec = -1;      ///< record index
+            double dt = -1.0;  ///< normalized time in the record
+            int ifl = 0;       ///< interpolation symbol
+            double pv[12];     ///< interpolated values (as _interp)
+        };
+
+        /**
+         * @brief coefficients of the record.
+         * @param[in]   index      record index
+         * @return    coefficients or nullptr if the record is not loaded
+         */
+        const double* _record(const int& index) const;
+
+        /**
+         * @brief interpolate a body of the record, reusing the last interpolation.
+         * @param[in]   coeff      coefficients of the record
+         * @param[in]   rec        record index
+         * @param[in]   body       body (index of ipt)
+         * @param[in]   ifl        interpolation symbol(1--interp pos only;2--pos and vel)
+         * @param[in]   dt         interpolate time
+         * @param[out]  pv         postion and velocity of the body
+         */
+        void _interp_body(const double* coeff, const int& rec, const int& body, const int& ifl, double dt[], double* pv);
+
+        t_cheb_cache _cache[11]; ///< last interpolation by body (planets, Moon, Sun)
+
         /**
          * @brief calculate planet postion and velocity.
          * @param[in]   et         dynamic time(jd)
@@ -161,7 +214,7 @@ namespace great
          * @param[in]   ifl         interpolation symbol(1--interp pos only;2--pos and vel)
          * @param[out]  pv         postion and velocity of the target planet
          */
-        void _interp(const vector<double>& coeff,
+        void _interp(const double* coeff,
                      const int& ipt,
                      const int& ncf,
                      const int& ncm,
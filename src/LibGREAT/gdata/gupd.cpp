@@ -8,6 +8,7 @@
  * @copyright Copyright (c) 2024, Wuhan University. All rights reserved.
  *
  */
+#include <algorithm>
 #include "gdata/gupd.h"
 
 using namespace std;
@@ -23,7 +24,8 @@ namespace great
     }
 
     t_gupd::t_gupd() :
-        t_gdata()
+        t_gdata(),
+        _upd(static_cast<int>(UPDTYPE::NONE) + 1)
     {
         id_type(t_gdata::UPD);
         _ewl_flag = t_gtime(EWL_IDENTIFY);
@@ -48,8 +50,47 @@ namespace great
 
     void t_gupd::add_sat_upd(UPDTYPE upd_type, t_gtime epoch, string prn, t_updrec one_sat_upd)
     {
-        _upd[upd_type][epoch][prn] = make_shared<t_updrec>(one_sat_upd);
-        if (upd_type == UPDTYPE::WL && _upd[upd_type].size() > 1)
+        auto itSAT = _sat.find(prn);
+        if (itSAT == _sat.end())
+        {
+            itSAT = _sat.insert(make_pair(prn, static_cast<int>(_sat.size()))).first;
+        }
+
+        // files are read forward, new epochs are usually appended
+        vector<t_updepoch>& series = _upd[static_cast<int>(upd_type)];
+        auto itEPO = series.end();
+        if (series.empty() || series.back().t < epoch)
+        {
+            itEPO = series.insert(itEPO, t_updepoch());
+            itEPO->t = epoch;
+        }
+        else
+        {
+            itEPO = lower_bound(series.begin(), series.end(), epoch,
+                                [](const t_updepoch& epo, const t_gtime& t) { return epo.t < t; });
+            if (itEPO->t != epoch)
+            {
+                itEPO = series.insert(itEPO, t_updepoch());
+                itEPO->t = epoch;
+            }
+        }
+
+        int sat = itSAT->second;
+        if (static_cast<int>(itEPO->idx.size()) <= sat)
+        {
+            itEPO->idx.resize(_sat.size(), -1);
+        }
+        if (itEPO->idx[sat] < 0)
+        {
+            itEPO->idx[sat] = itEPO->rec.size();
+            itEPO->rec.push_back(one_sat_upd);
+        }
+        else
+        {
+            itEPO->rec[itEPO->idx[sat]] = one_sat_upd;
+        }
+
+        if (upd_type == UPDTYPE::WL && series.size() > 1)
         {
             wl_epo_mode(true);
         }
@@ -65,32 +106,49 @@ namespace great
         t_gupd::add_sat_upd(upd_type, t, str, one_upd);
     }
 
-    one_epoch_upd& t_gupd::get_epo_upd(const UPDTYPE& upd_type, const t_gtime& t)
+    int t_gupd::epo_index(const UPDTYPE& upd_type, const t_gtime& t, int* cursor)
     {
-        if (_upd[upd_type].find(t) != _upd[upd_type].end())
+        const vector<t_updepoch>& series = _upd[static_cast<int>(upd_type)];
+        auto beg = series.begin();
+        if (cursor && *cursor >= 0 && *cursor < static_cast<int>(series.size()) && !(t < series[*cursor].t))
         {
-            return _upd[upd_type][t];
+            beg += *cursor; // forward processing, search from the previous epoch
         }
-        else
+        auto itEPO = lower_bound(beg, series.end(), t,
+                                 [](const t_updepoch& epo, const t_gtime& t) { return epo.t < t; });
+        if (itEPO == series.end())
         {
-            auto it_epo = _upd[upd_type].lower_bound(t);
-            if (it_epo != _upd[upd_type].end())
-            {
-                if (it_epo->first.diff(t) >= 30)
-                {
-                    _wait_stream = false;
-                    return _null_epoch_upd;
-                }
-                else
-                {
-                    return it_epo->second;
-                }
-            }
-            else
-            {
-                return _null_epoch_upd;
-            }
+            return -1;
+        }
+        if (itEPO->t != t && itEPO->t.diff(t) >= 30)
+        {
+            _wait_stream = false;
+            return -1;
+        }
+
+        int epo = itEPO - series.begin();
+        if (cursor)
+        {
+            *cursor = epo;
+        }
+        return epo;
+    }
+
+    int t_gupd::sat_index(const string& prn) const
+    {
+        auto itSAT = _sat.find(prn);
+        return (itSAT == _sat.end()) ? -1 : itSAT->second;
+    }
+
+    const t_updrec* t_gupd::sat_upd(const UPDTYPE& upd_type, int epo, int sat) const
+    {
+        const vector<t_updepoch>& series = _upd[static_cast<int>(upd_type)];
+        if (epo < 0 || epo >= static_cast<int>(series.size()) || sat < 0 ||
+            sat >= static_cast<int>(series[epo].idx.size()) || series[epo].idx[sat] < 0)
+        {
+            return nullptr;
         }
+        return &series[epo].rec[series[epo].idx[sat]];
     }
 
 } // namespace great
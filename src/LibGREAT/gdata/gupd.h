@@ -11,6 +11,8 @@
 #ifndef GUPD_H
 #define GUPD_H
 
+#include <unordered_map>
+#include <vector>
 #include "gdata/gdata.h"
 #include "gutils/gtime.h"
 #include "gset/gsetamb.h"
@@ -56,14 +58,13 @@ namespace great
         bool isRef;   ///< true set as a reference
     };
 
-    /**
-     * map container using satellite name as a index for storaging t_updrec ptr , one epoch/all satellite
-     * for wide-lane only one sign epoch "WL_IDENTIFY"
-     */
-    typedef map<string, shared_ptr<t_updrec>> LibGREAT_LIBRARY_EXPORT one_epoch_upd;
-
     /**
      *@brief     Class for storaging all epoch/all satellite upd data
+     *
+     * The upd of every type (integer index of UPDTYPE) are kept as a time series sorted by epoch,
+     * the records of one epoch in an array indexed by a dense satellite id. Day solutions have
+     * only one sign epoch (e.g. "WL_IDENTIFY"), epoch-wise files one entry per epoch. The lookups
+     * return pointers into the store, nothing is copied.
      */
     class LibGREAT_LIBRARY_EXPORT t_gupd : public t_gdata
     {
@@ -85,13 +86,29 @@ namespace great
         void add_sat_upd(UPDTYPE upd_type, t_gtime epoch, string prn, t_updrec one_sat_upd);
 
         /**
-         * @brief get upd data of one epoch/all satellite.
+         * @brief index of the upd epoch used at t (the same epoch or the next one within 30 s).
+         * @param[in]     upd_type    upd type
+         * @param[in]     t           epoch time
+         * @param[in,out] cursor      index found by the previous call (forward processing), may be nullptr
+         * @return the epoch index, -1 if no upd
+         */
+        int epo_index(const UPDTYPE& upd_type, const t_gtime& t, int* cursor = nullptr);
+
+        /**
+         * @brief dense index of the satellite.
+         * @param[in] prn         satellite name
+         * @return the satellite index, -1 if no upd
+         */
+        int sat_index(const string& prn) const;
+
+        /**
+         * @brief upd of one epoch/one satellite.
          * @param[in] upd_type    upd type
-         * @param[in] t           epoch time
-         * @param[in] str         satellite name
-         * @return the upd data in epoch
+         * @param[in] epo         epoch index (epo_index)
+         * @param[in] sat         satellite index (sat_index)
+         * @return the upd record, nullptr if no upd
          */
-        one_epoch_upd& get_epo_upd(const UPDTYPE& upd_type, const t_gtime& t);
+        const t_updrec* sat_upd(const UPDTYPE& upd_type, int epo, int sat) const;
 
         /**
          * @brief reinitialize upd data of one epoch/one satellite.
@@ -115,10 +132,18 @@ namespace great
         };
 
     protected:
-        map<UPDTYPE, map<t_gtime, one_epoch_upd>> _upd; ///< upd map container of all epoch/all satellite(different type)
-        UPDTYPE _est_upd_type;                          ///< upd mode (for estimation)
-        map<UPDTYPE, t_gtime> _valid_beg;               ///< valid begin epoch (for encoder)
-        one_epoch_upd _null_epoch_upd;
+        /** @brief upd of one epoch/all satellite */
+        struct t_updepoch
+        {
+            t_gtime t;             ///< epoch
+            vector<int> idx;       ///< record index by satellite index (-1 none)
+            vector<t_updrec> rec;  ///< records
+        };
+
+        vector<vector<t_updepoch>> _upd;  ///< upd series by type, sorted by epoch
+        unordered_map<string, int> _sat;  ///< satellite indexes
+        UPDTYPE _est_upd_type;            ///< upd mode (for estimation)
+        map<UPDTYPE, t_gtime> _valid_beg; ///< valid begin epoch (for encoder)
         bool _wait_stream; ///< Real-time upd interrupt to maintain float solution results
         bool _wl_epo_mode; ///< WL epoch by epoch or not?
         t_gtime _tend;     ///< The end Time of real-time upd.
@@ -68,6 +68,14 @@ namespace great
          *      @retval false can not calculate equation
          */
         virtual bool cmb_equ(t_gtime& epoch, t_gallpar& params, t_gsatdata& obsdata, t_gbaseEquation& result) = 0;
+
+        /**
+         * @brief prepare the satellites of an epoch together before cmb_equ
+         * @param[in]  epoch     time
+         * @param[in]  params    parameter
+         * @param[in]  obsdata   observation data of the epoch
+         */
+        virtual void prepare_epoch(const t_gtime& epoch, t_gallpar& params, vector<t_gsatdata>& obsdata) {};
     };
 } // namespace great
 
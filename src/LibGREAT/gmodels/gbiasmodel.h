@@ -51,6 +51,9 @@ namespace great
         /** @brief Combined equation */
         virtual bool cmb_equ(t_gtime& epoch, t_gallpar& params, t_gsatdata& obsdata, t_gobs& gobs, t_gbaseEquation& result) = 0;
 
+        /** @brief prepare the satellites of an epoch together (empty function) */
+        virtual void prepare_epoch(const t_gtime& epoch, t_gallpar& params, vector<t_gsatdata>& obsdata) {};
+
         /** @brief empty function */
         virtual void update_obj_clk(const string& obj, const t_gtime& epo, double clk) {};
 
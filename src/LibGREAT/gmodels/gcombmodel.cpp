@@ -54,6 +54,14 @@ namespace great
 
     t_gcombmodel::~t_gcombmodel() = default;
 
+    void t_gcombmodel::prepare_epoch(const t_gtime& epoch, t_gallpar& params, vector<t_gsatdata>& obsdata)
+    {
+        if (_bias_model)
+        {
+            _bias_model->prepare_epoch(epoch, params, obsdata);
+        }
+    }
+
     map<GSYS, map<FREQ_SEQ, GOBSBAND>> t_gcombmodel::get_band_index()
     {
         return _band_index;
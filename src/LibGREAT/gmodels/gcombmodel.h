@@ -49,6 +49,9 @@ namespace great
         /** @brief default destructor. */
         virtual ~t_gcombmodel();
 
+        /** @brief prepare the satellites of an epoch in the bias model */
+        void prepare_epoch(const t_gtime& epoch, t_gallpar& params, vector<t_gsatdata>& obsdata) override;
+
         /** @brief get index of band */
         map<GSYS, map<FREQ_SEQ, GOBSBAND>> get_band_index();
 
@@ -47,6 +47,12 @@ namespace great
         _attitudes = dynamic_cast<t_gsetproc*>(setting)->attitudes();
         _opl = dynamic_cast<t_gallopl*>((*data)[t_gdata::ALLOPL]);
         _mean_pole_model = dynamic_cast<t_gsetproc*>(setting)->mean_pole_model();
+
+        double eop_accuracy = dynamic_cast<t_gsetproc*>(setting)->eop_accuracy();
+        if (_gdata_erp && eop_accuracy > 0.0)
+        {
+            _trs2crs_grid = t_gtrs2crs_grid::share(_gdata_erp, eop_accuracy);
+        }
     }
 
     t_gprecisebias::~t_gprecisebias()
@@ -314,22 +320,279 @@ namespace great
         return reldelay;
     }
 
-    bool t_gprecisebias::_update_obs_info(t_gsatdata& obsdata)
+    void t_gprecisebias::prepare_epoch(const t_gtime& epoch, t_gallpar& params, vector<t_gsatdata>& obsdata)
     {
-        obsdata = _crt_obs;
-        return true;
+        if (!_gall_nav || !_gallobj || obsdata.empty())
+        {
+            return;
+        }
+
+        // satellites of each site not yet prepared in the epoch (next iterations of the filter)
+        map<string, vector<int>> site_sats;
+        for (size_t i = 0; i < obsdata.size(); i++)
+        {
+            if (_geo_entry(obsdata[i].site(), obsdata[i].sat()).batch_epo != epoch)
+            {
+                site_sats[obsdata[i].site()].push_back(i);
+            }
+        }
+
+        vector<string> sats;
+        vector<t_gtime> tsat;
+        vector<double> xyz, vel, clk, dclk;
+        vector<int> irc;
+        for (const auto& item : site_sats)
+        {
+            const string& site = item.first;
+            const vector<int>& idx = item.second;
+            shared_ptr<t_gobj> obj = _gallobj->obj(site);
+            if (!obj)
+            {
+                continue;
+            }
+
+            // approximate receiver position and clock (tides and PCO are added per satellite)
+            double rec_clk = 0.0;
+            t_gtriple rec;
+            _geo_rec_par(site, params, rec_clk, rec);
+            if (_crd_est == CONSTRPAR::FIX || rec.zero())
+            {
+                rec = obj->crd(epoch);
+            }
+            if (!_is_flt || _crd_est == CONSTRPAR::FIX)
+            {
+                rec = rec + obj->eccxyz(epoch);
+            }
+            if (rec.zero())
+            {
+                continue;
+            }
+            auto itCLK = _obj_clk.find(site);
+            if (itCLK != _obj_clk.end() && itCLK->second.first == epoch && !double_eq(itCLK->second.second, 0.0))
+            {
+                rec_clk = itCLK->second.second;
+            }
+            else
+            {
+                rec_clk /= CLIGHT;
+            }
+            t_gtime rec_epo = epoch - rec_clk;
+
+            // satellite clocks at the epoch (as _update_obj_clk_GPP)
+            int n = idx.size();
+            sats.resize(n);
+            tsat.assign(n, epoch);
+            for (int i = 0; i < n; i++)
+            {
+                sats[i] = obsdata[idx[i]].sat();
+            }
+            _gall_nav->clk(sats, tsat, clk, dclk, irc);
+            for (int i = 0; i < n; i++)
+            {
+                pair<t_gtime, double>& sat_clk = _obj_clk[sats[i]];
+                sat_clk.first = epoch;
+                sat_clk.second = (irc[i] < 0) ? 0.0 : clk[i];
+            }
+
+            // light time of all satellites, the converged ones leave the active list
+            vector<int> act(n);
+            vector<double> delay(n, 0.0);
+            for (int i = 0; i < n; i++)
+            {
+                act[i] = i;
+            }
+            vector<string> act_sats;
+            for (int iter = 0; iter < 10 && !act.empty(); iter++)
+            {
+                int m = act.size();
+                act_sats.resize(m);
+                tsat.resize(m);
+                for (int k = 0; k < m; k++)
+                {
+                    act_sats[k] = sats[act[k]];
+                    tsat[k] = rec_epo - delay[act[k]];
+                }
+                _gall_nav->pos(act_sats, tsat, xyz, vel, irc);
+
+                int left = 0;
+                for (int k = 0; k < m; k++)
+                {
+                    int i = act[k];
+                    if (irc[k] < 0)
+                    {
+                        continue;
+                    }
+
+                    // satellite position in the TRS of the receive time (Earth rotation during the light time)
+                    double a = OMEGA * delay[i];
+                    double ca = cos(a), sa = sin(a);
+                    const double* x = &xyz[3 * k];
+                    double dx = ca * x[0] + sa * x[1] - rec[0];
+                    double dy = -sa * x[0] + ca * x[1] - rec[1];
+                    double dz = x[2] - rec[2];
+                    double tau = sqrt(dx * dx + dy * dy + dz * dz) / CLIGHT;
+
+                    if (fabs(tau - delay[i]) < 1E-9)
+                    {
+                        t_gsatdata& satdata = obsdata[idx[i]];
+                        satdata.addcrd(t_gtriple(x[0], x[1], x[2]));
+                        satdata.addvel(t_gtriple(vel[3 * k], vel[3 * k + 1], vel[3 * k + 2]));
+                        satdata.addrecTime(rec_epo);
+                        satdata.addsatTime(tsat[k]);
+
+                        t_gsatgeo& geo = _geo_entry(site, sats[i]);
+                        geo.batch_epo = epoch;
+                        geo.batch_delay = delay[i];
+                    }
+                    else
+                    {
+                        act[left++] = i;
+                    }
+                    delay[i] = tau;
+                }
+                act.resize(left);
+            }
+        }
+    }
+
+    t_gprecisebias::t_gsatgeo& t_gprecisebias::_geo_entry(const string& site, const string& sat)
+    {
+        auto itSITE = _geo_site_id.find(site);
+        if (itSITE == _geo_site_id.end())
+        {
+            itSITE = _geo_site_id.insert(make_pair(site, static_cast<int>(_geo_site_id.size()))).first;
+            _geo.resize(_geo_site_id.size());
+            _crt_geo = nullptr; // entries moved
+            _geo_loaded = nullptr;
+        }
+        auto itSAT = _geo_sat_id.find(sat);
+        if (itSAT == _geo_sat_id.end())
+        {
+            itSAT = _geo_sat_id.insert(make_pair(sat, static_cast<int>(_geo_sat_id.size()))).first;
+        }
+
+        vector<t_gsatgeo>& sats = _geo[itSITE->second];
+        if (sats.size() <= static_cast<size_t>(itSAT->second))
+        {
+            sats.resize(_geo_sat_id.size());
+            _crt_geo = nullptr;
+            _geo_loaded = nullptr;
+        }
+        return sats[itSAT->second];
+    }
+
+    t_gprecisebias::t_gsatgeo* t_gprecisebias::_geo_find(const string& site, const string& sat)
+    {
+        auto itSITE = _geo_site_id.find(site);
+        auto itSAT = _geo_sat_id.find(sat);
+        if (itSITE == _geo_site_id.end() || itSAT == _geo_sat_id.end())
+        {
+            return nullptr;
+        }
+        vector<t_gsatgeo>& sats = _geo[itSITE->second];
+        if (sats.size() <= static_cast<size_t>(itSAT->second))
+        {
+            return nullptr;
+        }
+        return &sats[itSAT->second];
+    }
+
+    void t_gprecisebias::_geo_rec_par(const string& site, t_gallpar& pars, double& clk, t_gtriple& crd)
+    {
+        int rec_id = pars.nameId(site);
+        int none_id = pars.nameId("");
+
+        int idx = pars.getParam(par_type::CLK, rec_id, none_id);
+        clk = (idx >= 0) ? pars.getParValue(idx) : 0.0;
+
+        crd = t_gtriple(0.0, 0.0, 0.0);
+        if (_crd_est != CONSTRPAR::FIX)
+        {
+            int ix = pars.getParam(par_type::CRD_X, rec_id, none_id);
+            int iy = pars.getParam(par_type::CRD_Y, rec_id, none_id);
+            int iz = pars.getParam(par_type::CRD_Z, rec_id, none_id);
+            if (ix >= 0 && iy >= 0 && iz >= 0)
+            {
+                crd = t_gtriple(pars.getParValue(ix), pars.getParValue(iy), pars.getParValue(iz));
+            }
+        }
+    }
+
+    bool t_gprecisebias::_geo_valid(const t_gsatgeo& geo, const string& site, const t_gtime& epoch, t_gallpar& pars)
+    {
+        if (geo.epo != epoch || geo.sat_pco != _isCalSatPCO)
+        {
+            return false;
+        }
+        double clk = 0.0;
+        t_gtriple crd;
+        _geo_rec_par(site, pars, clk, crd);
+        return clk == geo.rec_clk && crd == geo.rec_par;
+    }
+
+    void t_gprecisebias::_geo_save(t_gsatgeo& geo, const t_gtime& epoch, t_gallpar& pars, const t_gsatdata& obsdata)
+    {
+        geo.epo = epoch;
+        geo.sat_pco = _isCalSatPCO;
+        _geo_rec_par(_crt_rec, pars, geo.rec_clk, geo.rec_par);
+
+        geo.rec_epo = _crt_rec_epo;
+        geo.sat_epo = _crt_sat_epo;
+        geo.rec_clk_s = _crt_rec_clk;
+        geo.sat_clk_s = _crt_sat_clk;
+        geo.trs_rec_crd = _trs_rec_crd;
+        geo.crs_rec_crd = _crs_rec_crd;
+        geo.crs_rec_vel = _crs_rec_vel;
+        geo.crs_rec_pco = _crs_rec_pco;
+        geo.trs_sat_crd = _trs_sat_crd;
+        geo.crs_sat_crd = _crs_sat_crd;
+        geo.crs_sat_vel = _crs_sat_vel;
+        geo.crs_sat_pco = _crs_sat_pco;
+        geo.geo.copy_geometry(obsdata);
+        geo.pcv.clear();
+    }
+
+    void t_gprecisebias::_geo_load(const t_gsatgeo& geo, const t_gtime& epoch, t_gsatdata& obsdata)
+    {
+        // a copy of the prepared observation already holds the geometry
+        const t_gsatdata& src = geo.geo;
+        if (obsdata.rho() != src.rho() || obsdata.clk() != src.clk() || obsdata.ele() != src.ele() || obsdata.recTime() != src.recTime())
+        {
+            obsdata.copy_geometry(src);
+        }
+        if (_geo_loaded == &geo)
+        {
+            return;
+        }
+
+        _crt_epo = epoch;
+        _crt_rec_epo = geo.rec_epo;
+        _crt_sat_epo = geo.sat_epo;
+        _crt_rec_clk = geo.rec_clk_s;
+        _crt_sat_clk = geo.sat_clk_s;
+        _trs_rec_crd = geo.trs_rec_crd;
+        _crs_rec_crd = geo.crs_rec_crd;
+        _crs_rec_vel = geo.crs_rec_vel;
+        _crs_rec_pco = geo.crs_rec_pco;
+        _trs_sat_crd = geo.trs_sat_crd;
+        _crs_sat_crd = geo.crs_sat_crd;
+        _crs_sat_vel = geo.crs_sat_vel;
+        _crs_sat_pco = geo.crs_sat_pco;
+        _update_rot_matrix(_crt_rec_epo);
     }
 
     double t_gprecisebias::ifbDelay(t_gallpar& param, t_gsatdata& satdata, string& sat, string& rec, t_gobs& gobs)
     {
         double ifb = 0.0;
         auto gsys = t_gsys::sat2gsys(sat);
+        int rec_id = param.nameId(_crt_rec); // receiver parameters have no satellite
+        int none_id = param.nameId("");
 
         switch (gsys)
         {
             case GPS:
             {
-                int i = param.getParam(_crt_rec, par_type::IFB_GPS, "");
+                int i = param.getParam(par_type::IFB_GPS, rec_id, none_id);
                 if (i >= 0 && gobs.is_code() && _freq_index[satdata.gsys()][gobs.band()] == FREQ_3)
                 {
                     ifb = param[i].value();
@@ -338,17 +601,17 @@ namespace great
             }
             case GAL:
             {
-                int i = param.getParam(_crt_rec, par_type::IFB_GAL, "");
+                int i = param.getParam(par_type::IFB_GAL, rec_id, none_id);
                 if (i >= 0 && gobs.is_code() && _freq_index[satdata.gsys()][gobs.band()] == FREQ_3)
                 {
                     ifb = param[i].value();
                 }
-                i = param.getParam(_crt_rec, par_type::IFB_GAL_2, "");
+                i = param.getParam(par_type::IFB_GAL_2, rec_id, none_id);
                 if (i >= 0 && gobs.is_code() && _freq_index[satdata.gsys()][gobs.band()] == FREQ_4)
                 {
                     ifb = param[i].value();
                 }
-                i = param.getParam(_crt_rec, par_type::IFB_GAL_3, "");
+                i = param.getParam(par_type::IFB_GAL_3, rec_id, none_id);
                 if (i >= 0 && gobs.is_code() && _freq_index[satdata.gsys()][gobs.band()] == FREQ_5)
                 {
                     ifb = param[i].value();
@@ -357,17 +620,17 @@ namespace great
             }
             case BDS:
             {
-                int i = param.getParam(_crt_rec, par_type::IFB_BDS, "");
+                int i = param.getParam(par_type::IFB_BDS, rec_id, none_id);
                 if (i >= 0 && gobs.is_code() && _freq_index[satdata.gsys()][gobs.band()] == FREQ_3)
                 {
                     ifb = param[i].value();
                 }
-                i = param.getParam(_crt_rec, par_type::IFB_BDS_2, "");
+                i = param.getParam(par_type::IFB_BDS_2, rec_id, none_id);
                 if (i >= 0 && gobs.is_code() && _freq_index[satdata.gsys()][gobs.band()] == FREQ_4)
                 {
                     ifb = param[i].value();
                 }
-                i = param.getParam(_crt_rec, par_type::IFB_BDS_3, "");
+                i = param.getParam(par_type::IFB_BDS_3, rec_id, none_id);
                 if (i >= 0 && gobs.is_code() && _freq_index[satdata.gsys()][gobs.band()] == FREQ_5)
                 {
                     ifb = param[i].value();
@@ -377,7 +640,7 @@ namespace great
             // QZSS system time offset
             case QZS:
             {
-                int i = param.getParam(_crt_rec, par_type::IFB_QZS, "");
+                int i = param.getParam(par_type::IFB_QZS, rec_id, none_id);
                 if (i >= 0 && gobs.is_code() && _freq_index[satdata.gsys()][gobs.band()] == FREQ_3)
                 {
                     ifb = param[i].value();
@@ -748,6 +1011,21 @@ namespace great
 
         t_gtime tdt = epoch;
         tdt.tsys(t_gtime::TT);
+        if (_trs2crs_grid)
+        {
+            // one own object, refreshed from the shared grid when the epoch changes
+            if (!_trs2crs_2000)
+            {
+                _trs2crs_2000 = make_shared<t_gtrs2crs>(false, _gdata_erp);
+            }
+            else if (_trs2crs_2000->getEpoch() == tdt)
+            {
+                return;
+            }
+            _trs2crs_grid->interpolate(tdt, *_trs2crs_2000);
+            return;
+        }
+
         auto find_iter = _trs2crs_list.find(tdt);
         if (find_iter == _trs2crs_list.end())
         {
@@ -795,21 +1073,21 @@ namespace great
             }
             else
             {
-                GREAT_DEBUG("can't get the crd of" + _crt_rec + " in time" + rec_epo.str_ymdhms());
+                GREAT_DEBUG("can't get the crd of{} in time{}", _crt_rec, rec_epo.str_ymdhms());
                 return false;
             }
         }
 
         if (trs_rec_xyz.zero())
         {
-            GREAT_DEBUG("can't get the crd of" + _crt_rec + " in time" + rec_epo.str_ymdhms());
+            GREAT_DEBUG("can't get the crd of{} in time{}", _crt_rec, rec_epo.str_ymdhms());
             return false;
         }
 
         bool tide_valid = _apply_rec_tides(rec_epo, trs_rec_xyz);
         if (!tide_valid)
         {
-            GREAT_DEBUG("apply tide failed for " + _crt_rec + " in time" + rec_epo.str_ymdhms());
+            GREAT_DEBUG("apply tide failed for {} in time{}", _crt_rec, rec_epo.str_ymdhms());
             return false;
         }
 
@@ -834,7 +1112,13 @@ namespace great
     {
         // ITERATION
         // compute sat coord(CRS)  clk(estimated) (rewrite in orb model)
+        // starting from the light time of prepare_epoch if the satellites were prepared together
         double delay = 0.0;
+        const t_gsatgeo& geo = _geo_entry(_crt_rec, _crt_sat);
+        if (geo.batch_epo == _crt_epo)
+        {
+            delay = geo.batch_delay;
+        }
         Matrix rot_matrix_sat, rot_matrix_rec;
 
         int pv_iod = 0;
@@ -847,12 +1131,12 @@ namespace great
             bool sat_pos_valid = _get_crs_sat_crd(sat_epo, _crt_sat, nav, _crs_sat_crd);
             if (!sat_pos_valid)
             {
-                GREAT_DEBUG("can not get sat pos for " + _crt_sat);
+                GREAT_DEBUG("can not get sat pos for {}", _crt_sat);
                 return false;
             }
             if (double_eq(_crs_sat_crd[0] * _crs_sat_crd[1] * _crs_sat_crd[2], 0.0) || abs(_crs_sat_crd[0]) >= 1E18)
             {
-                GREAT_DEBUG("can not get sat pos for " + _crt_sat);
+                GREAT_DEBUG("can not get sat pos for {}", _crt_sat);
                 return false;
             }
             // SET TRS in epoch TR [include earth rotation]
@@ -862,7 +1146,7 @@ namespace great
             bool sat_vel_valid = _get_crs_sat_vel(sat_epo, _crt_sat, nav, _crs_sat_vel);
             if (!sat_vel_valid)
             {
-                GREAT_DEBUG("can not get sat vel for " + _crt_sat);
+                GREAT_DEBUG("can not get sat vel for {}", _crt_sat);
                 return false;
             }
             // PCO corr sat
@@ -870,9 +1154,9 @@ namespace great
             if (_gallobj != 0)
             {
                 _update_rot_matrix(rec_epo);
-                _crt_obs.addcrd(_trs_sat_crd);
+                _crt_obs->addcrd(_trs_sat_crd);
                 t_gtriple vel = t_gtriple(_trs2crs_2000->getRotMat().t() * _crs_sat_vel.crd_cvect());
-                _crt_obs.addvel(vel);
+                _crt_obs->addvel(vel);
                 shared_ptr<t_gobj> sat_obj = _gallobj->obj(_crt_sat);
                 shared_ptr<t_gobj> rec_obj = _gallobj->obj(_crt_rec);
 
@@ -894,11 +1178,11 @@ namespace great
                     // Satellite phase center offset
                     t_gtriple pco(0, 0, 0);
 
-                    if (sat_pcv->pcoS(_crt_obs, pco, lc, _band_index[_crt_sys][FREQ_1], _band_index[_crt_sys][FREQ_2]) > 0)
+                    if (sat_pcv->pcoS(*_crt_obs, pco, lc, _band_index[_crt_sys][FREQ_1], _band_index[_crt_sys][FREQ_2]) > 0)
                     {
-                        rot_matrix_sat = _RotMatrix_Ant(_crt_obs, _crt_epo, _crt_sat_epo, sat_obj, false);
+                        rot_matrix_sat = _RotMatrix_Ant(*_crt_obs, _crt_epo, _crt_sat_epo, sat_obj, false);
                         t_gtriple dx(rot_matrix_sat * (pco.crd_cvect()));
-                        sat_pcv->pco_proj(pco_S, _crt_obs, _trs_rec_crd, dx);
+                        sat_pcv->pco_proj(pco_S, *_crt_obs, _trs_rec_crd, dx);
                     }
                 }
 
@@ -906,12 +1190,12 @@ namespace great
                 {
                     // Receiver phase center offset
                     t_gtriple pco(0.0, 0.0, 0.0);
-                    if (rec_pcv->pcoR(_crt_obs, pco, lc, _band_index[_crt_sys][FREQ_1], _band_index[_crt_sys][FREQ_2]) > 0)
+                    if (rec_pcv->pcoR(*_crt_obs, pco, lc, _band_index[_crt_sys][FREQ_1], _band_index[_crt_sys][FREQ_2]) > 0)
                     {
-                        rot_matrix_rec = _RotMatrix_Ant(_crt_obs, _crt_epo, _crt_sat_epo, rec_obj, false);
+                        rot_matrix_rec = _RotMatrix_Ant(*_crt_obs, _crt_epo, _crt_sat_epo, rec_obj, false);
                         rot_matrix_rec*(pco.crd_cvect());
                         t_gtriple dx(rot_matrix_rec * (pco.crd_cvect()));
-                        rec_pcv->pco_proj(pco_R, _crt_obs, _trs_rec_crd, dx);
+                        rec_pcv->pco_proj(pco_R, *_crt_obs, _trs_rec_crd, dx);
                     }
                     pco_R *= -1;
                 }
@@ -927,12 +1211,12 @@ namespace great
             }
             delay = delay_temp / CLIGHT;
         }
-        _crt_obs.addSCF2CRS(_trs2crs_2000->getRotMat() * rot_matrix_sat, rot_matrix_sat);
-        _crt_obs.addcrd(_trs_sat_crd);
+        _crt_obs->addSCF2CRS(_trs2crs_2000->getRotMat() * rot_matrix_sat, rot_matrix_sat);
+        _crt_obs->addcrd(_trs_sat_crd);
         t_gtriple vel = t_gtriple(_trs2crs_2000->getRotMat().t() * _crs_sat_vel.crd_cvect());
-        _crt_obs.addvel(vel);
-        _crt_obs.addcrdcrs(_crs_sat_crd);
-        _crt_obs.addvel_crs(_crs_sat_vel);
+        _crt_obs->addvel(vel);
+        _crt_obs->addcrdcrs(_crs_sat_crd);
+        _crt_obs->addvel_crs(_crs_sat_vel);
 
         return true;
     }
@@ -941,7 +1225,7 @@ namespace great
     {
         if (!nav)
         {
-            GREAT_DEBUG("cannot get vel " + sat);
+            GREAT_DEBUG("cannot get vel {}", sat);
             return false;
         }
 
@@ -11,12 +11,14 @@
 #ifndef precisebias_h
 #define precisebias_h
 
+#include <unordered_map>
 #include "gexport/ExportLibGREAT.h"
 #include "gset/gsetbase.h"
 #include "gset/gsetgen.h"
 #include "gmodels/gbiasmodel.h"
 #include "gall/gallproc.h"
 #include "gutils/gtrs2crs.h"
+#include "gutils/gtrs2crsgrid.h"
 #include "gall/gallobj.h"
 #include "gmodels/gtide.h"
 #include "gmodels/gattitudemodel.h"
@@ -60,8 +62,20 @@ namespace great
         /** @brief get relDelay */
         double relDelay(t_gtriple& crd_site, t_gtriple& vel_site, t_gtriple& crd_sat, t_gtriple& vel_sat);
 
-        /** @brief get update obs info */
-        bool _update_obs_info(t_gsatdata& obsdata);
+        /**
+         * @brief light time, positions and clocks of all satellites of the epoch
+         *
+         * The light time is solved for all satellites together with one query of the
+         * navigation data per iteration (approximate receiver position and clock, Sagnac
+         * rotation in the TRS). The positions, velocities and transmit times go to the
+         * satellite data, the clocks to the clock buffer, and the light time is the start
+         * of the iteration of _apply_sat, which then needs one or two steps.
+         *
+         * @param[in]     epoch     current epoch
+         * @param[in]     params    parameters (receiver clock and coordinates)
+         * @param[in,out] obsdata   satellite data of the epoch
+         */
+        void prepare_epoch(const t_gtime& epoch, t_gallpar& params, vector<t_gsatdata>& obsdata) override;
 
         /** @brief reset SatPCO */
         virtual void reset_SatPCO(bool cal = true)
@@ -72,10 +86,60 @@ namespace great
         /** @brief get crt obs */
         virtual t_gsatdata get_crt_obs()
         {
-            return _crt_obs;
+            return _crt_obs ? *_crt_obs : t_gsatdata();
         }
 
     protected:
+        /**
+         * @brief geometry and corrections of one satellite at one epoch
+         *
+         * Filled by the first observation of the satellite in the epoch, the following
+         * observations (other bands, code/phase, next iterations) read it by reference.
+         * The entry is valid while the epoch and the receiver state (clock and coordinate
+         * parameters) used to compute it do not change.
+         */
+        struct t_gsatgeo
+        {
+            t_gtime epo = FIRST_TIME;              ///< epoch of the entry (FIRST_TIME: empty)
+            double rec_clk = 0.0;                  ///< receiver clock parameter used [m]
+            t_gtriple rec_par;                     ///< receiver coordinate parameters used
+            bool sat_pco = true;                   ///< satellite PCO applied
+            t_gtime rec_epo;                       ///< receive time
+            t_gtime sat_epo;                       ///< transmit time
+            double rec_clk_s = 0.0;                ///< receiver clock [s]
+            double sat_clk_s = 0.0;                ///< satellite clock [s]
+            t_gtriple trs_rec_crd;                 ///< receiver crd in TRS (tides, ARP)
+            t_gtriple crs_rec_crd;                 ///< receiver crd in CRS
+            t_gtriple crs_rec_vel;                 ///< receiver vel in CRS
+            t_gtriple crs_rec_pco;                 ///< receiver crd + PCO in CRS
+            t_gtriple trs_sat_crd;                 ///< satellite crd in TRS
+            t_gtriple crs_sat_crd;                 ///< satellite crd in CRS
+            t_gtriple crs_sat_vel;                 ///< satellite vel in CRS
+            t_gtriple crs_sat_pco;                 ///< satellite crd + PCO in CRS
+            t_gsatdata geo;                        ///< clk, rho, angles, windup of the satellite (no observations)
+            vector<pair<int, double>> pcv;         ///< PCO/PCV projection per band and code/phase
+            t_gtime batch_epo = FIRST_TIME;        ///< epoch of the batch light time
+            double batch_delay = 0.0;              ///< light time from prepare_epoch [s]
+        };
+
+        /** @brief entry of the site/satellite in the geometry cache (dense ids) */
+        t_gsatgeo& _geo_entry(const string& site, const string& sat);
+
+        /** @brief entry of the site/satellite if it exists, nullptr otherwise (nothing is added) */
+        t_gsatgeo* _geo_find(const string& site, const string& sat);
+
+        /** @brief receiver state of the entry still the one of the parameters */
+        bool _geo_valid(const t_gsatgeo& geo, const string& site, const t_gtime& epoch, t_gallpar& pars);
+
+        /** @brief store the prepared geometry of the current satellite */
+        void _geo_save(t_gsatgeo& geo, const t_gtime& epoch, t_gallpar& pars, const t_gsatdata& obsdata);
+
+        /** @brief set the current satellite from the entry */
+        void _geo_load(const t_gsatgeo& geo, const t_gtime& epoch, t_gsatdata& obsdata);
+
+        /** @brief receiver clock and coordinate parameters of the current site */
+        void _geo_rec_par(const string& site, t_gallpar& pars, double& clk, t_gtriple& crd);
+
         /** @brief apply rec */
         bool _apply_rec(const t_gtime& crt_epo, const t_gtime& rec_epo, t_gallpar& pars);
 
@@ -129,7 +193,7 @@ namespace great
 
     protected:
         t_gtime _crt_epo;            ///< epoch
-        t_gsatdata _crt_obs;         ///< obs
+        t_gsatdata* _crt_obs = nullptr; ///< obs being processed (caller's object, only set inside cmb_equ)
         shared_ptr<t_gobj> _crt_obj; ///< obj
         t_gtime _crt_rec_epo;        ///< rec epoch
         t_gtime _crt_sat_epo;        ///< transmit epoch
@@ -156,6 +220,7 @@ namespace great
 
         map<t_gtime, shared_ptr<t_gtrs2crs>> _trs2crs_list; ///< trs2crs list
         shared_ptr<t_gtrs2crs> _trs2crs_2000;               ///< trs2crs matrix
+        shared_ptr<t_gtrs2crs_grid> _trs2crs_grid;          ///< interpolated trs2crs (shared by all sites)
         double _minElev;                                    ///< min ele for prepare
 
         Matrix _rot_scf2crs; ///< record scf2crs matrix
@@ -167,7 +232,12 @@ namespace great
         map<string, pair<t_gtime, double>> _obj_clk;    ///< obj clk
         map<string, double> _rec_clk;                   ///< rec clk
         bool _isCalSatPCO = true;                       ///< is Cal Sat PCO
-        tuple<string, string, t_gtime> _rec_sat_before; ///< rec sat before
+
+        unordered_map<string, int> _geo_site_id; ///< dense ids of the sites in the geometry cache
+        unordered_map<string, int> _geo_sat_id;  ///< dense ids of the satellites in the geometry cache
+        vector<vector<t_gsatgeo>> _geo;          ///< geometry cache [site id][satellite id]
+        t_gsatgeo* _crt_geo = nullptr;           ///< entry of the observation being processed (only set inside cmb_equ)
+        const t_gsatgeo* _geo_loaded = nullptr;  ///< entry whose values are held by the _crt_ members
     };
 } // namespace great
 
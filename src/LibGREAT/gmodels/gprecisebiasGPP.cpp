@@ -28,6 +28,15 @@ namespace great
     }
 
     bool t_gprecisebiasGPP::cmb_equ(t_gtime& epoch, t_gallpar& params, t_gsatdata& obsdata, t_gobs& gobs, t_gbaseEquation& result)
+    {
+        // obsdata belongs to the caller (refilled every epoch), do not keep its address
+        bool valid = _cmb_equ_GPP(epoch, params, obsdata, gobs, result);
+        _crt_obs = nullptr;
+        _crt_geo = nullptr;
+        return valid;
+    }
+
+    bool t_gprecisebiasGPP::_cmb_equ_GPP(t_gtime& epoch, t_gallpar& params, t_gsatdata& obsdata, t_gobs& gobs, t_gbaseEquation& result)
     {
         // check obs_type valid
         double Obs_value = obsdata.getobs(gobs.gobs());
@@ -37,9 +46,23 @@ namespace great
             return false;
         }
 
-        tuple<string, string, t_gtime>* flag = &_rec_sat_before;
-        if (make_tuple(obsdata.site(), obsdata.sat(), epoch) != *flag)
+        // satellite geometry computed once per epoch, the observation is processed in place
+        t_gsatgeo& geo = _geo_entry(obsdata.site(), obsdata.sat());
+        if (_geo_valid(geo, obsdata.site(), epoch, params))
         {
+            if (_geo_loaded != &geo)
+            {
+                _crt_sat = obsdata.sat();
+                _crt_rec = obsdata.site();
+                _crt_sys = obsdata.gsys();
+                _crt_obj = _gallobj->obj(_crt_rec);
+            }
+            _crt_obs = &obsdata;
+            _geo_load(geo, epoch, obsdata);
+        }
+        else
+        {
+            _geo_loaded = nullptr;
             bool update_valid = t_gprecisebiasGPP::_update_obs_info_GPP(epoch, _gall_nav, _gallobj, obsdata, params);
             if (!update_valid)
             {
@@ -54,26 +77,32 @@ namespace great
                 GREAT_ERROR("prepare obs information failed" + epoch.str_ymdhms("", false));
                 return false;
             }
-            *flag = make_tuple(obsdata.site(), obsdata.sat(), epoch);
+            _geo_save(geo, epoch, params, obsdata);
         }
+        _crt_geo = &geo;
+        _geo_loaded = &geo;
 
         // combine equ
         double omc = 0.0, wgt = 0.0;
         vector<pair<int, double>> coef;
 
-        if (!_omc_obs_ALL(epoch, _crt_obs, params, gobs, omc))
+        if (!_omc_obs_ALL(epoch, obsdata, params, gobs, omc))
         {
             GREAT_ERROR("omc obs failed");
             return false;
         };
+        if (gobs.is_phase())
+        {
+            geo.geo.addwind(obsdata.wind());
+        }
 
-        if (!_wgt_obs_ALL(t_gdata::REC, gobs, _crt_obs, 1.0, wgt))
+        if (!_wgt_obs_ALL(t_gdata::REC, gobs, obsdata, 1.0, wgt))
         {
             GREAT_ERROR("weight obs failed");
             return false;
         };
 
-        if (!_prt_obs_ALL(epoch, _crt_obs, params, gobs, coef))
+        if (!_prt_obs_ALL(epoch, obsdata, params, gobs, coef))
         {
             GREAT_ERROR("partialrange obs failed");
             return false;
@@ -82,8 +111,6 @@ namespace great
         result.B.push_back(coef);
         result.P.push_back(wgt);
         result.l.push_back(omc);
-
-        _update_obs_info(obsdata);
         return true;
     }
 
@@ -157,8 +184,35 @@ namespace great
         auto band_1 = _band_index[gsatdata.gsys()][FREQ_1];
         ion = ionoDelay(epoch, param, gsatdata, _ion_model, band_1, gobs);
 
-        // pcv correction
-        double pcv = PCV(_corrt_sat_pcv, _corrt_rec_pcv, epoch, _crt_sat_epo, _trs_rec_crd, gsatdata, gobs);
+        // pcv correction (same for all observations of the band in the epoch)
+        double pcv = 0.0;
+        bool pcv_cached = false;
+        int pcv_key = 2 * gobs.band() + (gobs.is_phase() ? 1 : 0);
+        t_gsatgeo* geo = _geo_find(rec, sat);
+        if (geo && geo != _crt_geo && !_geo_valid(*geo, rec, epoch, param))
+        {
+            geo = nullptr; // outside cmb_equ the entry of the satellite is checked here
+        }
+        if (geo)
+        {
+            for (const auto& item : geo->pcv)
+            {
+                if (item.first == pcv_key)
+                {
+                    pcv = item.second;
+                    pcv_cached = true;
+                    break;
+                }
+            }
+        }
+        if (!pcv_cached)
+        {
+            pcv = PCV(_corrt_sat_pcv, _corrt_rec_pcv, epoch, _crt_sat_epo, _trs_rec_crd, gsatdata, gobs);
+            if (geo && geo == _geo_loaded)
+            {
+                geo->pcv.push_back(make_pair(pcv_key, pcv)); // computed from the values of this entry
+            }
+        }
 
         // jdhuang, OMC
 // #define DEBUG_OMC
@@ -201,7 +255,7 @@ namespace great
 
         // compute reciver time
         _crt_rec_epo = crt_epo - _crt_rec_clk;
-        _crt_obs.addrecTime(_crt_rec_epo);
+        _crt_obs->addrecTime(_crt_rec_epo);
 
         // get Rec crd
         bool apply_obj_valid = t_gprecisebias::_apply_rec(crt_epo, _crt_rec_epo, pars);
@@ -218,7 +272,7 @@ namespace great
             GREAT_ERROR("can not apply sat in " + crt_epo.str_ymdhms());
             return false;
         }
-        _crt_obs.addsatTime(_crt_sat_epo);
+        _crt_obs->addsatTime(_crt_sat_epo);
 
         // get f01 PCO
         this->_crs_rec_pco = this->_crs_rec_crd;
@@ -239,9 +293,9 @@ namespace great
         {
             // Satellite phase center offset
             t_gtriple pco(0, 0, 0);
-            if (sat_pcv->pcoS(_crt_obs, pco, _observ, _band_index[_crt_sys][FREQ_1], _band_index[_crt_sys][FREQ_2]) > 0)
+            if (sat_pcv->pcoS(*_crt_obs, pco, _observ, _band_index[_crt_sys][FREQ_1], _band_index[_crt_sys][FREQ_2]) > 0)
             {
-                Matrix _rot_matrix = _RotMatrix_Ant(_crt_obs, _crt_epo, _crt_sat_epo, sat_obj, true);
+                Matrix _rot_matrix = _RotMatrix_Ant(*_crt_obs, _crt_epo, _crt_sat_epo, sat_obj, true);
                 this->_crs_sat_pco += t_gtriple(_rot_matrix * pco.crd_cvect());
             }
         }
@@ -250,9 +304,9 @@ namespace great
         {
             // Receiver phase center offset
             t_gtriple pco(0.0, 0.0, 0.0);
-            if (rec_pcv->pcoR(_crt_obs, pco, _observ, _band_index[_crt_sys][FREQ_1], _band_index[_crt_sys][FREQ_2]) > 0)
+            if (rec_pcv->pcoR(*_crt_obs, pco, _observ, _band_index[_crt_sys][FREQ_1], _band_index[_crt_sys][FREQ_2]) > 0)
             {
-                Matrix _rot_matrix = _RotMatrix_Ant(_crt_obs, _crt_epo, _crt_rec_epo, rec_obj, true);
+                Matrix _rot_matrix = _RotMatrix_Ant(*_crt_obs, _crt_epo, _crt_rec_epo, rec_obj, true);
                 this->_crs_rec_pco += t_gtriple(_rot_matrix * pco.crd_cvect());
             }
         }
@@ -262,56 +316,56 @@ namespace great
         // compute reldelay[m]
         double reldelay = relDelay(this->_crs_rec_pco, this->_crs_rec_vel, this->_crs_sat_pco, this->_crs_sat_vel);
 
-        _crt_obs.addclk(sat_clk * CLIGHT - reldelay);
-        _crt_obs.addreldelay(reldelay);
+        _crt_obs->addclk(sat_clk * CLIGHT - reldelay);
+        _crt_obs->addreldelay(reldelay);
 
         // addrho
         double tmp = (_crs_sat_crd - _crs_rec_crd).norm();
-        _crt_obs.addrho(tmp);
+        _crt_obs->addrho(tmp);
 
         // add drate
-        _crt_obs.adddrate((DotProduct((_crs_sat_vel - _crs_rec_vel).crd_cvect(), (_crs_sat_pco - _crs_rec_pco).crd_cvect())) /
+        _crt_obs->adddrate((DotProduct((_crs_sat_vel - _crs_rec_vel).crd_cvect(), (_crs_sat_pco - _crs_rec_pco).crd_cvect())) /
                           (CLIGHT * tmp));
 
         // add azim && elev
         t_gtriple xyz_rho = _crs_sat_pco - _crs_rec_pco;
         t_gtriple ell_r, neu_s;
 
-        Matrix _rot_ant2crs = _RotMatrix_Ant(_crt_obs, _crt_rec_epo, _crt_rec_epo, _crt_obj, true);
+        Matrix _rot_ant2crs = _RotMatrix_Ant(*_crt_obs, _crt_rec_epo, _crt_rec_epo, _crt_obj, true);
         neu_s = t_gtriple(_rot_ant2crs.t() * xyz_rho.crd_cvect());
         double NE2 = neu_s[0] * neu_s[0] + neu_s[1] * neu_s[1];
-        double ele = acos(sqrt(NE2) / _crt_obs.rho());
-        if (sqrt(NE2) / _crt_obs.rho() > 1.0)
+        double ele = acos(sqrt(NE2) / _crt_obs->rho());
+        if (sqrt(NE2) / _crt_obs->rho() > 1.0)
         {
-            _crt_obs.addele(0.0);
+            _crt_obs->addele(0.0);
         }
         else
         {
-            _crt_obs.addele(ele);
+            _crt_obs->addele(ele);
         }
 
         double offnadir = dotproduct(xyz_rho.crd_cvect(), _crs_sat_pco.crd_cvect()) / xyz_rho.norm() / _crs_sat_pco.norm();
         offnadir = acos(offnadir);
-        _crt_obs.addnadir(offnadir);
-        _crt_obs.addzen_sat(offnadir);
+        _crt_obs->addnadir(offnadir);
+        _crt_obs->addzen_sat(offnadir);
 
         double azi = atan2(neu_s[1], neu_s[0]);
         if (azi < 0)
         {
             azi += 2 * G_PI;
         }
-        _crt_obs.addazi_rec(azi);
-        _crt_obs.addzen_rec((G_PI / 2.0 - ele));
+        _crt_obs->addazi_rec(azi);
+        _crt_obs->addzen_rec((G_PI / 2.0 - ele));
 
         /// for satellite-side azimuth
-        Matrix _rot_matrix_scf2crs = _RotMatrix_Ant(_crt_obs, _crt_epo, _crt_sat_epo, sat_obj, true);
+        Matrix _rot_matrix_scf2crs = _RotMatrix_Ant(*_crt_obs, _crt_epo, _crt_sat_epo, sat_obj, true);
         t_gtriple xyz_s2r = t_gtriple(_rot_matrix_scf2crs.t() * ((-1) * xyz_rho.crd_cvect())); // from sat. to rec. in SCF XYZ
         double azi_sat = atan2(xyz_s2r[0], xyz_s2r[1]);
         if (azi_sat < 0)
         {
             azi_sat += 2 * G_PI;
         }
-        _crt_obs.addazi_sat(azi_sat);
+        _crt_obs->addazi_sat(azi_sat);
 
         /// add for another elev and azi used in calculating weight matric
         t_gtriple xyz_rh = _trs_sat_crd - _trs_rec_crd;
@@ -324,12 +378,12 @@ namespace great
         xRec[1] = _trs_rec_crd[1] * cos(dPhi) + _trs_rec_crd[0] * sin(dPhi);
         xRec[2] = _trs_rec_crd[2];
         double NE2_ = neu_sa[0] * neu_sa[0] + neu_sa[1] * neu_sa[1];
-        double ele_ = acos(sqrt(NE2_) / _crt_obs.rho());
+        double ele_ = acos(sqrt(NE2_) / _crt_obs->rho());
 
-        _crt_obs.addele_leo(ele_);
+        _crt_obs->addele_leo(ele_);
 
         // check elevation cut-off
-        if (_crt_obj->id_type() == t_gdata::REC && _crt_obs.ele_deg() < _minElev)
+        if (_crt_obj->id_type() == t_gdata::REC && _crt_obs->ele_deg() < _minElev)
         {
             GREAT_WARN("Prepare fail! the elevation is too small");
             return false;
@@ -352,7 +406,7 @@ namespace great
 
         // Some frequently used variables are also defined here.
         _crt_epo = epoch;
-        _crt_obs = obsdata;
+        _crt_obs = &obsdata;
         _crt_sat = obsdata.sat();
         _crt_rec = obsdata.site();
         _crt_sys = obsdata.gsys();
@@ -392,7 +446,6 @@ namespace great
         double dclk = 0.0;
         string type = obj.substr(0, 3);
         string name = obj.substr(3);
-        int base_size = dynamic_cast<t_gsetgen*>(_gset)->list_base().size();
         int pv_iod = 0; // to do
         int clk_iod = 0;
 
@@ -451,9 +504,9 @@ namespace great
         auto par_list = pars.getPartialIndex(_crt_rec, _crt_sat);
         for (const int& ipar : par_list)
         {
-            t_gpar par = pars.getPar(ipar);
+            const t_gpar& par = pars.getPar(ipar);
             double coeff_value = 0.0;
-            t_gbiasmodel::_Partial_basic(crt_epo, _crt_obs, gobs, par, coeff_value);
+            t_gbiasmodel::_Partial_basic(crt_epo, obsdata, gobs, par, coeff_value);
             if (coeff_value != 0.0)
             {
                 coeff.push_back(make_pair(ipar + 1, coeff_value));
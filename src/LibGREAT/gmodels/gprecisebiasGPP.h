@@ -95,6 +95,18 @@ namespace great
                                  map<string, pair<t_gtime, double>>& obj_clk);
 
     protected:
+        /**
+         * @brief combine EQU with obsdata as the current observation (cmb_equ).
+         *
+         * @param[in]  epoch            the current time
+         * @param[in]  params           the parameters
+         * @param[in]  obsdata          the observation data
+         * @param[in]  gobs             the observation object
+         * @param[in]  result           the EQU result
+         * @return     bool             combine EQU mode
+         */
+        bool _cmb_equ_GPP(t_gtime& epoch, t_gallpar& params, t_gsatdata& obsdata, t_gobs& gobs, t_gbaseEquation& result);
+
         /**
          * @brief compute obs.
          *
@@ -42,8 +42,8 @@ namespace great
         t_gtime epo_tt = epo;
         epo_tt.tsys(t_gtime::TT);
         double mjd = epo_tt.dmjd();
-        nav_planet->get_pos(mjd, "SUN", sun_pos);
-        nav_planet->get_pos(mjd, "MOON", moon_pos);
+        nav_planet->get_pos(mjd, PLANET_SUN, sun_pos);
+        nav_planet->get_pos(mjd, PLANET_MOON, moon_pos);
 
         // change to TRS, unit: km
         sun_pos = rot_trs2crs.t() * sun_pos;
@@ -110,4 +110,55 @@ namespace great
         return _obstypelist[equ_idx];
     }
 
+    int t_gfltEquationMatrix::remove_sat(const string& sat_name, t_gfltEquationMatrix& removed)
+    {
+        int nkeep = 0;
+        for (int i = 0; i < num_equ(); i++)
+        {
+            if (_site_sat_pairlist[i].second == sat_name)
+            {
+                removed.add_equ(B[i], P[i], l[i], _site_sat_pairlist[i].first, sat_name, _obstypelist[i], _newamb_list[i]);
+                continue;
+            }
+            if (nkeep != i)
+            {
+                B[nkeep].swap(B[i]);
+                P[nkeep] = P[i];
+                l[nkeep] = l[i];
+                _site_sat_pairlist[nkeep] = _site_sat_pairlist[i];
+                _obstypelist[nkeep] = _obstypelist[i];
+                _newamb_list[nkeep] = _newamb_list[i];
+            }
+            nkeep++;
+        }
+
+        B.resize(nkeep);
+        P.resize(nkeep);
+        l.resize(nkeep);
+        _site_sat_pairlist.resize(nkeep);
+        _obstypelist.resize(nkeep, t_gobscombtype());
+        _newamb_list.resize(nkeep);
+        return removed.num_equ();
+    }
+
+    void t_gfltEquationMatrix::remove_par(int par_idx)
+    {
+        for (auto& row : B)
+        {
+            for (auto it = row.begin(); it != row.end();)
+            {
+                if (it->first == par_idx)
+                {
+                    it = row.erase(it);
+                    continue;
+                }
+                if (it->first > par_idx)
+                {
+                    it->first--;
+                }
+                ++it;
+            }
+        }
+    }
+
 } // namespace great
@@ -84,6 +84,20 @@ namespace great
          */
         t_gobscombtype get_obscombtype(int equ_idx) const;
 
+        /**
+         * @brief split off the equations of a satellite
+         * @param[in]  sat_name  satellite
+         * @param[out] removed   equations of the satellite
+         * @return number of removed equations
+         */
+        int remove_sat(const string& sat_name, t_gfltEquationMatrix& removed);
+
+        /**
+         * @brief remove a parameter column, following columns are shifted
+         * @param[in]  par_idx   parameter index (from 1)
+         */
+        void remove_par(int par_idx);
+
     protected:
         vector<pair<string, string>> _site_sat_pairlist; ///< station & satellite name
         vector<t_gobscombtype> _obstypelist;             ///< observation type
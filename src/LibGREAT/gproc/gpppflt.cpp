@@ -29,6 +29,8 @@ namespace gnut
         t_gxml("kml"),
         _read(false),
         _flt(0),
+        _fltout(0),
+        _kmlout(0),
         _kml(false),
         _beg_end(true)
     {
@@ -95,6 +97,11 @@ namespace gnut
             delete _grdStoModel;
         }
 
+        if (_fltout)
+        {
+            delete _fltout;
+        }
+
         if (_flt)
         {
             if (_flt->is_open())
@@ -104,7 +111,12 @@ namespace gnut
             delete _flt;
         }
 
-        this->write(_kml_name);
+        if (_kmlout)
+        {
+            xml_node document = _doc.child(_root.c_str()).child("Document");
+            _kmlout->close(document.child("Placemark"));
+            delete _kmlout;
+        }
     }
 
     void t_gpppflt::_timeUpdate(const t_gtime& epo)
@@ -210,6 +222,8 @@ namespace gnut
     void t_gpppflt::_setOut()
     {
         string tmp;
+        int buffer = dynamic_cast<t_gsetout*>(_set)->buffer_size();
+        double flush = dynamic_cast<t_gsetout*>(_set)->flush_interval();
         tmp = dynamic_cast<t_gsetout*>(_set)->outputs("flt");
         if (!tmp.empty() && !_read)
         {
@@ -218,6 +232,7 @@ namespace gnut
             _flt->tsys(t_gtime::GPS);
             _flt->mask(tmp);
             _flt->append(dynamic_cast<t_gsetout*>(_set)->append());
+            _fltout = new t_gasyncout(_flt, buffer, flush);
         }
 
         tmp = dynamic_cast<t_gsetout*>(_set)->outputs("kml");
@@ -291,6 +306,14 @@ namespace gnut
             IconStyle = this->_default_node(doc_style6, "IconStyle");
             this->_default_node(IconStyle, "color", "ff0000ff", true);
 
+            // the head is written now, epoch placemarks by _prtOut, the track when closed
+            _kmlout = new t_gkmlout(_kml_name, buffer, flush);
+            _kmlout->begin(document);
+            while (document.first_child())
+            {
+                document.remove_child(document.first_child());
+            }
+
             placemark = this->_default_node(document, "Placemark");
             this->_default_node(placemark, "name", "Trajection", false);
             xml_node style = this->_default_node(placemark, "Style");
@@ -16,6 +16,8 @@
 #include "gproc/gppp.h"
 #include "gproc/gsppflt.h"
 #include "gio/gxml.h"
+#include "gio/gasyncout.h"
+#include "gio/gkmlout.h"
 
 namespace gnut
 {
@@ -55,7 +57,9 @@ namespace gnut
         xml_node line;                ///< working line read from
         bool _read;                   ///< is read
         t_giof* _flt;                 ///< filter file
+        t_gasyncout* _fltout;         ///< buffered output of the filter file
         string _kml_name;             ///< kml name
+        t_gkmlout* _kmlout;           ///< kml written epoch by epoch
         bool _kml;                    ///< is kml
         bool _beg_end;                ///< processing direction
         t_randomwalk* _grdStoModel;   ///< tropo gradient models
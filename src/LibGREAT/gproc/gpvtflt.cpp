@@ -16,7 +16,7 @@
 #include "gproc/gqualitycontrol.h"
 #include "gio/great_log.h"
 
-great::t_gpvtflt::t_gpvtflt(string mark, string mark_base, t_gsetbase* gset, t_gallproc* allproc) :
+great::t_gpvtflt::t_gpvtflt(string mark, string mark_base, t_gsetbase* gset, const shared_ptr<const t_gsetsnap>& snap, t_gallproc* allproc) :
     t_gspp(mark, gset),
     t_gpppflt(mark, gset),
     _fix_mode(FIX_MODE::NO),
@@ -25,11 +25,16 @@ great::t_gpvtflt::t_gpvtflt(string mark, string mark_base, t_gsetbase* gset, t_g
     _site_base(mark_base),
     _gModel_base(nullptr),
     _allproc(allproc),
-    _gquality_control(gset, nullptr)
+    _gquality_control(gset, nullptr),
+    _snap(snap)
 {
     _vel = t_gtriple(0, 0, 0);
     _Qx_vel.ReSize(4);
     _Qx_vel = 0.0;
+    if (!_snap)
+    {
+        _snap = make_shared<const t_gsetsnap>(_set);
+    }
     _dclkStoModel = new t_whitenoise(dynamic_cast<t_gsetflt*>(_set)->noise_dclk());
     _velStoModel = new t_whitenoise(dynamic_cast<t_gsetflt*>(_set)->noise_vel());
     _fix_mode = dynamic_cast<t_gsetamb*>(_set)->fix_mode();
@@ -489,20 +494,20 @@ int great::t_gpvtflt::_combineDD(Matrix& A, SymmetricMatrix& P, ColumnVector& l)
         _obs_index.clear();
         int iobs = 1;
 
-        set<string> sysall = dynamic_cast<t_gsetgen*>(_set)->sys();
+        const set<string>& sysall = _snap->sys();
 
         int nrows = A.Nrows();
         Matrix DD;
         DD.ReSize(nrows, nrows);
         DD = 0.0;
         _sat_ref.clear();
-        bool isSetRefSat = dynamic_cast<t_gsetamb*>(_set)->isSetRefSat();
+        bool isSetRefSat = _snap->isSetRefSat();
 
         bool isPhaseProcess = true;
         for (auto sys_iter = sysall.begin(); sys_iter != sysall.end(); sys_iter++)
         {
             enum GSYS sys = t_gsys::str2gsys(*sys_iter);
-            vector<GOBSBAND> band = dynamic_cast<t_gsetgnss*>(_set)->band(sys);
+            const vector<GOBSBAND>& band = _snap->band(sys);
             int nf = 5;
             if (band.size())
             {
@@ -677,6 +682,7 @@ int great::t_gpvtflt::_combineDD(Matrix& A, SymmetricMatrix& P, ColumnVector& l)
             _delPar(par_type::AMB_L5);
             _delPar(par_type::SION);
             _delPar(par_type::VION);
+            _Qslot.commit();
             return -1;
         }
 
@@ -943,7 +949,7 @@ int great::t_gpvtflt::_prepareData()
 
     if (_data.size() < _minsat)
     {
-        GREAT_INFO(_site + _epoch.str_ymdhms(" epoch ") + int2str(_data.size()) + " skipped (data.size < minsat)");
+        GREAT_INFO("{}{}{} skipped (data.size < minsat)", _site, _epoch.str_ymdhms(" epoch "), _data.size());
         return -1;
     }
 
@@ -960,7 +966,7 @@ int great::t_gpvtflt::_preprocess(const string& ssite, vector<t_gsatdata>& sdata
     vector<t_gsatdata>::iterator iter = sdata.begin();
 
     _nSat = sdata.size();
-    set<string> sat_rm = dynamic_cast<t_gsetgen*>(_set)->sat_rm();
+    const set<string>& sat_rm = _snap->sat_rm();
     while (iter != sdata.end())
     {
         // except sat from config file
@@ -996,8 +1002,8 @@ int great::t_gpvtflt::_preprocess(const string& ssite, vector<t_gsatdata>& sdata
 
     if (sdata.size() < _minsat)
     {
-        GREAT_INFO(_epoch.str_ymdhms(ssite + " epoch ") + " skipped (Bancroft not calculated: " + int2str(sdata.size()) +
-                   " < _minsat: " + int2str(_minsat) + ")");
+        GREAT_INFO("{} skipped (Bancroft not calculated: {} < _minsat: {})", _epoch.str_ymdhms(ssite + " epoch "), sdata.size(),
+                   _minsat);
         return -1;
     }
 
@@ -1005,7 +1011,7 @@ int great::t_gpvtflt::_preprocess(const string& ssite, vector<t_gsatdata>& sdata
 
     if (BB.Nrows() < static_cast<int>(_minsat))
     {
-        GREAT_TRACE(_epoch.str_ymdhms(_site + " epoch ") + " skipped (Bancroft not calculated: BB.Nrows < _minsat)");
+        GREAT_TRACE("{} skipped (Bancroft not calculated: BB.Nrows < _minsat)", _epoch.str_ymdhms(_site + " epoch "));
         return -1;
     }
 
@@ -1023,7 +1029,7 @@ int great::t_gpvtflt::_preprocess(const string& ssite, vector<t_gsatdata>& sdata
             iter = sdata.erase(iter);
             if (sdata.size() < _minsat)
             {
-                GREAT_INFO(ssite + _epoch.str_ymdhms(" epoch ") + int2str(sdata.size()) + " skipped (data.size < _rtk_set->minsat)");
+                GREAT_INFO("{}{}{} skipped (data.size < _rtk_set->minsat)", ssite, _epoch.str_ymdhms(" epoch "), sdata.size());
                 return -1;
             }
         }
@@ -1082,7 +1088,7 @@ void great::t_gpvtflt::_predict(const t_gtime& runEpoch)
         _syncIFB();
     }
 
-    _Noise.ReSize(_Qx.Nrows());
+    _Noise.ReSize(_Qslot.size());
     _Noise = 0;
 
     // Predict ambiguity
@@ -1092,6 +1098,9 @@ void great::t_gpvtflt::_predict(const t_gtime& runEpoch)
         _syncAmb();
     }
 
+    // parameters added/removed above, compacted once
+    _Qslot.commit();
+
     _predictCrd();
     _predictClk();
     _predictBias();
@@ -1107,7 +1116,7 @@ void great::t_gpvtflt::_delPar(const par_type par)
     {
         if (_param[i].parType == par)
         {
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
             i--;
@@ -1122,14 +1131,6 @@ int great::t_gpvtflt::_combineMW(t_gsatdata& satdata)
     string sat = satdata.sat();
     double obs_intv = _sampling;
     t_gtime crt_time = _epoch;
-    if (crt_time == _beg_time)
-    {
-        _MW[crt_time - obs_intv][sat][1] = 0.0;
-        _MW[crt_time - obs_intv][sat][2] = 0.0;
-        _MW[crt_time - obs_intv][sat][3] = 0.0;
-        _MW[crt_time - obs_intv][sat][4] = 0.0;
-        _MW[crt_time - obs_intv][sat][5] = 0.0; // ele
-    }
 
     GOBSBAND b1, b2;
     if (_auto_band)
@@ -1142,7 +1143,7 @@ int great::t_gpvtflt::_combineMW(t_gsatdata& satdata)
     }
     else
     { // select fix defined band according the table
-        vector<GOBSBAND> band = dynamic_cast<t_gsetgnss*>(_set)->band(satdata.gsys());
+        const vector<GOBSBAND>& band = _snap->band(satdata.gsys());
         if (band.size())
         {
             b1 = band[0];
@@ -1199,45 +1200,10 @@ int great::t_gpvtflt::_combineMW(t_gsatdata& satdata)
         }
     }
 
-    if (!double_eq(mw_obs, 0.0))
+    // calculate smooth MW, continued from the previous epoch unless slip (zero wl is excluded)
+    _MW.add(sat, crt_time, crt_time - obs_intv, mw_obs, satdata.ele_deg(), islip);
+    if (double_eq(mw_obs, 0.0))
     {
-        // calculate smooth MW
-        t_gtime pre_time = crt_time - obs_intv;
-        if (_MW.find(pre_time) != _MW.end() && _MW[pre_time].find(sat) != _MW[pre_time].end() && !double_eq(_MW[pre_time][sat][4], 0.0) &&
-            !islip)
-        {
-            _MW[crt_time][sat][1] = _MW[pre_time][sat][1] + 1;
-            _MW[crt_time][sat][4] = mw_obs;
-            if (!double_eq(_MW[crt_time][sat][1], 1.0) && _MW[crt_time][sat][1] > 1.0)
-            {
-                _MW[crt_time][sat][3] = _MW[pre_time][sat][3] * (_MW[crt_time][sat][1] - 2) / (_MW[crt_time][sat][1] - 1) +
-                                        pow(mw_obs - _MW[pre_time][sat][2], 2) / _MW[crt_time][sat][1];
-            }
-            else
-            {
-                _MW[crt_time][sat][3] = _MW[pre_time][sat][3];
-            }
-            _MW[crt_time][sat][2] = _MW[pre_time][sat][2] + (mw_obs - _MW[pre_time][sat][2]) / _MW[crt_time][sat][1];
-            _MW[crt_time][sat][5] = satdata.ele_deg();
-        }
-        // exclude mw begining ,it is different from last all
-        else
-        {
-            _MW[crt_time][sat][1] = 1;
-            _MW[crt_time][sat][4] = mw_obs;
-            _MW[crt_time][sat][3] = 0.0;
-            _MW[crt_time][sat][2] = mw_obs / _MW[crt_time][sat][1];
-            _MW[crt_time][sat][5] = satdata.ele_deg();
-        }
-    }
-    // exclude zero wl
-    else
-    {
-        _MW[crt_time][sat][1] = 0.0;
-        _MW[crt_time][sat][2] = 0.0;
-        _MW[crt_time][sat][3] = 0.0;
-        _MW[crt_time][sat][4] = 0.0;
-        _MW[crt_time][sat][5] = 0.0;
         return -1;
     }
 
@@ -1387,7 +1353,7 @@ int great::t_gpvtflt::_processEpoch(const t_gtime& runEpoch)
     SymmetricMatrix P;
     ColumnVector l, dx;
     ColumnVector v_norm;
-    SymmetricMatrix Qsav, QsavBP;
+    SymmetricMatrix Qsav, QsavBP, Qupd;
     t_gallpar XsavBP;
     double vtpv;
     int nobs_total, npar_number;
@@ -1491,7 +1457,15 @@ int great::t_gpvtflt::_processEpoch(const t_gtime& runEpoch)
 
         try
         {
-            _filter->update(A, P, l, dx, _Qx);
+            // undifferenced observations are uncorrelated, the sparse rows are used directly
+            if (_isBase)
+            {
+                _filter->update(A, P, l, dx, _Qx);
+            }
+            else
+            {
+                _filter->update(equ.B, equ.P, equ.l, dx, _Qx);
+            }
         }
         catch (...)
         {
@@ -1499,6 +1473,7 @@ int great::t_gpvtflt::_processEpoch(const t_gtime& runEpoch)
             _Qx = Qsav;
             return -1;
         }
+        Qupd = _Qx;
 
         // increasing variance after update in case of introducing new ambiguity
         if (_cntrep == 1 && !_reset_amb && !_reset_par && !_pos_kin)
@@ -1531,6 +1506,15 @@ int great::t_gpvtflt::_processEpoch(const t_gtime& runEpoch)
             }
         }
         _posterioriTest(A, P, l, dx, _Qx, v_norm, vtpv);
+
+        // outliers of undifferenced observations are removed with the equations already
+        // computed, the others (or a failed update) go through a new iteration
+        if (!_isBase)
+        {
+            while (_outlierRemove(equ, Qsav, Qupd, A, P, l, dx, v_norm, vtpv))
+            {
+            }
+        }
         nobs_total = A.Nrows();
         npar_number = A.ncols();
         _realnobs = l.size();
@@ -1550,7 +1534,7 @@ int great::t_gpvtflt::_processEpoch(const t_gtime& runEpoch)
 
     if (_data.size() < _minsat)
     {
-        GREAT_INFO(_site + _epoch.str_ymdhms(" epoch ") + " skipped: " + int2str(_data.size()) + " < _minsat)");
+        GREAT_INFO("{}{} skipped: {} < _minsat)", _site, _epoch.str_ymdhms(" epoch "), _data.size());
         _restore(QsavBP, XsavBP);
         return -1;
     }
@@ -1626,7 +1610,8 @@ int great::t_gpvtflt::_amb_resolution()
         _ambfix->setActiveAmb(_filter->npar_number());
         if (_observ == OBSCOMBIN::IONO_FREE)
         {
-            _ambfix->setMW(_MW[_epoch]);
+            map<string, map<int, double>> mw = _MW.epoch(_epoch);
+            _ambfix->setMW(mw);
         }
         else
         {
@@ -1635,7 +1620,7 @@ int great::t_gpvtflt::_amb_resolution()
         }
 
         // getting the reference satellite
-        bool isSetRefSat = dynamic_cast<t_gsetamb*>(_set)->isSetRefSat();
+        bool isSetRefSat = _snap->isSetRefSat();
         if (isSetRefSat && !_isBase)
         { // ppp mode
             bool ref_valid = _getSatRef();
@@ -1671,7 +1656,7 @@ int great::t_gpvtflt::_amb_resolution()
         if (nlfix_valid < 0)
         {
             _amb_state = false;
-            GREAT_INFO(_site + _epoch.str_ymdhms(" epoch ") + ": fix ambiguity failed !");
+            GREAT_INFO("{}{}: fix ambiguity failed !", _site, _epoch.str_ymdhms(" epoch "));
         }
         else
         {
@@ -1707,10 +1692,9 @@ int great::t_gpvtflt::_amb_resolution()
     }
 
     // Print flt results
-    if (_flt)
+    if (_fltout)
     {
-        _flt->write(os.str().c_str(), os.str().size());
-        _flt->flush();
+        _fltout->write(os.str());
     }
 
     return 1;
@@ -1719,23 +1703,23 @@ int great::t_gpvtflt::_amb_resolution()
 bool t_gpvtflt::_getSatRef()
 {
     _sat_ref.clear();
-    one_epoch_upd wl_upd, nl_upd, ewl_upd;
+    int wl_epo = -1, nl_epo = -1, ewl_epo = -1;
 
     if (_gupd)
     {
-        wl_upd = _gupd->get_epo_upd(UPDTYPE::WL, _wl_Upd_time);
-        ewl_upd = _gupd->get_epo_upd(UPDTYPE::EWL, _ewl_Upd_time);
+        wl_epo = _gupd->epo_index(UPDTYPE::WL, _wl_Upd_time);
+        ewl_epo = _gupd->epo_index(UPDTYPE::EWL, _ewl_Upd_time);
         if (_upd_mode == UPD_MODE::UPD)
         {
-            nl_upd = _gupd->get_epo_upd(UPDTYPE::NL, _epoch);
-            if (wl_upd.size() == 0 || nl_upd.size() == 0)
+            nl_epo = _gupd->epo_index(UPDTYPE::NL, _epoch);
+            if (wl_epo < 0 || nl_epo < 0)
             {
                 return false;
             }
         }
     }
     t_gallpar params_ALL = _filter->param();
-    set<string> sysall = dynamic_cast<t_gsetgen*>(_set)->sys();
+    const set<string>& sysall = _snap->sys();
     for (auto sys_iter = sysall.begin(); sys_iter != sysall.end(); sys_iter++)
     {
         GSYS sys = t_gsys::str2gsys(*sys_iter);
@@ -1767,18 +1751,21 @@ bool t_gpvtflt::_getSatRef()
                 }
             }
 
-            if (_upd_mode == UPD_MODE::UPD)
+            if (_upd_mode == UPD_MODE::UPD && _gupd)
             {
-                if (_gupd && _frequency >= 3 &&
-                    (ewl_upd.find(params_ALL[i].prn) == ewl_upd.end() || ewl_upd[params_ALL[i].prn]->npoint <= 2))
+                int sat = _gupd->sat_index(params_ALL[i].prn);
+                const t_updrec* ewl_upd = _gupd->sat_upd(UPDTYPE::EWL, ewl_epo, sat);
+                const t_updrec* wl_upd = _gupd->sat_upd(UPDTYPE::WL, wl_epo, sat);
+                const t_updrec* nl_upd = _gupd->sat_upd(UPDTYPE::NL, nl_epo, sat);
+                if (_frequency >= 3 && (ewl_upd == nullptr || ewl_upd->npoint <= 2))
                 {
                     continue;
                 }
-                if (_gupd && !(wl_upd.find(params_ALL[i].prn) != wl_upd.end() && nl_upd.find(params_ALL[i].prn) != nl_upd.end()))
+                if (!(wl_upd != nullptr && nl_upd != nullptr))
                 {
                     continue;
                 }
-                if (_gupd && !(wl_upd[params_ALL[i].prn]->npoint > 2))
+                if (!(wl_upd->npoint > 2))
                 {
                     continue;
                 }
@@ -1830,11 +1817,13 @@ int great::t_gpvtflt::_outlierDetect(const ColumnVector& v, const SymmetricMatri
     {
         _Qx = Qsav;
         sat = _obs_index[idx - 1].first;
-        string obsType = gobstype2str(_obs_index[idx - 1].second.second);
-        ostringstream os;
-        os << _site << " outlier (" << obsType << _obs_index[idx - 1].second.first << ") " << sat << " v: " << fixed << setw(16) << right
-           << setprecision(3) << max;
-        GREAT_INFO(_epoch.str_ymdhms(" epoch ") + os.str());
+        GREAT_INFO("{}{} outlier ({}{}) {} v: {:>16.3f}",
+                   _epoch.str_ymdhms(" epoch "),
+                   _site,
+                   gobstype2str(_obs_index[idx - 1].second.second),
+                   static_cast<int>(_obs_index[idx - 1].second.first),
+                   sat,
+                   max);
     }
     else
     {
@@ -1844,6 +1833,106 @@ int great::t_gpvtflt::_outlierDetect(const ColumnVector& v, const SymmetricMatri
     return idx;
 }
 
+bool great::t_gpvtflt::_outlierRemove(t_gfltEquationMatrix& equ,
+                                     SymmetricMatrix& Qsav,
+                                     SymmetricMatrix& Qupd,
+                                     Matrix& A,
+                                     SymmetricMatrix& P,
+                                     ColumnVector& l,
+                                     ColumnVector& dx,
+                                     ColumnVector& v_norm,
+                                     double& vtpv)
+{
+    // same selection as _outlierDetect
+    int nobs = v_norm.Nrows();
+    double max = 0.0;
+    int idx = 0;
+    for (int i = 1; i <= nobs; i++)
+    {
+        if (fabs(v_norm(i)) > max && fabs(v_norm(i)) > _max_res_norm)
+        {
+            max = fabs(v_norm(i));
+            idx = i;
+        }
+    }
+    if (idx == 0 || idx > (int)_obs_index.size())
+    {
+        return false;
+    }
+    string sat = _obs_index[idx - 1].first;
+
+    // the last satellite of a system changes the system parameters, left to a new iteration
+    GSYS gs = t_gsys::sat2gsys(sat);
+    int nsys = count_if(_data.begin(), _data.end(), [gs](const t_gsatdata& d) { return d.gsys() == gs; });
+    if (nsys < 2)
+    {
+        return false;
+    }
+
+    // observations and parameters of the satellite (not observed any more, removed as by _predict)
+    t_gfltEquationMatrix equ_keep(equ), equ_sat;
+    equ_keep.remove_sat(sat, equ_sat);
+    SymmetricMatrix Q_tmp(Qsav);
+    vector<int> par_sat;
+    for (int i = _param.parNumber() - 1; i >= 0; i--)
+    {
+        if (_param[i].prn != sat)
+        {
+            continue;
+        }
+        int ipar = _param[i].index;
+        Matrix_remRC(Q_tmp, ipar, ipar);
+        equ_keep.remove_par(ipar);
+        par_sat.push_back(i);
+    }
+
+    // the update is solved again from the prediction, a downdate of the computed update is not
+    // accurate when the satellite holds most of the information of a parameter (new ambiguities,
+    // ionosphere) next to large variances (receiver clock)
+    SymmetricMatrix Q_pred(Q_tmp);
+    ColumnVector dx_tmp;
+    try
+    {
+        _filter->update(equ_keep.B, equ_keep.P, equ_keep.l, dx_tmp, Q_tmp);
+    }
+    catch (...)
+    {
+        return false;
+    }
+    if (dx_tmp.Nrows() != Q_tmp.Nrows())
+    {
+        return false;
+    }
+
+    GREAT_INFO("{}{} outlier ({}{}) {} v: {:>16.3f} (removed)",
+               _epoch.str_ymdhms(" epoch "),
+               _site,
+               gobstype2str(_obs_index[idx - 1].second.second),
+               static_cast<int>(_obs_index[idx - 1].second.first),
+               sat,
+               max);
+
+    _remove_sat(sat);
+    for (int i : par_sat)
+    {
+        _param.delParam(i);
+        _param.reIndex();
+    }
+    equ = equ_keep;
+    dx = dx_tmp;
+    Qsav = Q_pred;
+    Qupd = Q_tmp;
+    _Qx = Qupd;
+
+    // model values and partials of the remaining observations are kept
+    equ.chageNewMat(A, P, l, _param.parNumber());
+    _obs_index.clear();
+    _generateObsIndex(equ);
+    _posterioriTest(A, P, l, dx, _Qx, v_norm, vtpv);
+
+    return true;
+}
+
 string great::t_gpvtflt::_gen_kml_description(const t_gtime& epoch, const t_gposdata::data_pos& posdata)
 {
     char s[1000];
@@ -1940,111 +2029,251 @@ int great::t_gpvtflt::processBatch(const t_gtime& beg_r, const t_gtime& end_r, b
         return -1;
     }
 
-    int sign = 1;
-    double subint = 0.1;
+    InitProc(beg_r, end_r);
+
+    // epochs available for rover (and base) in processing order, gaps are jumped over
+    vector<t_gtime> epochs = _procEpochs();
+
+    GREAT_INFO(_site + ": Start GNSS Processing filtering: " + _beg_time.str_ymdhms() + " " + _end_time.str_ymdhms());
+
+    _n_epo_proc = 0;
+    _n_epo_fail = 0;
+    for (const t_gtime& now : epochs)
+    {
+        _slip_detect(now);
+
+        int irc_epo = ProcessOneEpoch(now);
+        if (irc_epo < 0)
+        {
+            ++_n_epo_fail;
+            continue;
+        }
+        else
+        {
+            _success = true;
+            ++_n_epo_proc;
+        }
+
+        GREAT_TRACE("{}{}", _site, now.str_ymdhms(" processing epoch: "));
+
+        double percent = now.diff(_beg_time) / _end_time.diff(_beg_time) * 100.0;
+        if (double_eq(now.sow() % 1, 0.0))
+        {
+            std::cerr << "\r" << _site << "   " << now.str_ymdhms() << setw(5) << " Q = " << (_amb_state ? 1 : 2) << fixed
+                      << setprecision(1) << setw(6) << percent << "%";
+        }
+    }
+
+    GREAT_INFO(_site + ": Epochs processed: " + int2str(_n_epo_proc) + " failed: " + int2str(_n_epo_fail) +
+               " skipped (no data): " + int2str(_n_epo_skip));
+    GREAT_DEBUG(_site + ": MW statistics memory: " + int2str(_MW.memory()) + " bytes");
+
+    _running = false;
+
+    if (beg_r != end_r)
+    {
+        double npd_perc = 0;
+        npd_perc = (double(_n_NPD_flt) / double(_n_ALL_flt)) * 100;
+        GREAT_INFO(_site + ": Forward filter -     Not positive definite covariance matrices: " + dbl2str(npd_perc, 0) + " %   (" +
+                   int2str(_n_NPD_flt) + ", " + int2str(_n_ALL_flt) + ")");
+    }
+
+    _gmutex.unlock();
+
+    return 1;
+}
+
+vector<t_gtime> great::t_gpvtflt::_procEpochs()
+{
+    vector<t_gtime> rover = _gobs->epochs(_site);
+    vector<t_gtime> base;
+    if (_isBase)
+    {
+        base = _gobs->epochs(_site_base);
+    }
+
+    const t_gtime& first = _beg_end ? _beg_time : _end_time;
+    const t_gtime& last = _beg_end ? _end_time : _beg_time;
+
+    vector<t_gtime> epochs = sync_epochs(rover, _isBase ? &base : nullptr, first, last, _sampling, _scale);
 
     if (!_beg_end)
     {
-        sign = -1;
+        reverse(epochs.begin(), epochs.end());
     }
 
-    InitProc(beg_r, end_r, &subint);
+    // sampling epochs without data
+    _n_epo_skip = 0;
+    if (_sampling > 0)
+    {
+        int nexp = int(floor(last.diff(first) / _sampling + DIFF_SEC(_sampling) / _sampling)) + 1;
+        if (nexp > int(epochs.size()))
+        {
+            _n_epo_skip = nexp - epochs.size();
+        }
+    }
 
-    t_gtime now(_beg_time);
+    return epochs;
+}
 
-    GREAT_INFO(_site + ": Start GNSS Processing filtering: " + now.str_ymdhms() + " " + _end_time.str_ymdhms());
-    bool time_loop = true;
+vector<t_gtime> great::t_gpvtflt::sync_epochs(const vector<t_gtime>& rover, const vector<t_gtime>* base,
+                                              const t_gtime& first, const t_gtime& last, double sampling, double scale)
+{
+    double tol = DIFF_SEC(sampling);
 
-    while (time_loop)
+    vector<t_gtime> epochs;
+    size_t ibase = 0;
+    for (const t_gtime& epo : rover)
     {
-        if (_beg_end && (now < _end_time || now == _end_time))
+        if (epo < first - tol || epo > last + tol || !time_sync(epo, sampling, scale))
         {
-            time_loop = true;
+            continue;
         }
-        else if (_beg_end && now > _end_time)
+        if (base)
         {
-            time_loop = false;
-            break;
+            while (ibase < base->size() && (*base)[ibase] < epo - tol)
+            {
+                ++ibase;
+            }
+            if (ibase == base->size() || (*base)[ibase] > epo + tol)
+            {
+                continue;
+            }
         }
 
-        if (!_beg_end && (now > _end_time || now == _end_time))
+        t_gtime now(epo);
+        if (sampling > 1)
         {
-            time_loop = true;
+            now.reset_dsec();
         }
-        else if (!_beg_end && now < _end_time)
+        epochs.push_back(now);
+    }
+
+    return epochs;
+}
+
+int great::t_gpvtflt::processStream(const t_gtime& beg_r, const t_gtime& end_r, t_gepochqueue* rover, t_gepochqueue* base)
+{
+    _gmutex.lock();
+
+    if (_grec == nullptr || rover == nullptr || (_isBase && base == nullptr))
+    {
+        GREAT_ERROR("ERROR: No object/stream found (" + _site + "). Processing terminated!!!");
+        _gmutex.unlock();
+        return -1;
+    }
+    if (!_beg_end)
+    {
+        GREAT_ERROR(_site + ": Streaming is processed in begin -> end direction only. Processing terminated!!!");
+        _gmutex.unlock();
+        return -1;
+    }
+    if (_isBase && _snap->basepos() == BASEPOS::SPP)
+    {
+        GREAT_ERROR(_site + ": Streaming needs base coordinates from the configuration (basepos CFILE). Processing terminated!!!");
+        _gmutex.unlock();
+        return -1;
+    }
+
+    InitProc(beg_r, end_r);
+
+    GREAT_INFO(_site + ": Start GNSS Processing stream: " + _beg_time.str_ymdhms() + " " + _end_time.str_ymdhms());
+
+    t_gobsepoch epo_rover;
+    t_gobsepoch epo_base;
+    bool base_pending = false;
+    t_gtime prev = FIRST_TIME;
+    int nepo = 0;
+    int nproc = 0;
+    double lat_sum = 0.0;
+    double lat_max = 0.0;
+
+    while (rover->pop_wait(epo_rover))
+    {
+        const t_gtime now = epo_rover.epoch;
+        if (now > _end_time + DIFF_SEC(_sampling))
         {
-            time_loop = false;
             break;
         }
-
-        // synchronization
-        if (now != _end_time)
+        if (now < _beg_time - DIFF_SEC(_sampling) || !time_sync(now, _sampling, _scale))
         {
-            if (!time_sync(now, _sampling, _scale))
-            {
-                now.add_dsec(sign * subint / 100); // add_dsec used for synchronization!
+            continue;
+        }
+        ++nepo;
 
-                continue;
-            }
-            if (_sampling > 1)
+        _addEpoch(epo_rover);
+
+        // base epochs up to the rover epoch, the next one waits for the following rover epoch
+        if (_isBase)
+        {
+            while (base_pending || (base_pending = base->pop_wait(epo_base)))
             {
-                now.reset_dsec();
+                if (epo_base.epoch.diff(now) > DIFF_SEC(_sampling))
+                {
+                    break;
+                }
+                _addEpoch(epo_base);
+                base_pending = false;
             }
         }
 
         _slip_detect(now);
 
         int irc_epo = ProcessOneEpoch(now);
-        if (irc_epo < 0)
-        {
-            if (_sampling > 1)
-            {
-                now.add_secs(int(sign * _sampling)); // =<1Hz data
-            }
-            else
-            {
-                now.add_dsec(sign * _sampling); //  >1Hz data
-            }
-            continue;
-        }
-        else
+        if (irc_epo >= 0)
         {
             _success = true;
+            ++nproc;
         }
 
-        GREAT_TRACE(_site + now.str_ymdhms(" processing epoch: "));
+        double latency = chrono::duration<double, micro>(chrono::steady_clock::now() - epo_rover.stamp).count();
+        lat_sum += latency;
+        lat_max = max(lat_max, latency);
 
-        double percent = now.diff(_beg_time) / _end_time.diff(_beg_time) * 100.0;
-        if (double_eq(now.sow() % 1, 0.0))
-        {
-            std::cerr << "\r" << _site << "   " << now.str_ymdhms() << setw(5) << " Q = " << (_amb_state ? 1 : 2) << fixed
-                      << setprecision(1) << setw(6) << percent << "%";
-        }
-        if (_sampling > 1)
-        {
-            now.add_secs(int(sign * _sampling)); // =<1Hz data
-        }
-        else
+        GREAT_TRACE("{}{} latency: {:.0f} us", _site, now.str_ymdhms(" processing epoch: "), latency);
+
+        // processed epochs are removed, preprocessing needs the previous one
+        if (prev != FIRST_TIME)
         {
-            now.add_dsec(sign * _sampling); //  >1Hz data
+            _gobs->clean_outer(_site, prev - DIFF_SEC(_sampling));
+            if (_isBase)
+            {
+                _gobs->clean_outer(_site_base, prev - DIFF_SEC(_sampling));
+            }
         }
+        prev = now;
     }
 
-    _running = false;
-
-    if (beg_r != end_r)
+    // stop the sources (end time reached before the end of data)
+    rover->close();
+    if (base)
     {
-        double npd_perc = 0;
-        npd_perc = (double(_n_NPD_flt) / double(_n_ALL_flt)) * 100;
-        GREAT_INFO(_site + ": Forward filter -     Not positive definite covariance matrices: " + dbl2str(npd_perc, 0) + " %   (" +
-                   int2str(_n_NPD_flt) + ", " + int2str(_n_ALL_flt) + ")");
+        base->close();
     }
 
+    _running = false;
+
+    GREAT_INFO(_site + ": Stream finished, epochs: " + int2str(nepo) + " processed: " + int2str(nproc) +
+               " latency mean: " + dbl2str(nepo > 0 ? lat_sum / nepo : 0.0, 0) + " us max: " + dbl2str(lat_max, 0) + " us");
+    GREAT_DEBUG(_site + ": MW statistics memory: " + int2str(_MW.memory()) + " bytes");
+
     _gmutex.unlock();
 
     return 1;
 }
 
+void great::t_gpvtflt::_addEpoch(const t_gobsepoch& epo)
+{
+    for (const auto& itGLO : epo.glofrq)
+    {
+        _gobs->add_glo_freq(itGLO.first, itGLO.second);
+    }
+    for (const auto& obs : epo.obs)
+    {
+        _gobs->addobs(obs);
+    }
+}
+
 bool great::t_gpvtflt::InitProc(const t_gtime& begT, const t_gtime& endT, double* subint)
 {
     if (_beg_end)
@@ -2104,7 +2333,7 @@ int great::t_gpvtflt::ProcessOneEpoch(const t_gtime& now, vector<t_gsatdata>* da
 {
     if (_getData(now, data_rover, false) == 0)
     {
-        GREAT_TRACE(_site + now.str_ymdhms(" no observation found at epoch: "));
+        GREAT_TRACE("{}{}", _site, now.str_ymdhms(" no observation found at epoch: "));
         return -1;
     }
 
@@ -2153,7 +2382,7 @@ int great::t_gpvtflt::ProcessOneEpoch(const t_gtime& now, vector<t_gsatdata>* da
     {
         if (_getData(now, data_base, true) == 0)
         {
-            GREAT_TRACE(string("gpvtflt:  ") + _site_base + now.str_ymdhms(" no observation found at epoch: "));
+            GREAT_TRACE("gpvtflt:  {}{}", _site_base, now.str_ymdhms(" no observation found at epoch: "));
             return -1;
         }
         // apply dcb
@@ -2183,7 +2412,6 @@ int great::t_gpvtflt::ProcessOneEpoch(const t_gtime& now, vector<t_gsatdata>* da
     {
         _saveApr(obsEpo, _param, _Qx);
     }
-    BASEPOS basepos = dynamic_cast<t_gsetproc*>(_set)->basepos();
 
     int irc_epo = t_gpvtflt::_processEpoch(obsEpo);
 
@@ -2191,7 +2419,7 @@ int great::t_gpvtflt::ProcessOneEpoch(const t_gtime& now, vector<t_gsatdata>* da
     {
         _success = false;
         _removeApr(obsEpo);
-        GREAT_TRACE(_site + now.str_ymdhms(" epoch ") + " was not calculated");
+        GREAT_TRACE("{}{} was not calculated", _site, now.str_ymdhms(" epoch "));
     }
     else
     {
@@ -2254,13 +2482,13 @@ void great::t_gpvtflt::_udsdAmb()
             if (_param[i].parType == par_type::AMB_IF || _param[i].parType == par_type::AMB_L1 || _param[i].parType == par_type::AMB_L2 ||
                 _param[i].parType == par_type::AMB_L3 || _param[i].parType == par_type::AMB_L4 || _param[i].parType == par_type::AMB_L5)
             {
-                GREAT_INFO("AMB will be removed! For Sat PRN " + _param[i].prn + " Epoch: " + _epoch.str_ymdhms());
+                GREAT_INFO("AMB will be removed! For Sat PRN {} Epoch: {}", _param[i].prn, _epoch.str_ymdhms());
 
                 _amb_obs.erase(make_pair(_param[i].prn, _param[i].parType));
 
                 _newAMB.erase(_param[i].prn);
 
-                Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+                _Qslot.remove(_param[i].index);
                 _param.delParam(i);
                 _param.reIndex();
                 i--;
@@ -2279,7 +2507,7 @@ void great::t_gpvtflt::_udsdAmb()
         string sat = rsatdata.sat();
         mapPRN.insert(rsatdata.sat());
 
-        vector<GOBSBAND> band = dynamic_cast<t_gsetgnss*>(_set)->band(gs);
+        vector<GOBSBAND> band = _snap->band(gs);
 
         tuple<GOBS, GOBS, GOBS, GOBS> amb_obs_identifier = make_tuple(X, X, X, X);
 
@@ -2362,11 +2590,11 @@ void great::t_gpvtflt::_udsdAmb()
             {
                 if (_amb_obs.find(make_pair(sat, par_type::AMB_IF)) == _amb_obs.end())
                 {
-                    GREAT_INFO("amb_obs not correct!" + sat + " " + _epoch.str_hms());
+                    GREAT_INFO("amb_obs not correct!{} {}", sat, _epoch.str_hms());
                 }
                 else if (_amb_obs[make_pair(sat, par_type::AMB_IF)] != amb_obs_identifier)
                 {
-                    GREAT_INFO("Warning: amb_obs switched silently!" + sat + " " + _epoch.str_hms());
+                    GREAT_INFO("Warning: amb_obs switched silently!{} {}", sat, _epoch.str_hms());
                     _amb_obs[make_pair(sat, par_type::AMB_IF)] = amb_obs_identifier;
                 }
                 continue;
@@ -2379,13 +2607,12 @@ void great::t_gpvtflt::_udsdAmb()
                 newPar.value(sdamb); // first ambiguity value
                 _param.addParam(newPar);
                 _newAMB[sat] = 1;
-                Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                _Qx(_param.parNumber(), _param.parNumber()) = _sigAmbig * _sigAmbig;
+                _Qslot.add(_sigAmbig * _sigAmbig);
             }
             else
             {
                 _param[idx].value(sdamb);
-                _Qx(idx + 1, idx + 1) = _sigAmbig * _sigAmbig;
+                _Qslot(idx + 1, idx + 1) = _sigAmbig * _sigAmbig;
                 _newAMB[sat] = 1;
             }
 
@@ -2513,11 +2740,11 @@ void great::t_gpvtflt::_udsdAmb()
                 {
                     if (_amb_obs.find(make_pair(sat, amb_type)) == _amb_obs.end())
                     {
-                        GREAT_INFO("amb_obs not correct!" + sat + " " + _epoch.str_hms());
+                        GREAT_INFO("amb_obs not correct!{} {}", sat, _epoch.str_hms());
                     }
                     else if (_amb_obs[make_pair(sat, amb_type)] != amb_obs_identifier)
                     {
-                        GREAT_INFO("Warning: amb_obs switched silently!" + sat + " " + _epoch.str_hms());
+                        GREAT_INFO("Warning: amb_obs switched silently!{} {}", sat, _epoch.str_hms());
                         _amb_obs[make_pair(sat, amb_type)] = amb_obs_identifier;
                     }
                     continue;
@@ -2529,14 +2756,13 @@ void great::t_gpvtflt::_udsdAmb()
                     t_gpar newPar(_site, amb_type, _param.parNumber() + 1, sat);
                     newPar.value(sdamb);
                     _param.addParam(newPar);
-                    Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                    _Qx(_param.parNumber(), _param.parNumber()) = _sigAmbig * _sigAmbig;
+                    _Qslot.add(_sigAmbig * _sigAmbig);
                     newAmb = 1;
                 }
                 else
                 {
                     _param[idx].value(sdamb);
-                    _Qx(idx + 1, idx + 1) = _sigAmbig * _sigAmbig;
+                    _Qslot(idx + 1, idx + 1) = _sigAmbig * _sigAmbig;
                     newAmb = 1;
                 }
 
@@ -2560,13 +2786,13 @@ void great::t_gpvtflt::_udsdAmb()
             set<string>::iterator prnITER = mapPRN.find(_param[i].prn);
             if (prnITER == mapPRN.end())
             {
-                GREAT_INFO("AMB will be removed! For Sat PRN " + _param[i].prn + " Epoch: " + _epoch.str_ymdhms());
+                GREAT_INFO("AMB will be removed! For Sat PRN {} Epoch: {}", _param[i].prn, _epoch.str_ymdhms());
 
                 _amb_obs.erase(make_pair(_param[i].prn, _param[i].parType));
 
                 _newAMB.erase(_param[i].prn);
 
-                Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+                _Qslot.remove(_param[i].index);
                 _param.delParam(i);
                 _param.reIndex();
                 i--;
@@ -2660,9 +2886,8 @@ void great::t_gpvtflt::_udAmb()
                 _param.addParam(newPar);
                 _newAMB[it->sat()] = 1;
 
-                Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                _Qx(_param.parNumber(), _param.parNumber()) = _sigAmbig * _sigAmbig;
-                GREAT_INFO("AMB_IF was added! For Sat PRN " + it->sat() + " Epoch: " + _epoch.str_ymdhms());
+                _Qslot.add(_sigAmbig * _sigAmbig);
+                GREAT_INFO("AMB_IF was added! For Sat PRN {} Epoch: {}", it->sat(), _epoch.str_ymdhms());
             }
             else if (it->getlli(gobs1.gobs()) >= 1 || it->getlli(gobs2.gobs()) >= 1)
             {
@@ -2673,7 +2898,7 @@ void great::t_gpvtflt::_udAmb()
                 it->addslip(true);
                 _param[idx].value(LIF - PIF);
                 _param[idx].setTime(_epoch, LAST_TIME); // beg -> end  (because of cycle slip)
-                _Qx(idx + 1, idx + 1) = _sigAmbig * _sigAmbig;
+                _Qslot(idx + 1, idx + 1) = _sigAmbig * _sigAmbig;
                 _newAMB[it->sat()] = 1;
             }
 
@@ -2685,11 +2910,11 @@ void great::t_gpvtflt::_udAmb()
             }
             else if (_amb_obs.find(make_pair(it->sat(), par_type::AMB_IF)) == _amb_obs.end())
             {
-                GREAT_INFO("amb_obs not correct!" + it->sat() + " " + _epoch.str_hms());
+                GREAT_INFO("amb_obs not correct!{} {}", it->sat(), _epoch.str_hms());
             }
             else if (_amb_obs[make_pair(it->sat(), par_type::AMB_IF)] != amb_obs_identifier)
             {
-                GREAT_INFO("Warning: amb_obs switched silently!" + it->sat() + " " + _epoch.str_hms());
+                GREAT_INFO("Warning: amb_obs switched silently!{} {}", it->sat(), _epoch.str_hms());
                 _amb_obs[make_pair(it->sat(), par_type::AMB_IF)] = amb_obs_identifier;
             }
         }
@@ -2762,7 +2987,7 @@ void great::t_gpvtflt::_udAmb()
                 }
                 else if (_amb_obs[make_pair(it->sat(), amb_type)] != amb_obs_identifier)
                 {
-                    GREAT_INFO("Warning: amb_obs switched silently!" + it->sat() + " " + _epoch.str_hms());
+                    GREAT_INFO("Warning: amb_obs switched silently!{} {}", it->sat(), _epoch.str_hms());
                     _amb_obs[make_pair(it->sat(), amb_type)] = amb_obs_identifier;
                     it->addlli(gobsi.gobs(), 1);
                 }
@@ -2773,9 +2998,8 @@ void great::t_gpvtflt::_udAmb()
                     newPar.setTime(_epoch, LAST_TIME); // beg -> end
                     _param.addParam(newPar);
 
-                    Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                    _Qx(_param.parNumber(), _param.parNumber()) = _sigAmbig * _sigAmbig;
-                    GREAT_INFO("RAW AMB_L1 was added! For Sat PRN " + it->sat() + " Epoch: " + _epoch.str_ymdhms());
+                    _Qslot.add(_sigAmbig * _sigAmbig);
+                    GREAT_INFO("RAW AMB_L1 was added! For Sat PRN {} Epoch: {}", it->sat(), _epoch.str_ymdhms());
                     newAmb = 1;
                 }
                 else if (it->getlli(gobsi.gobs()) >= 1) // check cycle slip
@@ -2783,7 +3007,7 @@ void great::t_gpvtflt::_udAmb()
                     it->addslip(true);
                     _param[idx].value(Li - Pi);
                     _param[idx].setTime(_epoch, LAST_TIME); // beg -> end  (because of cycle slip)
-                    _Qx(idx + 1, idx + 1) = _sigAmbig * _sigAmbig;
+                    _Qslot(idx + 1, idx + 1) = _sigAmbig * _sigAmbig;
                     _newAMB[it->sat()] = 1;
                     if (_param[idx].amb_ini == true)
                     {
@@ -2814,13 +3038,13 @@ void great::t_gpvtflt::_udAmb()
             set<string>::iterator prnITER = mapPRN.find(_param[i].prn);
             if (prnITER == mapPRN.end())
             {
-                GREAT_INFO("AMB will be removed! For Sat PRN " + _param[i].prn + " Epoch: " + _epoch.str_ymdhms());
+                GREAT_INFO("AMB will be removed! For Sat PRN {} Epoch: {}", _param[i].prn, _epoch.str_ymdhms());
 
                 _amb_obs.erase(make_pair(_param[i].prn, _param[i].parType));
 
                 _newAMB.erase(_param[i].prn);
 
-                Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+                _Qslot.remove(_param[i].index);
                 _param.delParam(i);
                 _param.reIndex();
                 i--;
@@ -3055,9 +3279,9 @@ void great::t_gpvtflt::_prtOut(t_gtime& epoch,
     Eigen::Vector3d Qpos(Xrms * Xrms, Yrms * Yrms, Zrms * Zrms), Qvel(Vxrms * Vxrms, Vyrms * Vyrms, Vzrms * Vzrms);
     Eigen::Vector3d position(xyz_ecc[0], xyz_ecc[1], xyz_ecc[2]), velocity(vRec[0], vRec[1], vRec[2]);
     t_gposdata::data_pos posdata = t_gposdata::data_pos{crt, position, velocity, Qpos, Qvel, pdop, nsat, _amb_state};
-    bool ins = dynamic_cast<t_gsetinp*>(_set)->input_size("imu") > 0 ? true : false;
+    bool ins = _snap->ins();
     // write kml
-    if (_kml)
+    if (_kmlout)
     {
         ostringstream out;
         t_gtriple ell1(ell);
@@ -3068,11 +3292,8 @@ void great::t_gpvtflt::_prtOut(t_gtime& epoch,
         out << fixed << setprecision(11) << " " << setw(0) << ell1[1] * R2D << ',' << ell1[0] * R2D;
         string val = out.str();
 
-        xml_node root = _doc;
-        node = this->_default_node(root, _root.c_str());
-        xml_node document = node.child("Document");
-        xml_node last_child = document.last_child();
-        xml_node placemark = document.insert_child_after("Placemark", last_child);
+        xml_document epo;
+        xml_node placemark = epo.append_child("Placemark");
         string q = "#P" + _quality_grade(posdata);
         this->_default_node(placemark, "styleUrl", q.c_str());
         this->_default_node(placemark, "time", int2str(_epoch.sow()).c_str());
@@ -3083,9 +3304,8 @@ void great::t_gpvtflt::_prtOut(t_gtime& epoch,
         xml_node TimeStamp = placemark.append_child("TimeStamp");
         string time = trim(epoch.str_ymd()) + "T" + trim(epoch.str_hms()) + "Z";
         this->_default_node(TimeStamp, "when", time.c_str());
-        xml_node Placemark = document.child("Placemark");
-        xml_node LineString = Placemark.child("LineString");
-        this->_default_node(LineString, "coordinates", val.c_str(), false);
+        _kmlout->add(placemark);
+        _kmlout->track(val);
     }
 
     string str_dsec = dbl2str(epoch.dsec());
@@ -3333,10 +3553,9 @@ void great::t_gpvtflt::_prtOutHeader()
     os << endl;
 
     // Print flt results
-    if (_flt)
+    if (_fltout)
     {
-        _flt->write(os.str().c_str(), os.str().size());
-        _flt->flush();
+        _fltout->write(os.str());
     }
 }
 
@@ -3409,15 +3628,14 @@ int great::t_gpvtflt::_getData(const t_gtime& now, vector<t_gsatdata>* data, boo
     }
     else
     {
+        // the epoch buffers are refilled in place and reused between epochs
         if (!isBase)
         {
-            _data.erase(_data.begin(), _data.end());
-            _data = _gobs->obs(_site, now);
+            _gobs->obs(_site, now, _data);
         }
         else
         {
-            _data_base.erase(_data_base.begin(), _data_base.end());
-            _data_base = _gobs->obs(_site_base, now);
+            _gobs->obs(_site_base, now, _data_base);
         }
     }
 
@@ -3519,31 +3737,22 @@ bool great::t_gpvtflt::_check_sat(const string& ssite, t_gsatdata* const iter, M
 
     if (double_eq(L3, 0.0) && _phase)
     {
-        ostringstream str;
-        str << "prepareData: erasing data due to no phase double bands observation, "
-            << "epo: " << _epoch.str_hms() << ", "
-            << "prn: " << iter->sat() << " (" << iter->channel() << ")";
-        GREAT_INFO(str.str());
+        GREAT_INFO("prepareData: erasing data due to no phase double bands observation, epo: {}, prn: {} ({})",
+                   _epoch.str_hms(),
+                   iter->sat(),
+                   iter->channel());
         return false;
     }
 
     if (double_eq(P3, 0.0))
     {
-        ostringstream str;
-        str << "prepareData: erasing data due to no code double bands observation, "
-            << "epo: " << _epoch.str_hms() << ", "
-            << "prn: " << iter->sat();
-        GREAT_INFO(str.str());
+        GREAT_INFO("prepareData: erasing data due to no code double bands observation, epo: {}, prn: {}", _epoch.str_hms(), iter->sat());
         return false;
     }
 
     if (_satPos(_epoch, *iter) < 0)
     {
-        ostringstream str;
-        str << "prepareData: erasing data since _satPos failed, "
-            << "epo: " << _epoch.str_hms() << ", "
-            << "prn: " << iter->sat();
-        GREAT_INFO(str.str());
+        GREAT_INFO("prepareData: erasing data since _satPos failed, epo: {}, prn: {}", _epoch.str_hms(), iter->sat());
         return false;
     }
     else
@@ -3592,7 +3801,7 @@ bool great::t_gpvtflt::_cmp_rec_crd(const string& ssite, Matrix& BB)
         _vBanc(3) = grec->crd_arp(_epoch)[2];
     }
 
-    else if (ssite == _site_base && dynamic_cast<t_gsetproc*>(_set)->basepos() == BASEPOS::CFILE)
+    else if (ssite == _site_base && _snap->basepos() == BASEPOS::CFILE)
     {
         _vBanc(1) = grec->crd_arp(_epoch)[0];
         _vBanc(2) = grec->crd_arp(_epoch)[1];
@@ -3606,8 +3815,8 @@ bool great::t_gpvtflt::_cmp_rec_crd(const string& ssite, Matrix& BB)
     {
         string warning =
             "WARNING: Unexpected site (" + ssite + ") coordinates from Bancroft. Orbits/clocks or code observations should be checked.";
-        GREAT_INFO(warning + _epoch.str_ymdhms(" Epoch "));
-        GREAT_INFO(warning + _epoch.str_ymdhms(" Epoch "));
+        GREAT_INFO("{}{}", warning, _epoch.str_ymdhms(" Epoch "));
+        GREAT_INFO("{}{}", warning, _epoch.str_ymdhms(" Epoch "));
         if (!_phase)
         {
             return false;
@@ -3675,10 +3884,7 @@ bool great::t_gpvtflt::_cmp_sat_info(const string& ssite, t_gsatdata* const iter
     // check elevation cut-off
     if (iter->ele_deg() < _minElev)
     {
-        ostringstream os;
-        os << "Erasing " << iter->sat() << " data due to low elevation angle (ele = " << fixed << setprecision(1) << iter->ele_deg() << ") "
-           << iter->epoch().str_ymdhms();
-        GREAT_INFO(os.str());
+        GREAT_INFO("Erasing {} data due to low elevation angle (ele = {:.1f}) {}", iter->sat(), iter->ele_deg(), iter->epoch().str_ymdhms());
         return false;
     }
 
@@ -3687,10 +3893,11 @@ bool great::t_gpvtflt::_cmp_sat_info(const string& ssite, t_gsatdata* const iter
     // check satellite eclipsing
     if (iter->ecl())
     {
-        ostringstream os;
-        os << "Erasing " << iter->sat() << " data due to satellite eclipsing (beta = " << fixed << setprecision(1) << iter->beta()
-           << " ,orbit angle = " << iter->orb_angle() << ") " << iter->epoch().str_ymdhms();
-        GREAT_INFO(string("gpvtflt:  ") + os.str());
+        GREAT_INFO("gpvtflt:  Erasing {} data due to satellite eclipsing (beta = {:.1f} ,orbit angle = {:.1f}) {}",
+                   iter->sat(),
+                   iter->beta(),
+                   iter->orb_angle(),
+                   iter->epoch().str_ymdhms());
         return false;
     }
     else
@@ -4203,6 +4410,9 @@ void great::t_gpvtflt::_predictAmb()
 
 unsigned int great::t_gpvtflt::_cmp_equ(t_gfltEquationMatrix& equ)
 {
+    // light time, positions and clocks of all satellites at once
+    _base_model->prepare_epoch(_epoch, _param, _data);
+
     vector<t_gsatdata>::iterator it = _data.begin();
     for (it = _data.begin(); it != _data.end();)
     {
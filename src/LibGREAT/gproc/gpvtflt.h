@@ -16,10 +16,13 @@
 #include "gproc/gqualitycontrol.h"
 #include "gmodels/gpppmodel.h"
 #include "gambfix/gambiguity.h"
+#include "gambfix/gmwstats.h"
+#include "gset/gsetsnap.h"
 #include "gdata/gposdata.h"
 #include "gmodels/gcombmodel.h"
 #include "gproc/gpreproc.h"
 #include "gproc/gfltmatrix.h"
+#include "gio/gepochqueue.h"
 
 using namespace gsins;
 
@@ -31,8 +34,15 @@ namespace great
     class LibGREAT_LIBRARY_EXPORT t_gpvtflt : public t_gpppflt
     {
     public:
-        /** @brief default constructor. */
-        t_gpvtflt(string mark, string mark_base, t_gsetbase* set, t_gallproc* allproc = nullptr);
+        /**
+         * @brief constructor
+         * @param[in] mark       rover site
+         * @param[in] mark_base  base site (RTK), empty for PPP
+         * @param[in] set        settings
+         * @param[in] snap       settings used in the epoch loop, created once by the application (nullptr: read from set)
+         * @param[in] allproc    all data
+         */
+        t_gpvtflt(string mark, string mark_base, t_gsetbase* set, const shared_ptr<const t_gsetsnap>& snap, t_gallproc* allproc = nullptr);
 
         /** @brief default destructor. */
         virtual ~t_gpvtflt();
@@ -40,6 +50,18 @@ namespace great
         /** @brief processBatch. */
         virtual int processBatch(const t_gtime& beg, const t_gtime& end, bool prtOut);
 
+        /**
+         * @brief streaming processing, epochs are taken from the queues as they arrive
+         * @note the epochs are added to the observation container and removed once
+         *       processed (the previous epoch is kept for preprocessing)
+         * @param[in] beg    begin time
+         * @param[in] end    end time
+         * @param[in] rover  queue of rover epochs
+         * @param[in] base   queue of base epochs (RTK)
+         * @return -1,failed; 1,finished
+         */
+        virtual int processStream(const t_gtime& beg, const t_gtime& end, t_gepochqueue* rover, t_gepochqueue* base = nullptr);
+
         /** @brief Initializing some settings. */
         virtual bool InitProc(const t_gtime& begT, const t_gtime& endT, double* subint = NULL);
 
@@ -79,6 +101,19 @@ namespace great
             _ipSatRep = satref;
         }
 
+        /**
+         * @brief rover epochs synchronized to the sampling within [first, last]
+         * @param[in] rover     sorted rover epochs
+         * @param[in] base      sorted base epochs (RTK), nullptr if not used
+         * @param[in] first     first epoch of the interval
+         * @param[in] last      last epoch of the interval
+         * @param[in] sampling  sampling interval [s]
+         * @param[in] scale     sampling scale-factor
+         * @return epochs with rover (and base within DIFF_SEC) data, in ascending order
+         */
+        static vector<t_gtime> sync_epochs(const vector<t_gtime>& rover, const vector<t_gtime>* base,
+                                           const t_gtime& first, const t_gtime& last, double sampling, double scale);
+
     protected:
         /**  @brief initiate RTK parameters */
         int _rtkinit();
@@ -86,6 +121,12 @@ namespace great
         /**  @brief Setting base or rover coordinates */
         int _setCrd();
 
+        /**  @brief epochs with data for rover (and base) within the processing interval, in processing order */
+        vector<t_gtime> _procEpochs();
+
+        /**  @brief add streamed epoch to the observation container */
+        void _addEpoch(const t_gobsepoch& epo);
+
         /**  @brief update RTK SD ambiguity parameters */
         void _udsdAmb();
 
@@ -140,6 +181,28 @@ namespace great
         /** @brief Detect outlier. */
         virtual int _outlierDetect(const ColumnVector& v, const SymmetricMatrix& Qsav, string& sat);
 
+        /**
+         * @brief remove the satellite with the largest outlier and solve the update again from the
+         *        prediction with the equations already computed (no new iteration of the models)
+         * @param[in,out] equ      observation equations of the update
+         * @param[in,out] Qsav     predicted covariance (parameters of the satellite removed)
+         * @param[out]    Qupd     updated covariance
+         * @param[out]    A,P,l    dense equations without the satellite
+         * @param[out]    dx       updated state
+         * @param[out]    v_norm   normalized residuals
+         * @param[out]    vtpv     vtpv
+         * @return true if an outlier was removed
+         */
+        bool _outlierRemove(t_gfltEquationMatrix& equ,
+                            SymmetricMatrix& Qsav,
+                            SymmetricMatrix& Qupd,
+                            Matrix& A,
+                            SymmetricMatrix& P,
+                            ColumnVector& l,
+                            ColumnVector& dx,
+                            ColumnVector& v_norm,
+                            double& vtpv);
+
         /**
          * @brief add doppler measurement to model
          * @param[in] satdata    satellite data
@@ -263,7 +326,7 @@ namespace great
         t_gambiguity* _ambfix = nullptr;                                          ///< ambfix
         FIX_MODE _fix_mode;                                                       ///< fix mode
         UPD_MODE _upd_mode = UPD_MODE::UPD;                                       ///< upd mode
-        t_map_MW _MW, _EWL, _LW, _LE, _LWL, _rMW, _rEWL, _IMW, _IEWL, _PW, _AFIF; ///< t_map
+        t_gmwstats _MW;                                                           ///< MW statistics of the last epochs
         bool _amb_state;                                                          ///< ambiguity state
         t_gallpar _param_fixed;                                                   ///< param fixed
         t_gtriple _vel;                                                           ///< vel
@@ -281,11 +344,15 @@ namespace great
         SLIPMODEL _slip_model;                          ///< slip model
         shared_ptr<t_gpreproc> _gpre;                   ///< preprocess
         t_gqualitycontrol _gquality_control;            ///< gquality control
+        shared_ptr<const t_gsetsnap> _snap;             ///< settings used in the epoch loop
         t_gtime _wl_Upd_time;                           ///< wl Upd time
         t_gtime _ewl_Upd_time;                          ///< ewl Upd time
         int _realnobs;                                  ///< number of obs
         RECEIVERTYPE _receiverType;                     ///< receiver Type
         map<string, string> _sat_freqs;                 ///< sat freqs
+        unsigned int _n_epo_proc = 0;                   ///< number of processed epochs
+        unsigned int _n_epo_fail = 0;                   ///< number of epochs with data, not processed
+        unsigned int _n_epo_skip = 0;                   ///< number of sampling epochs without data
     };
     template <class T1, class T2> void t_out(T1 const& name, T2 const& matrix)
     {
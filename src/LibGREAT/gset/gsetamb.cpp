@@ -41,6 +41,8 @@ namespace great
              << "<upd_mode> upd </upd_mode>\n"
              << "<fix_mode> SEARCH/NO </fix_mode>\n"
              << "<ratio> 3.0 </ratio>\n"
+             << "<lambda_search> SHRINK/FI71 </lambda_search>\n"
+             << "<lambda_cands> 2 </lambda_cands>\n"
              << "<all_baselines> NO </all_baselines>\n"
              << "<min_common_time> 30 </min_common_time>\n"
              << "<widelane_decision     maxdev = \"0.15\" maxsig = \"0.10\" alpha = \"1000\"/>\n"
@@ -80,6 +82,38 @@ namespace great
         return str2dbl(tmp);
     }
 
+    LAMBDA_SEARCH t_gsetamb::lambda_search()
+    {
+        _gmutex.lock();
+
+        string tmp = trim(_doc.child(XMLKEY_ROOT).child(XMLKEY_AMBIGUITY).child_value("lambda_search"));
+
+        _gmutex.unlock();
+        if (tmp == "FI71")
+        {
+            return LAMBDA_SEARCH::FI71;
+        }
+        if (!tmp.empty() && tmp != "SHRINK")
+        {
+            GREAT_WARN("warning: not defined lambda search[" + tmp + "]");
+        }
+        return LAMBDA_SEARCH::SHRINK;
+    }
+
+    int t_gsetamb::lambda_cands()
+    {
+        _gmutex.lock();
+
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_AMBIGUITY).child_value("lambda_cands");
+
+        _gmutex.unlock();
+        if (tmp.empty())
+        {
+            return 2;
+        }
+        return max(2, str2int(tmp));
+    }
+
     double t_gsetamb::bootstrapping()
     {
         _gmutex.lock();
@@ -113,6 +147,7 @@ namespace great
         map<string, double> amb_decision;
         if (_default_decision.find(type) == _default_decision.end())
         {
+            _gmutex.unlock();
             return amb_decision;
         }
         amb_decision = _default_decision[type];
@@ -15,6 +15,7 @@
 
 #include "gexport/ExportLibGREAT.h"
 #include "gset/gsetbase.h"
+#include "gambfix/glambda.h"
 
 using namespace std;
 using namespace gnut;
@@ -99,6 +100,18 @@ namespace great
          */
         double lambda_ratio();
 
+        /**
+         * @brief  get lambda search strategy (FI71/SHRINK), default SHRINK.
+         * @return    LAMBDA_SEARCH    lambda search strategy
+         */
+        LAMBDA_SEARCH lambda_search();
+
+        /**
+         * @brief  get number of lambda candidates (at least 2), default 2.
+         * @return    int    number of candidates
+         */
+        int lambda_cands();
+
         /**
          * @brief  get bootstrapping rate.
          * @return    double    bootstrapping rate
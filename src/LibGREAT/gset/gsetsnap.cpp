@@ -0,0 +1,73 @@
+/**
+ * @file         gsetsnap.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Immutable typed snapshot of the settings used during processing
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+#include "gset/gsetsnap.h"
+#include "gset/gsetgen.h"
+#include "gset/gsetgnss.h"
+#include "gset/gsetinp.h"
+#include "gset/gsetamb.h"
+
+using namespace std;
+
+namespace great
+{
+    t_gsetsnap::t_gsetsnap(t_gsetbase* gset)
+    {
+        t_gsetgen* gen = dynamic_cast<t_gsetgen*>(gset);
+        if (gen)
+        {
+            _sys = gen->sys();
+            _sat_rm = gen->sat_rm();
+        }
+
+        t_gsetgnss* gnss = dynamic_cast<t_gsetgnss*>(gset);
+        if (gnss)
+        {
+            for (GSYS gsys : {GPS, GAL, GLO, BDS, QZS, SBS, IRN})
+            {
+                _band[gsys] = gnss->band(gsys);
+            }
+        }
+
+        t_gsetproc* proc = dynamic_cast<t_gsetproc*>(gset);
+        if (proc)
+        {
+            _basepos = proc->basepos();
+        }
+
+        t_gsetamb* amb = dynamic_cast<t_gsetamb*>(gset);
+        if (amb)
+        {
+            _isSetRefSat = amb->isSetRefSat();
+        }
+
+        t_gsetinp* inp = dynamic_cast<t_gsetinp*>(gset);
+        if (inp)
+        {
+            _ins = inp->input_size("imu") > 0;
+        }
+    }
+
+    t_gsetsnap::~t_gsetsnap()
+    {
+    }
+
+    const vector<GOBSBAND>& t_gsetsnap::band(GSYS gsys) const
+    {
+        static const vector<GOBSBAND> none;
+        auto it = _band.find(gsys);
+        if (it == _band.end())
+        {
+            return none;
+        }
+        return it->second;
+    }
+
+} // namespace great
@@ -0,0 +1,93 @@
+/**
+ * @file         gsetsnap.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Immutable typed snapshot of the settings used during processing
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+#ifndef GSETSNAP_H
+#define GSETSNAP_H
+
+#include "gexport/ExportLibGREAT.h"
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "gset/gsetbase.h"
+#include "gset/gsetproc.h"
+#include "gutils/gobs.h"
+
+using namespace std;
+using namespace gnut;
+
+namespace great
+{
+    /**
+     * @brief settings read by the processing in every epoch, converted once
+     *
+     * The accessors of the t_gset* classes lock the settings and parse the XML
+     * document on every call. The values needed in the epoch loop are read once
+     * after the configuration is loaded and kept here in their typed form. The
+     * application creates the snapshot once and passes it to the filters; it is
+     * never modified, so all sites/threads read it without a lock.
+     */
+    class LibGREAT_LIBRARY_EXPORT t_gsetsnap
+    {
+    public:
+        /**
+         * @brief constructor, reads the settings
+         * @param[in]  gset      settings (read and checked)
+         */
+        explicit t_gsetsnap(t_gsetbase* gset);
+
+        /** @brief default destructor. */
+        virtual ~t_gsetsnap();
+
+        /** @brief GNSS systems (gen) */
+        const set<string>& sys() const
+        {
+            return _sys;
+        }
+
+        /** @brief excluded satellites (gen) */
+        const set<string>& sat_rm() const
+        {
+            return _sat_rm;
+        }
+
+        /** @brief bands of the system (gnss), empty if not set */
+        const vector<GOBSBAND>& band(GSYS gsys) const;
+
+        /** @brief base site coordinates (process) */
+        BASEPOS basepos() const
+        {
+            return _basepos;
+        }
+
+        /** @brief reference satellites set by the user (ambiguity) */
+        bool isSetRefSat() const
+        {
+            return _isSetRefSat;
+        }
+
+        /** @brief imu data in the inputs (inputs) */
+        bool ins() const
+        {
+            return _ins;
+        }
+
+    protected:
+        set<string> _sys;                       ///< GNSS systems
+        set<string> _sat_rm;                    ///< excluded satellites
+        map<GSYS, vector<GOBSBAND>> _band;      ///< bands by system
+        BASEPOS _basepos = BASEPOS::SPP;        ///< base site coordinates
+        bool _isSetRefSat = false;              ///< reference satellites set
+        bool _ins = false;                      ///< imu data in the inputs
+    };
+} // namespace great
+
+#endif
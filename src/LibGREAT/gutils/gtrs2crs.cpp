@@ -86,6 +86,18 @@ namespace great
         return _ypole;
     };
 
+    void t_gtrs2crs::setRotMat(const t_gtime& epoch, const Matrix& rotmat, double xpole, double ypole)
+    {
+        _tdt = epoch;
+        _rotmat = rotmat;
+        _xpole = xpole;
+        _ypole = ypole;
+    }
+    const t_gtime& t_gtrs2crs::getEpoch() const
+    {
+        return _tdt;
+    }
+
     void t_gtrs2crs::calcRotMat(const t_gtime& epoch)
     {
         double dUt1_tai = 0.0;
@@ -188,8 +200,8 @@ namespace great
     {
         double stepsize = 0.015 * 86400.0; // unit sec
         double rmjd = t.dmjd();
-        static bool isfirst = true;
-        static t_pudaily tb0, tb1;
+        thread_local bool isfirst = true;
+        thread_local t_pudaily tb0, tb1;
         if (isfirst)
         {
             tb0.time = LAST_TIME;
@@ -416,9 +428,9 @@ namespace great
 
     double t_gtrs2crs::_tideCor2(const double& dRmjd)
     {
-        static t_zonaltide sTZB[3];
+        thread_local t_zonaltide sTZB[3];
         static double gdStepsize = 0.05;
-        static bool isFirst = true;
+        thread_local bool isFirst = true;
         double dT;
         double pdUt1;
         if (isFirst)
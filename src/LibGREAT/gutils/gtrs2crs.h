@@ -101,6 +101,18 @@ namespace great
         /** @brief return ypole. */
         double getYpole();
 
+        /**
+         * @brief set the rotation computed elsewhere (e.g. interpolated by t_gtrs2crs_grid)
+         * @param[in]  epoch     epoch (TT)
+         * @param[in]  rotmat    rotation matrix from TRS to CRS
+         * @param[in]  xpole     x pole [arcsec]
+         * @param[in]  ypole     y pole [arcsec]
+         */
+        void setRotMat(const t_gtime& epoch, const Matrix& rotmat, double xpole, double ypole);
+
+        /** @brief return epoch of the rotation matrix (TT). */
+        const t_gtime& getEpoch() const;
+
     protected:
         /** @brief interpolate short term tidal corrections(fortran: polut1_ray_interpolation). */
         void _tide_corrections(t_gtime& t, t_gtriple& xyu);
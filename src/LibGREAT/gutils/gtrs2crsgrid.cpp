@@ -0,0 +1,258 @@
+/**
+ * @file         gtrs2crsgrid.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        TRS to CRS rotation interpolated from a precomputed grid
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+#include "gutils/gtrs2crsgrid.h"
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+namespace great
+{
+    const double t_gtrs2crs_grid::_step_max = 900.0;
+    const double t_gtrs2crs_grid::_step_min = 30.0;
+
+    t_gtrs2crs_grid::t_gtrs2crs_grid(t_gpoleut1* poleut1, double accuracy, string cver) :
+        _poleut1(poleut1),
+        _accuracy(accuracy),
+        _cver(cver),
+        _step(0.0)
+    {
+    }
+
+    t_gtrs2crs_grid::~t_gtrs2crs_grid()
+    {
+    }
+
+    shared_ptr<t_gtrs2crs_grid> t_gtrs2crs_grid::share(t_gpoleut1* poleut1, double accuracy)
+    {
+        static t_gmutex mtx;
+        static map<t_gpoleut1*, weak_ptr<t_gtrs2crs_grid>> grids;
+
+        mtx.lock();
+        shared_ptr<t_gtrs2crs_grid> grid = grids[poleut1].lock();
+        if (!grid)
+        {
+            grid = make_shared<t_gtrs2crs_grid>(poleut1, accuracy);
+            grids[poleut1] = grid;
+        }
+        mtx.unlock();
+        return grid;
+    }
+
+    void t_gtrs2crs_grid::interpolate(const t_gtime& tdt, t_gtrs2crs& trs2crs)
+    {
+        const vector<t_node>& nodes = _day(tdt.mjd());
+
+        double x = 0.0;
+        int i0 = _window(tdt, nodes.size(), x);
+        double w[_npts];
+        _weights(i0, x, w, nullptr);
+
+        double rot[9] = {0.0};
+        double xpole = 0.0, ypole = 0.0;
+        for (int k = 0; k < _npts; k++)
+        {
+            const t_node& node = nodes[i0 + k];
+            for (int e = 0; e < 9; e++)
+            {
+                rot[e] += w[k] * node.rot[e];
+            }
+            xpole += w[k] * node.xpole;
+            ypole += w[k] * node.ypole;
+        }
+
+        Matrix rotmat(3, 3);
+        rotmat << rot;
+        trs2crs.setRotMat(tdt, rotmat, xpole, ypole);
+    }
+
+    void t_gtrs2crs_grid::interpolate_dot(const t_gtime& tdt, Matrix& rotdot)
+    {
+        const vector<t_node>& nodes = _day(tdt.mjd());
+
+        double x = 0.0;
+        int i0 = _window(tdt, nodes.size(), x);
+        double w[_npts], dw[_npts];
+        _weights(i0, x, w, dw);
+
+        double rot[9] = {0.0};
+        for (int k = 0; k < _npts; k++)
+        {
+            const t_node& node = nodes[i0 + k];
+            for (int e = 0; e < 9; e++)
+            {
+                rot[e] += dw[k] / _step * node.rot[e];
+            }
+        }
+
+        rotdot.ReSize(3, 3);
+        rotdot << rot;
+    }
+
+    const vector<t_gtrs2crs_grid::t_node>& t_gtrs2crs_grid::_day(int mjd)
+    {
+        _rwlock.lock_shared();
+        auto it = _days.find(mjd);
+        if (it != _days.end())
+        {
+            _rwlock.unlock_shared();
+            return it->second; // days are never removed
+        }
+        _rwlock.unlock_shared();
+
+        _rwlock.lock();
+        it = _days.find(mjd);
+        if (it == _days.end())
+        {
+            vector<t_node> nodes;
+            if (_step == 0.0)
+            {
+                // first day: coarsest step within the accuracy bound
+                _step = _step_max;
+                _build(mjd, nodes);
+                double diff = _check(mjd, nodes);
+                while (diff > _accuracy && _step / 2.0 >= _step_min)
+                {
+                    _step /= 2.0;
+                    _build(mjd, nodes);
+                    diff = _check(mjd, nodes);
+                }
+                ostringstream os;
+                os << "TRS2CRS grid step " << _step << " s, interpolation difference " << scientific << setprecision(2) << diff << " rad";
+                GREAT_INFO(os.str());
+            }
+            else
+            {
+                _build(mjd, nodes);
+            }
+            it = _days.insert(make_pair(mjd, nodes)).first;
+        }
+        _rwlock.unlock();
+
+        return it->second;
+    }
+
+    void t_gtrs2crs_grid::_build(int mjd, vector<t_node>& nodes)
+    {
+        int nnodes = static_cast<int>(round(86400.0 / _step)) + 1;
+        nodes.resize(nnodes);
+
+        t_gtrs2crs trs2crs(false, _poleut1, _cver);
+        for (int i = 0; i < nnodes; i++)
+        {
+            double sod = i * _step;
+            t_gtime epoch(mjd, static_cast<int>(sod), sod - static_cast<int>(sod), t_gtime::TT);
+            if (i == nnodes - 1)
+            {
+                epoch = t_gtime(mjd + 1, 0, 0.0, t_gtime::TT);
+            }
+            trs2crs.calcRotMat(epoch);
+
+            Matrix& rotmat = trs2crs.getRotMat();
+            for (int r = 0; r < 3; r++)
+            {
+                for (int c = 0; c < 3; c++)
+                {
+                    nodes[i].rot[r * 3 + c] = rotmat(r + 1, c + 1);
+                }
+            }
+            nodes[i].xpole = trs2crs.getXpole();
+            nodes[i].ypole = trs2crs.getYpole();
+        }
+    }
+
+    double t_gtrs2crs_grid::_check(int mjd, const vector<t_node>& nodes)
+    {
+        // middle of every hour (or of every interval for longer steps)
+        t_gtrs2crs exact(false, _poleut1, _cver);
+        int nint = static_cast<int>(nodes.size()) - 1;
+        int every = max(1, static_cast<int>(3600.0 / _step));
+
+        double diff = 0.0;
+        for (int i = 0; i < nint; i += every)
+        {
+            double sod = (i + 0.5) * _step;
+            t_gtime epoch(mjd, static_cast<int>(sod), sod - static_cast<int>(sod), t_gtime::TT);
+            exact.calcRotMat(epoch);
+
+            double x = 0.0;
+            int i0 = _window(epoch, nodes.size(), x);
+            double w[_npts];
+            _weights(i0, x, w, nullptr);
+            for (int e = 0; e < 9; e++)
+            {
+                double val = 0.0;
+                for (int k = 0; k < _npts; k++)
+                {
+                    val += w[k] * nodes[i0 + k].rot[e];
+                }
+                diff = max(diff, fabs(val - exact.getRotMat()(e / 3 + 1, e % 3 + 1)));
+            }
+        }
+        return diff;
+    }
+
+    int t_gtrs2crs_grid::_window(const t_gtime& tdt, int nnodes, double& x) const
+    {
+        x = (tdt.sod() + tdt.dsec()) / _step;
+        int i0 = static_cast<int>(floor(x)) - _npts / 2 + 1;
+        if (i0 > nnodes - _npts)
+        {
+            i0 = nnodes - _npts;
+        }
+        if (i0 < 0)
+        {
+            i0 = 0;
+        }
+        return i0;
+    }
+
+    void t_gtrs2crs_grid::_weights(int i0, double x, double* w, double* dw) const
+    {
+        for (int k = 0; k < _npts; k++)
+        {
+            w[k] = 1.0;
+            for (int m = 0; m < _npts; m++)
+            {
+                if (m != k)
+                {
+                    w[k] *= (x - (i0 + m)) / (k - m);
+                }
+            }
+        }
+        if (!dw)
+        {
+            return;
+        }
+        for (int k = 0; k < _npts; k++)
+        {
+            dw[k] = 0.0;
+            for (int m = 0; m < _npts; m++)
+            {
+                if (m == k)
+                {
+                    continue;
+                }
+                double prod = 1.0 / (k - m);
+                for (int j = 0; j < _npts; j++)
+                {
+                    if (j != k && j != m)
+                    {
+                        prod *= (x - (i0 + j)) / (k - j);
+                    }
+                }
+                dw[k] += prod;
+            }
+        }
+    }
+
+} // namespace great
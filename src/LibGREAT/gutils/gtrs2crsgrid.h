@@ -0,0 +1,116 @@
+/**
+ * @file         gtrs2crsgrid.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        TRS to CRS rotation interpolated from a precomputed grid
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+#ifndef GTRS2CRSGRID_H
+#define GTRS2CRSGRID_H
+
+#include "gexport/ExportLibGREAT.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "gutils/gmutex.h"
+#include "gutils/gtrs2crs.h"
+
+using namespace std;
+
+namespace great
+{
+    /**
+     * @brief Class for the TRS to CRS rotation interpolated from a grid
+     *
+     * The rotation matrix and the pole coordinates are computed by t_gtrs2crs on
+     * a regular grid (TT), one table per day, filled when the day is first used.
+     * Other epochs are interpolated (Lagrange) from the nodes of the same day,
+     * so the daily EOP interpolation is never smoothed across midnight. The grid
+     * step is chosen on the first day: it is halved until the interpolation agrees
+     * with the exact rotation within the accuracy bound.
+     * The grid is shared by all sites/threads using the same EOP data (share()).
+     */
+    class LibGREAT_LIBRARY_EXPORT t_gtrs2crs_grid
+    {
+    public:
+        /**
+         * @brief constructor
+         * @param[in]  poleut1   Earth orientation parameters
+         * @param[in]  accuracy  maximum interpolation error of the matrix elements [rad]
+         * @param[in]  cver      IAU version: 00 or 06(default)
+         */
+        t_gtrs2crs_grid(t_gpoleut1* poleut1, double accuracy, string cver = "06");
+
+        /** @brief default destructor. */
+        virtual ~t_gtrs2crs_grid();
+
+        /**
+         * @brief grid shared by all users of the same EOP data (created by the first call)
+         * @param[in]  poleut1   Earth orientation parameters
+         * @param[in]  accuracy  maximum interpolation error [rad] (used when created)
+         * @return shared grid
+         */
+        static shared_ptr<t_gtrs2crs_grid> share(t_gpoleut1* poleut1, double accuracy);
+
+        /**
+         * @brief interpolate the rotation matrix and the pole coordinates
+         * @param[in]  tdt       epoch (TT)
+         * @param[out] trs2crs   rotation set by setRotMat
+         */
+        void interpolate(const t_gtime& tdt, t_gtrs2crs& trs2crs);
+
+        /**
+         * @brief time derivative of the rotation matrix
+         * @param[in]  tdt       epoch (TT)
+         * @param[out] rotdot    derivative of the rotation matrix [1/s]
+         */
+        void interpolate_dot(const t_gtime& tdt, Matrix& rotdot);
+
+        /** @brief grid step [s] (0 before the first day is computed) */
+        double step() const
+        {
+            return _step;
+        }
+
+    protected:
+        /** @brief grid node */
+        struct t_node
+        {
+            double rot[9]; ///< rotation matrix (by rows)
+            double xpole;  ///< x pole [arcsec]
+            double ypole;  ///< y pole [arcsec]
+        };
+
+        /** @brief nodes of the day, computed if not yet available */
+        const vector<t_node>& _day(int mjd);
+
+        /** @brief compute nodes of the day with the current step */
+        void _build(int mjd, vector<t_node>& nodes);
+
+        /** @brief maximum difference of the interpolation to the exact rotation (mid points of the day) */
+        double _check(int mjd, const vector<t_node>& nodes);
+
+        /** @brief first node of the interpolation window and the position of tdt in the day [steps] */
+        int _window(const t_gtime& tdt, int nnodes, double& x) const;
+
+        /** @brief Lagrange weights (and their derivatives if dw) at x for the window from i0 */
+        void _weights(int i0, double x, double* w, double* dw) const;
+
+        t_gpoleut1* _poleut1;            ///< poleut1 data
+        double _accuracy;                ///< interpolation accuracy bound [rad]
+        string _cver;                    ///< IAU version
+        double _step;                    ///< grid step [s]
+        map<int, vector<t_node>> _days;  ///< nodes by MJD (TT)
+        t_grwmutex _rwlock;              ///< days are added under the exclusive lock
+
+        static const int _npts = 8;      ///< number of interpolation nodes
+        static const double _step_max;   ///< initial grid step [s]
+        static const double _step_min;   ///< minimum grid step [s]
+    };
+} // namespace great
+
+#endif
@@ -16,7 +16,8 @@ namespace gnut
 {
     t_gallbias::t_gallbias() :
         t_gdata(),
-        _isOverWrite(false)
+        _isOverWrite(false),
+        _table(nullptr)
     {
         id_type(t_gdata::ALLBIAS);
         id_group(t_gdata::GRP_MODEL);
@@ -40,13 +41,14 @@ namespace gnut
 
     void t_gallbias::add(const string& ac, const t_gtime& epo, const string& obj, t_spt_bias pt_cb)
     {
-        _gmutex.lock();
+        _grwmutex.lock();
 
         if (pt_cb == nullptr)
         {
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return;
         }
+        atomic_store(&_table, shared_ptr<const t_gbiastable>());
 
         if (pt_cb->ref() == X)
         {
@@ -96,54 +98,38 @@ namespace gnut
             }
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return;
     }
 
     double t_gallbias::get(const string& prd, const t_gtime& epo, const string& prn, const GOBS& gobs, const bool& meter)
     {
-        _gmutex.lock();
-
-        double bias = 999.0;
-        auto itAC = _mapBias.find(prd);
-        if (itAC != _mapBias.end())
-        {
-            auto itEPO = itAC->second.upper_bound(epo);
-            if (itEPO != itAC->second.begin() && itEPO != itAC->second.end())
-            {
-                itEPO--; // between epochs
-            }
-            if (itEPO == itAC->second.end() && itAC->second.size() != 0)
-            {
-                itEPO--; // no epochs
-            }
-
-            if (itEPO != itAC->second.end())
-            {
-                auto itSAT = itEPO->second.find(prn);
-                if (itSAT != itEPO->second.end() && itSAT->second.find(gobs) != itSAT->second.end())
-                {
-                    t_spt_bias pobs1 = itSAT->second.find(gobs)->second;
-                    bias = pobs1->bias();
-                }
-            }
-        }
-
-        _gmutex.unlock();
-        return bias;
+        shared_ptr<const t_gbiastable> table = _get_table();
+        const t_gbiastable::t_cell* cell = table->find(prd, epo, prn, gobs, false);
+        return cell ? cell->bias : 999.0;
     }
 
     vector<string> t_gallbias::get_ac()
     {
+        _grwmutex.lock_shared();
         vector<string> ac_list;
         for (const auto& item : _mapBias)
         {
             ac_list.push_back(item.first);
         }
+        _grwmutex.unlock_shared();
         return ac_list;
     }
 
     string t_gallbias::get_ac_priority()
+    {
+        _grwmutex.lock_shared();
+        string used_ac = _ac_priority();
+        _grwmutex.unlock_shared();
+        return used_ac;
+    }
+
+    string t_gallbias::_ac_priority() const
     {
         string used_ac;
         int loc = 999;
@@ -158,7 +144,7 @@ namespace gnut
                                         {"CNT_A", 9},
                                         {"RTB_A", 10},
                                         {"SGG_A", 11}};
-        for (auto item : _mapBias)
+        for (const auto& item : _mapBias)
         {
             string ac = (item.first == "WHU_A_PHASE") ? "WHU_A" : item.first;
             if (ac_order.at(ac) < loc)
@@ -172,48 +158,39 @@ namespace gnut
 
     string t_gallbias::get_used_ac()
     {
+        _grwmutex.lock_shared();
         if (_acUsed.empty())
         {
-            _acUsed = get_ac_priority();
+            // resolved once, readers are upgraded to the exclusive lock only for the first call
+            _grwmutex.unlock_shared();
+            _grwmutex.lock();
+            if (_acUsed.empty())
+            {
+                _acUsed = _ac_priority();
+            }
+            _grwmutex.unlock();
+            _grwmutex.lock_shared();
         }
-        return _acUsed;
+        string used_ac = _acUsed;
+        _grwmutex.unlock_shared();
+        return used_ac;
     }
 
     double t_gallbias::get(const t_gtime& epo, const string& obj, const GOBS& gobs1, const GOBS& gobs2, const string& tmp)
     {
-        _gmutex.lock();
+        shared_ptr<const t_gbiastable> table = _get_table();
 
         double dcb = 0.0;
-        string ac(tmp);
-        if (ac == "" && _isOrdered == true)
-        {
-            ac = _acPri;
-        }
-
-        if (ac == "" && _isOrdered == false)
-        {
-            int loc = 999;
-            for (const auto& item : _mapBias)
-            {
-                if (_acOrder.at(item.first) < loc)
-                {
-                    ac = item.first;
-                    loc = _acOrder.at(item.first);
-                }
-            }
-
-            _isOrdered = true;
-            _acPri = ac;
-        }
+        string ac = tmp.empty() ? table->primary() : tmp;
 
         if (gobs2 == gobs1)
         {
             GOBS gobs1_convert = gobs1;
             this->_convert_obstype(ac, obj, gobs1_convert);
-            t_spt_bias pobs1 = _find(ac, epo, obj, gobs1_convert);
+            const t_gbiastable::t_cell* pobs1 = table->find(ac, epo, obj, gobs1_convert);
             if (pobs1 != nullptr)
             {
-                dcb = pobs1->bias();
+                dcb = pobs1->bias;
             }
         }
         else
@@ -225,21 +202,67 @@ namespace gnut
             this->_convert_obstype(ac, obj, gobs1_convert);
             this->_convert_obstype(ac, obj, gobs2_convert);
 
-            t_spt_bias pobs1 = _find(ac, epo, obj, gobs1_convert);
-            t_spt_bias pobs2 = _find(ac, epo, obj, gobs2_convert);
+            const t_gbiastable::t_cell* pobs1 = table->find(ac, epo, obj, gobs1_convert);
+            const t_gbiastable::t_cell* pobs2 = table->find(ac, epo, obj, gobs2_convert);
 
-            if (pobs1 != nullptr && pobs2 != nullptr && pobs1->ref() == pobs2->ref())
+            if (pobs1 != nullptr && pobs2 != nullptr && (pobs1->ref == pobs2->ref || pobs2->sig == C6C))
             {
-                dcb = pobs1->bias() - pobs2->bias();
+                dcb = pobs1->bias - pobs2->bias;
             }
-            if (pobs1 != nullptr && pobs2 != nullptr && pobs2->gobs() == C6C)
+        }
+
+        return dcb;
+    }
+
+    shared_ptr<const t_gbiastable> t_gallbias::_get_table()
+    {
+        shared_ptr<const t_gbiastable> table = atomic_load(&_table);
+        if (table)
+        {
+            return table;
+        }
+
+        _grwmutex.lock();
+        table = atomic_load(&_table);
+        if (table)
+        {
+            _grwmutex.unlock();
+            return table;
+        }
+
+        // biases are already connected to their references, the table keeps only the values
+        shared_ptr<t_gbiastable> tmp = make_shared<t_gbiastable>();
+        int loc = 999;
+        for (const auto& itAC : _mapBias)
+        {
+            auto itOrder = _acOrder.find(itAC.first);
+            if (itOrder != _acOrder.end() && itOrder->second < loc)
             {
-                dcb = pobs1->bias() - pobs2->bias();
+                tmp->primary(itAC.first);
+                loc = itOrder->second;
+            }
+            for (const auto& itEPO : itAC.second)
+            {
+                for (const auto& itSAT : itEPO.second)
+                {
+                    for (const auto& itGOBS : itSAT.second)
+                    {
+                        t_gbiastable::t_cell cell;
+                        cell.gobs = itGOBS.first;
+                        cell.sig = itGOBS.second->gobs();
+                        cell.ref = itGOBS.second->ref();
+                        cell.bias = itGOBS.second->bias();
+                        cell.beg = itGOBS.second->beg();
+                        cell.end = itGOBS.second->end();
+                        tmp->add(itAC.first, itEPO.first, itSAT.first, cell);
+                    }
+                }
             }
         }
 
-        _gmutex.unlock();
-        return dcb;
+        atomic_store(&_table, shared_ptr<const t_gbiastable>(tmp));
+        _grwmutex.unlock();
+        return tmp;
     }
 
     t_spt_bias t_gallbias::_find(const string& ac, const t_gtime& epo, const string& obj, const GOBS& gobs)
@@ -19,8 +19,10 @@
 #ifndef GALLBIAS_H
 #define GALLBIAS_H
 
+#include <memory>
 #include "gdata/gdata.h"
 #include "gmodels/gbias.h"
+#include "gmodels/gbiastable.h"
 #include "gutils/gtime.h"
 
 using namespace std;
@@ -163,14 +165,26 @@ namespace gnut
          */
         void _consolidate(const string& ac, const string& obj, const t_spt_bias& pt_cb1, const t_spt_bias& pt_cb2);
 
+        /**
+         * @brief AC with the highest priority (container must be locked).
+         * @return    ac name
+         */
+        string _ac_priority() const;
+
+        /**
+         * @brief resolved table of the current biases (built when first needed after a change)
+         * @return    table (kept by the caller while reading, superseded tables are released by the last reader)
+         */
+        shared_ptr<const t_gbiastable> _get_table();
+
     protected:
         string _acUsed;            ///<
-        string _acPri = "DLR_R";   ///< primary AC
         map<string, int> _acOrder; ///< map of all ACs
         int _udbiaInt = 99999;     ///< flag of undifferentiated bia
         bool _isOverWrite = false; ///< flag of overwrite
-        bool _isOrdered = false;   ///< if AC is ordered
         t_map_ac _mapBias;         ///< map of all satellite biases (all ACs & all period & all objects)
+        mutable t_grwmutex _grwmutex; ///< shared for readers (processing threads), exclusive for decoders
+        shared_ptr<const t_gbiastable> _table; ///< current resolved table (nullptr after data changed), only atomic_load/atomic_store
     };
 
 } // namespace gnut
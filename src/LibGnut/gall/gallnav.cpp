@@ -49,17 +49,17 @@ namespace gnut
 
     shared_ptr<t_geph> t_gallnav::find(const string& sat, const t_gtime& t, const bool& chk_mask)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         shared_ptr<t_geph> tmp = t_gallnav::_find(sat, t, _chkHealth && chk_mask);
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return tmp;
     };
     int t_gallnav::pos(const string& sat, const t_gtime& t, double xyz[3], double var[3], double vel[3],
                        const bool& chk_mask) // [m]
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         shared_ptr<t_geph> tmp = t_gallnav::_find(sat, t, _chkHealth && chk_mask);
 
@@ -82,7 +82,7 @@ namespace gnut
                     vel[i] = 0.0;
                 }
             }
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return -1;
         }
 
@@ -93,7 +93,7 @@ namespace gnut
             irc = tmp->pos(t, xyz, var, vel, false);
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return irc;
     }
 
@@ -105,7 +105,7 @@ namespace gnut
                        double vel[3],
                        const bool& chk_mask) // [m]
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         shared_ptr<t_geph> tmp = t_gallnav::_find(sat, iod, t, _chkHealth && chk_mask);
 
@@ -128,7 +128,7 @@ namespace gnut
                     vel[i] = 0.0;
                 }
             }
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return -1;
         }
 
@@ -139,32 +139,32 @@ namespace gnut
             irc = tmp->pos(t, xyz, var, vel, false);
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return irc;
     }
 
     bool t_gallnav::health(const string& sat, const t_gtime& t)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         shared_ptr<t_geph> tmp = t_gallnav::_find(sat, t, false);
 
         if (tmp == _null)
         {
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return false;
         }
 
         bool status = tmp->healthy();
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return status;
     }
 
     int t_gallnav::nav(const string& sat, const t_gtime& t, double xyz[3], double var[3], double vel[3],
                        const bool& chk_mask) // [m]
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         shared_ptr<t_geph> tmp = t_gallnav::_find(sat, t, _chkHealth && chk_mask);
 
@@ -182,12 +182,12 @@ namespace gnut
                     vel[i] = 0.0;
                 }
             }
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return -1;
         }
         int irc = tmp->nav(t, xyz, var, vel, _chkHealth && chk_mask);
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return irc;
     }
 
@@ -195,7 +195,7 @@ namespace gnut
     int t_gallnav::clk(const string& sat, const t_gtime& t, double* clk, double* var, double* dclk,
                        const bool& chk_mask) // [s]
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         shared_ptr<t_geph> tmp = t_gallnav::_find(sat, t, _chkHealth && chk_mask);
 
@@ -210,18 +210,52 @@ namespace gnut
             {
                 *dclk = 0.0;
             }
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return -1;
         }
 
         int irc = tmp->clk(t, clk, var, dclk, _chkHealth && chk_mask);
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return irc;
     }
 
+    void t_gallnav::pos(const vector<string>& sats,
+                        const vector<t_gtime>& t,
+                        vector<double>& xyz,
+                        vector<double>& vel,
+                        vector<int>& irc,
+                        const bool& chk_mask)
+    {
+        size_t n = sats.size();
+        xyz.assign(3 * n, 0.0);
+        vel.assign(3 * n, 0.0);
+        irc.assign(n, -1);
+        for (size_t i = 0; i < n && i < t.size(); i++)
+        {
+            irc[i] = this->pos(sats[i], t[i], &xyz[3 * i], NULL, &vel[3 * i], chk_mask);
+        }
+    }
+
+    void t_gallnav::clk(const vector<string>& sats,
+                        const vector<t_gtime>& t,
+                        vector<double>& clk,
+                        vector<double>& dclk,
+                        vector<int>& irc,
+                        const bool& chk_mask)
+    {
+        size_t n = sats.size();
+        clk.assign(n, 0.0);
+        dclk.assign(n, 0.0);
+        irc.assign(n, -1);
+        for (size_t i = 0; i < n && i < t.size(); i++)
+        {
+            irc[i] = this->clk(sats[i], t[i], &clk[i], NULL, &dclk[i], chk_mask);
+        }
+    }
+
     set<string> t_gallnav::satellites() const
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         set<string> all_sat;
         auto itPRN = _mapsat.begin();
@@ -232,13 +266,13 @@ namespace gnut
             itPRN++;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return all_sat;
     }
 
     int t_gallnav::add(shared_ptr<t_gnav> nav)
     {
-        _gmutex.lock();
+        _grwmutex.lock();
 
         t_gtime ep(nav->epoch());
         string sat = nav->sat();
@@ -291,13 +325,13 @@ namespace gnut
             }
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return 0;
     }
 
     unsigned int t_gallnav::nepochs(const string& prn)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         unsigned int tmp = 0;
         if (_mapsat.find(prn) != _mapsat.end())
@@ -305,7 +339,7 @@ namespace gnut
             tmp = _mapsat[prn].size();
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return tmp;
     }
 
@@ -324,7 +358,7 @@ namespace gnut
             return;
         }
 
-        _gmutex.lock();
+        _grwmutex.lock();
 
         // loop over all satellites
         auto itPRN = _mapsat.begin();
@@ -375,7 +409,7 @@ namespace gnut
             }
             itPRN++;
         }
-        _gmutex.unlock();
+        _grwmutex.unlock();
     }
 
     int t_gallnav::nsat(const GSYS& gs) const
@@ -420,10 +454,12 @@ namespace gnut
 
     void t_gallnav::add_iono_corr(const IONO_CORR& c, const t_iono_corr& io)
     {
+        _grwmutex.lock();
         if (_brdc_iono_cor.find(c) == _brdc_iono_cor.end())
         {
             _brdc_iono_cor[c] = io;
         }
+        _grwmutex.unlock();
     }
 
     shared_ptr<t_geph> t_gallnav::_find(const string& sat, const t_gtime& t, const bool& chk_mask)
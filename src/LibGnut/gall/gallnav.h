@@ -142,6 +142,42 @@ namespace gnut
                         double* dclk = NULL,
                         const bool& chk_mask = true);
 
+        /**
+         * @brief positions and velocities of several satellites (e.g. all satellites of an epoch).
+         *
+         * @param[in]  sats       satellites
+         * @param[in]  t          times (one per satellite)
+         * @param[out] xyz        positions [m], 3 per satellite
+         * @param[out] vel        velocities [m/s], 3 per satellite
+         * @param[out] irc        irc of pos() per satellite
+         * @param[in]  chk_mask
+         * @return    void
+         */
+        virtual void pos(const vector<string>& sats,
+                         const vector<t_gtime>& t,
+                         vector<double>& xyz,
+                         vector<double>& vel,
+                         vector<int>& irc,
+                         const bool& chk_mask = true);
+
+        /**
+         * @brief clock corrections of several satellites.
+         *
+         * @param[in]  sats       satellites
+         * @param[in]  t          times (one per satellite)
+         * @param[out] clk        clock offsets [s]
+         * @param[out] dclk       difference of clock offsets
+         * @param[out] irc        irc of clk() per satellite
+         * @param[in]  chk_mask
+         * @return    void
+         */
+        virtual void clk(const vector<string>& sats,
+                         const vector<t_gtime>& t,
+                         vector<double>& clk,
+                         vector<double>& dclk,
+                         vector<int>& irc,
+                         const bool& chk_mask = true);
+
         /**
          * @brief clean function.
          *
@@ -263,6 +299,7 @@ namespace gnut
         shared_ptr<t_geph> _null;     ///< null pointer
         t_map_iono _brdc_iono_cor;    ///< ionosphere correction in BRDC
         map<string, int> _gloFreqNum; ///< frequency number of GLONASS
+        mutable t_grwmutex _grwmutex; ///< shared for readers (processing threads), exclusive for decoders
     };
 
 } // namespace gnut
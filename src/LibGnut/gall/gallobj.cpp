@@ -37,22 +37,22 @@ namespace gnut
 
     t_gallobj::~t_gallobj()
     {
-        _gmutex.lock();
+        _grwmutex.lock();
         _mapobj.clear();
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return;
     }
 
     int t_gallobj::add(shared_ptr<t_gobj> obj)
     {
-        _gmutex.lock();
+        _grwmutex.lock();
 
         string s = obj->id();
 
         // object empty
         if (obj->id().empty())
         {
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return -1;
         }
 
@@ -64,26 +64,26 @@ namespace gnut
         else
         {
             GREAT_DEBUG("warning - cannot overwrite object: " + s);
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return -1;
         }
 
         _mapobj[s]->sync_pcv(_gpcv);
 
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return 0;
     }
 
     shared_ptr<t_gobj> t_gallobj::obj(const string& s)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         shared_ptr<t_gobj> p_obj;
 
         t_map_obj::iterator it = _mapobj.find(s);
         if (it == _mapobj.end())
         {
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return p_obj;
         }
         else
@@ -91,13 +91,13 @@ namespace gnut
             p_obj = it->second;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return p_obj;
     }
 
     map<string, shared_ptr<t_gobj>> t_gallobj::objects(const t_gdata::ID_TYPE& id)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         map<string, shared_ptr<t_gobj>> all_obj;
         t_map_obj::const_iterator itOBJ = _mapobj.begin();
@@ -114,13 +114,13 @@ namespace gnut
             ++itOBJ;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return all_obj;
     }
 
     void t_gallobj::sync_pcvs()
     {
-        _gmutex.lock();
+        _grwmutex.lock();
 
         t_map_obj::const_iterator itOBJ = _mapobj.begin();
 
@@ -129,7 +129,7 @@ namespace gnut
             itOBJ->second->sync_pcv(_gpcv);
             ++itOBJ;
         }
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return;
     }
 
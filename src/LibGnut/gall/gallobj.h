@@ -105,6 +105,7 @@ namespace gnut
 
     private:
         t_map_obj _mapobj; ///< map of all objects
+        mutable t_grwmutex _grwmutex; ///< shared for readers (processing threads), exclusive for decoders
         t_gallpcv* _gpcv;  ///< map of all PCV
         t_gallotl* _gotl;  ///< map of all otl
 
@@ -59,7 +59,7 @@ namespace gnut
 
     set<string> t_gallobs::stations()
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         set<string> all_sites;
         t_map_oobj::const_iterator itSITE = _mapobj.begin();
@@ -69,16 +69,16 @@ namespace gnut
             all_sites.insert(itSITE->first);
             ++itSITE;
         }
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return all_sites;
     }
 
     set<string> t_gallobs::sats(const string& site, const t_gtime& t, GSYS gnss)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         set<string> all_sats = _sats(site, t, gnss);
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return all_sats;
     }
 
@@ -86,13 +86,19 @@ namespace gnut
     {
         set<string> all_sats;
 
-        if (_mapobj.find(site) == _mapobj.end() || _mapobj[site].find(t) == _mapobj[site].end())
+        auto itSITE = _mapobj.find(site);
+        if (itSITE == _mapobj.end())
+        {
+            return all_sats;
+        }
+        auto itEPO = itSITE->second.find(t);
+        if (itEPO == itSITE->second.end())
         {
             return all_sats;
         }
 
-        t_map_osat::const_iterator itSAT = _mapobj[site][t].begin();
-        while (itSAT != _mapobj[site][t].end())
+        t_map_osat::const_iterator itSAT = itEPO->second.begin();
+        while (itSAT != itEPO->second.end())
         {
             GSYS sys = itSAT->second->gsys();
             if (gnss == GNS)
@@ -130,11 +136,11 @@ namespace gnut
 
     vector<t_gsatdata> t_gallobs::obs(const string& site, const t_gtime& t)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         vector<t_gsatdata> all_obs = _gobs(site, t);
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return all_obs;
     }
 
@@ -148,85 +154,118 @@ namespace gnut
             return all_obs;
         }
 
-        t_map_osat::const_iterator itSAT = _mapobj[site][tt].begin();
-        while (itSAT != _mapobj[site][tt].end())
+        const t_map_osat& osat = _mapobj.find(site)->second.find(tt)->second;
+        all_obs.reserve(osat.size());
+        t_map_osat::const_iterator itSAT = osat.begin();
+        while (itSAT != osat.end())
         {
-            t_gsatdata tmp(*itSAT->second);
-            all_obs.push_back(tmp);
+            all_obs.emplace_back(*itSAT->second);
             itSAT++;
         }
 
         return all_obs;
     }
 
+    int t_gallobs::obs(const string& site, const t_gtime& t, vector<t_gsatdata>& data)
+    {
+        _grwmutex.lock_shared();
+
+        size_t nsat = 0;
+        t_gtime tt(t_gtime::GPS);
+        if (_find_epo(site, t, tt) >= 0)
+        {
+            const t_map_osat& osat = _mapobj.find(site)->second.find(tt)->second;
+            for (auto itSAT = osat.begin(); itSAT != osat.end(); ++itSAT, ++nsat)
+            {
+                if (nsat < data.size())
+                {
+                    data[nsat].reset(*itSAT->second);
+                }
+                else
+                {
+                    data.emplace_back(*itSAT->second);
+                }
+            }
+        }
+
+        _grwmutex.unlock_shared();
+
+        data.erase(data.begin() + nsat, data.end());
+        return static_cast<int>(nsat);
+    }
+
     vector<t_spt_gobs> t_gallobs::obs_pt(const string& site, const t_gtime& t)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         vector<t_spt_gobs> all_obs;
         t_gtime tt(t_gtime::GPS);
 
         if (_find_epo(site, t, tt) < 0)
         {
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return all_obs;
         }
 
-        t_map_osat::iterator itSAT = _mapobj[site][tt].begin();
-        while (itSAT != _mapobj[site][tt].end())
+        const t_map_osat& osat = _mapobj.find(site)->second.find(tt)->second;
+        t_map_osat::const_iterator itSAT = osat.begin();
+        while (itSAT != osat.end())
         {
-            string sat = itSAT->first;
-
             // TESTING NEW METHOD
             all_obs.push_back(dynamic_pointer_cast<t_gobsgnss>(itSAT->second));
 
             itSAT++;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return all_obs;
     }
 
     vector<t_gtime> t_gallobs::epochs(const string& site)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         vector<t_gtime> all_epochs;
 
-        if (_mapobj.find(site) == _mapobj.end())
+        auto itSITE = _mapobj.find(site);
+        if (itSITE == _mapobj.end())
         {
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return all_epochs;
         }
 
-        t_map_oref::iterator it = _mapobj[site].begin();
+        all_epochs.reserve(itSITE->second.size());
+        t_map_oref::const_iterator it = itSITE->second.begin();
 
-        while (it != _mapobj[site].end())
+        while (it != itSITE->second.end())
         {
             all_epochs.push_back(it->first);
             ++it;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return all_epochs;
     }
 
     t_gtime t_gallobs::beg_obs(const string& site, double smpl)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         t_gtime tmp = LAST_TIME;
 
-        if (_mapobj.find(site) != _mapobj.end() && _mapobj[site].begin() != _mapobj[site].end())
+        auto itSITE = _mapobj.find(site);
+        if (itSITE == _mapobj.end() || itSITE->second.empty())
         {
-            tmp = _mapobj[site].begin()->first;
+            _grwmutex.unlock_shared();
+            return tmp;
         }
+        tmp = itSITE->second.begin()->first;
 
         // get first synchronized obs
         if (smpl > 0.0)
         {
-            auto itEpoB = _mapobj[site].begin();
-            auto itEpoE = _mapobj[site].end();
+            auto itEpoB = itSITE->second.begin();
+            auto itEpoE = itSITE->second.end();
             int sod = static_cast<int>(dround(itEpoB->first.sod() + itEpoB->first.dsec()));
 
             while (sod % static_cast<int>(smpl) != 0 && ++itEpoB != itEpoE)
@@ -238,52 +277,30 @@ namespace gnut
             }
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return tmp;
     }
 
     t_gtime t_gallobs::end_obs(const string& site)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         t_gtime tmp = FIRST_TIME;
-        if (_mapobj.find(site) != _mapobj.end() && _mapobj[site].begin() != _mapobj[site].end())
+        auto itSITE = _mapobj.find(site);
+        if (itSITE != _mapobj.end() && !itSITE->second.empty())
         {
-            tmp = _mapobj[site].rbegin()->first;
+            tmp = itSITE->second.rbegin()->first;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return tmp;
     }
 
     int t_gallobs::addobs(t_spt_gobs obs)
     {
-        _gmutex.lock();
+        _grwmutex.lock();
 
-        // repair small out-sync ( < 10 ms )
-        double outsync = fmod(obs->epoch().dsec(), _smp) - round(fmod(obs->epoch().dsec(), _smp));
-        if (fabs(outsync) < 0.014 && fabs(outsync) > 1e-6)
-        {
-            obs->epo(obs->epoch() - outsync);
-            vector<GOBS> v_obs = obs->obs();
-            vector<GOBS>::iterator itOBS = v_obs.begin();
-            for (; itOBS != v_obs.end(); ++itOBS)
-            {
-                GOBSTYPE obstype = str2gobstype(gobs2str(*itOBS));
-                if (obstype == TYPE_P || obstype == TYPE_C)
-                {
-                    obs->resetobs(*itOBS, obs->getobs(*itOBS) - CLIGHT * outsync);
-                }
-                else if (obstype == TYPE_L)
-                {
-                    obs->resetobs(*itOBS, obs->getobs(*itOBS) - CLIGHT * outsync / obs->wavelength(str2gobsband(gobs2str(*itOBS))));
-                }
-                else if (obstype == TYPE_S)
-                { // add wh
-                    obs->resetobs(*itOBS, obs->getobs(*itOBS));
-                }
-            }
-        }
+        _sync_obs(obs);
 
         t_gtime t(obs->epoch()), tt = t;
         string site = obs->site();
@@ -328,57 +345,84 @@ namespace gnut
             else
             {
                 GREAT_WARN("warning: t_gobsgnss record not identified!");
-                _gmutex.unlock();
+                _grwmutex.unlock();
                 return 1;
             }
         }
         else
         {
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return 0;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return 0;
     }
 
+    void t_gallobs::_sync_obs(t_spt_gobs obs)
+    {
+        // repair small out-sync ( < 10 ms )
+        double outsync = fmod(obs->epoch().dsec(), _smp) - round(fmod(obs->epoch().dsec(), _smp));
+        if (fabs(outsync) < 0.014 && fabs(outsync) > 1e-6)
+        {
+            obs->epo(obs->epoch() - outsync);
+            vector<GOBS> v_obs = obs->obs();
+            vector<GOBS>::iterator itOBS = v_obs.begin();
+            for (; itOBS != v_obs.end(); ++itOBS)
+            {
+                GOBSTYPE obstype = str2gobstype(gobs2str(*itOBS));
+                if (obstype == TYPE_P || obstype == TYPE_C)
+                {
+                    obs->resetobs(*itOBS, obs->getobs(*itOBS) - CLIGHT * outsync);
+                }
+                else if (obstype == TYPE_L)
+                {
+                    obs->resetobs(*itOBS, obs->getobs(*itOBS) - CLIGHT * outsync / obs->wavelength(str2gobsband(gobs2str(*itOBS))));
+                }
+                else if (obstype == TYPE_S)
+                { // add wh
+                    obs->resetobs(*itOBS, obs->getobs(*itOBS));
+                }
+            }
+        }
+    }
+
     t_gallobs::t_map_osat t_gallobs::find(const string& site, const t_gtime& t)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         t_gtime tt(t_gtime::GPS);
         t_map_osat tmp;
         if (_find_epo(site, t, tt) < 0)
         {
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return tmp;
         }
 
-        _gmutex.unlock();
-        return _mapobj[site][tt];
+        tmp = _mapobj.find(site)->second.find(tt)->second;
+        _grwmutex.unlock_shared();
+        return tmp;
     }
 
     t_gallobs::t_map_frq t_gallobs::frqobs(const string& site)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         t_map_frq mfrq;
 
-        if (_mapobj.find(site) == _mapobj.end())
+        auto itSITE = _mapobj.find(site);
+        if (itSITE == _mapobj.end())
         {
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return mfrq;
         }
 
-        t_map_oref::const_iterator itEpo = _mapobj[site].begin();
-        t_map_osat::iterator itSat;
+        t_map_oref::const_iterator itEpo = itSITE->second.begin();
+        t_map_osat::const_iterator itSat;
 
-        t_gtime t;
-
-        while (itEpo != _mapobj[site].end())
+        while (itEpo != itSITE->second.end())
         {
-            t = itEpo->first;
-            for (itSat = _mapobj[site][t].begin(); itSat != _mapobj[site][t].end(); itSat++)
+            for (itSat = itEpo->second.begin(); itSat != itEpo->second.end(); itSat++)
             { // loop over satellites
                 string prn = itSat->first;
                 t_spt_gobs obs = itSat->second;
@@ -395,40 +439,76 @@ namespace gnut
             itEpo++;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return mfrq;
     }
 
+    void t_gallobs::clean_outer(const string& site, const t_gtime& beg, const t_gtime& end)
+    {
+        _grwmutex.lock();
+
+        auto itSITE = _mapobj.find(site);
+        if (itSITE != _mapobj.end())
+        {
+            t_map_oref& mepo = itSITE->second;
+            mepo.erase(mepo.begin(), mepo.lower_bound(beg));
+            mepo.erase(mepo.upper_bound(end), mepo.end());
+        }
+
+        _grwmutex.unlock();
+        return;
+    }
+
     void t_gallobs::xdata(const string& site, const string& file, const t_xfilter& xflt)
     {
-        _gmutex.lock();
+        _grwmutex.lock();
 
-        _filter[site][file].xdat = xflt.xdat;
-        _filter[site][file].beg = xflt.beg;
-        _filter[site][file].end = xflt.end;
+        // blocks of one file decoded in parallel report separately, merged independent of their order
+        auto itFILE = _filter[site].find(file);
+        if (itFILE == _filter[site].end())
+        {
+            _filter[site][file] = xflt;
+        }
+        else
+        {
+            t_xfilter& all = itFILE->second;
+            for (const auto& itX : xflt.xdat)
+            {
+                all.xdat[itX.first] += itX.second;
+            }
+            if (xflt.beg < all.beg)
+            {
+                all.beg = xflt.beg;
+            }
+            if (xflt.end > all.end)
+            {
+                all.end = xflt.end;
+            }
+        }
 
-        _gmutex.unlock();
+        _grwmutex.unlock();
     }
 
     unsigned int t_gallobs::nepochs(const string& site)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
-        if (_mapobj.find(site) == _mapobj.end())
+        auto itSITE = _mapobj.find(site);
+        if (itSITE == _mapobj.end())
         {
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
             return 0;
         }
 
-        unsigned int tmp = _mapobj[site].size();
+        unsigned int tmp = itSITE->second.size();
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return tmp;
     }
 
     bool t_gallobs::isSite(const string& site)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         bool tmp = false;
         if (_mapobj.find(site) != _mapobj.end())
@@ -436,30 +516,31 @@ namespace gnut
             tmp = true;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return tmp;
     }
 
     int t_gallobs::_find_epo(const string& site, const t_gtime& epo, t_gtime& tt)
     {
-        if (_mapobj.find(site) == _mapobj.end())
+        auto itSITE = _mapobj.find(site);
+        if (itSITE == _mapobj.end() || itSITE->second.empty())
         {
             return -1;
         }
 
-        t_map_oref::iterator it1 = _mapobj[site].lower_bound(epo); // greater || equal
-        t_map_oref::iterator it0 = it1;                            // previous value
+        t_map_oref::const_iterator it1 = itSITE->second.lower_bound(epo); // greater || equal
+        t_map_oref::const_iterator it0 = it1;                             // previous value
 
-        if (it0 != _mapobj[site].begin())
+        if (it0 != itSITE->second.begin())
         {
             it0--;
         }
-        if (it1 == _mapobj[site].end())
+        if (it1 == itSITE->second.end())
         {
             it1 = it0;
         }
 
-        if (it1 == _mapobj[site].end() && it0 == _mapobj[site].end())
+        if (it1 == itSITE->second.end() && it0 == itSITE->second.end())
         {
             return -1;
         }
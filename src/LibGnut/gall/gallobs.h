@@ -138,6 +138,19 @@ namespace gnut
          */
         virtual vector<t_gsatdata> obs(const string& site, const t_gtime& t);
 
+        /**
+         * @brief fill caller-owned epoch buffer with t_gsatdata for epoch t
+         *
+         * Elements already in data are re-initialised in place (t_gsatdata::reset),
+         * so a buffer kept by the caller between epochs avoids rebuilding the vector.
+         *
+         * @param site
+         * @param t
+         * @param data epoch buffer, resized to the number of satellites
+         * @return int number of satellites
+         */
+        virtual int obs(const string& site, const t_gtime& t, vector<t_gsatdata>& data);
+
         /**
          * @brief get all t_gobsgnss pointers for epoch t
          *
@@ -175,6 +188,9 @@ namespace gnut
         /**
          * @brief add site-specific filtered data/epochs
          *
+         * Repeated calls for the same file (blocks decoded in parallel) are merged:
+         * counters are added, the earliest begin and the latest end are kept.
+         *
          * @param site
          * @param file
          * @param xflt
@@ -187,7 +203,7 @@ namespace gnut
          * @param obs
          * @return int
          */
-        int addobs(t_spt_gobs obs);
+        virtual int addobs(t_spt_gobs obs);
 
         /**
          * @brief number of epochs for station
@@ -195,7 +211,7 @@ namespace gnut
          * @param site
          * @return unsigned int
          */
-        unsigned int nepochs(const string& site);
+        virtual unsigned int nepochs(const string& site);
 
         /**
          * @brief find appropriate t_gobsgnss element for site/epoch
@@ -212,7 +228,16 @@ namespace gnut
          * @param site
          * @return t_map_frq
          */
-        t_map_frq frqobs(const string& site);
+        virtual t_map_frq frqobs(const string& site);
+
+        /**
+         * @brief remove epochs of the site outside the interval (processed epochs in streaming mode)
+         *
+         * @param site
+         * @param beg first epoch kept
+         * @param end last epoch kept
+         */
+        virtual void clean_outer(const string& site, const t_gtime& beg = FIRST_TIME, const t_gtime& end = LAST_TIME);
 
         /**
          * @brief add site crd
@@ -222,17 +247,22 @@ namespace gnut
          */
         void addsitecrd(const string& site, const t_gtriple& crd)
         {
+            _grwmutex.lock();
             _mapcrds[site] = crd;
+            _grwmutex.unlock();
         }
 
         /**
          * @brief glo freq num
          *
-         * @return map<string, int>
+         * @return map<string, int> (copy, decoders may still add frequencies)
          */
-        const map<string, int>& glo_freq_num() const
+        map<string, int> glo_freq_num() const
         {
-            return _glofrq;
+            _grwmutex.lock_shared();
+            map<string, int> glofrq = _glofrq;
+            _grwmutex.unlock_shared();
+            return glofrq;
         }
 
         /**
@@ -243,10 +273,12 @@ namespace gnut
          */
         void add_glo_freq(const string& sat, int freqNum)
         {
+            _grwmutex.lock();
             if (_glofrq.find(sat) == _glofrq.end())
             {
                 _glofrq[sat] = freqNum;
             }
+            _grwmutex.unlock();
         }
 
     protected:
@@ -256,6 +288,9 @@ namespace gnut
         /**@brief return all obs */
         virtual vector<t_gsatdata> _gobs(const string& site, const t_gtime& t);
 
+        /**@brief repair small out-sync (< 10 ms) of the observation epoch */
+        void _sync_obs(t_spt_gobs obs);
+
         /**@brief find epoch from the map */
         int _find_epo(const string& site, const t_gtime& epo, t_gtime& tt);
 
@@ -271,6 +306,7 @@ namespace gnut
         map<string, t_gtriple> _mapcrds; ///< all sites apr coordinates
         map<string, int> _glofrq;        ///< map of GLONASS slot/frequency
         set<string> _map_sites;          ///< map of sites
+        mutable t_grwmutex _grwmutex;    ///< shared for readers (processing threads), exclusive for decoders
     private:
     };
 
@@ -0,0 +1,749 @@
+/**
+ * @file         gallobscol.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Columnar (structure-of-arrays) container for all observations
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <algorithm>
+#include "gall/gallobscol.h"
+#include "gio/great_log.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_gallobscol::t_gallobscol() :
+        t_gallobs()
+    {
+    }
+
+    t_gallobscol::t_gallobscol(t_gsetbase* set) :
+        t_gallobs(set)
+    {
+    }
+
+    t_gallobscol::~t_gallobscol()
+    {
+        _cols.clear();
+    }
+
+    set<string> t_gallobscol::stations()
+    {
+        _grwmutex.lock_shared();
+
+        set<string> all_sites;
+        for (auto itSITE = _cols.begin(); itSITE != _cols.end(); ++itSITE)
+        {
+            all_sites.insert(itSITE->first);
+        }
+
+        _grwmutex.unlock_shared();
+        return all_sites;
+    }
+
+    bool t_gallobscol::isSite(const string& site)
+    {
+        _grwmutex.lock_shared();
+        bool tmp = (_cols.find(site) != _cols.end());
+        _grwmutex.unlock_shared();
+        return tmp;
+    }
+
+    set<string> t_gallobscol::sats(const string& site, const t_gtime& t, GSYS gnss)
+    {
+        set<string> all_sats;
+
+        t_obscol* col = _site_col(site);
+        if (col)
+        {
+            auto itEPO = lower_bound(col->epo.begin(), col->epo.end(), t);
+            if (itEPO != col->epo.end() && *itEPO == t)
+            {
+                size_t iepo = itEPO - col->epo.begin();
+                for (unsigned int row = col->row0[iepo]; row < col->row0[iepo + 1]; ++row)
+                {
+                    const string& sat = _satnames[col->sat[row]];
+                    if (gnss == GNS || t_gsys::char2gsys(sat[0]) == gnss)
+                    {
+                        all_sats.insert(sat);
+                    }
+                }
+            }
+        }
+
+        _grwmutex.unlock_shared();
+        return all_sats;
+    }
+
+    vector<t_gsatdata> t_gallobscol::obs(const string& site, const t_gtime& t)
+    {
+        vector<t_gsatdata> all_obs;
+
+        t_obscol* col = _site_col(site);
+        if (col)
+        {
+            col->mtx.lock();
+            int iepo = _col_epo(col->epo, t);
+            if (iepo >= 0 && iepo == col->live_epo)
+            {
+                all_obs.reserve(col->live.size());
+                for (const auto& obs : col->live)
+                {
+                    all_obs.emplace_back(*obs);
+                }
+            }
+            else if (iepo >= 0)
+            {
+                all_obs.reserve(col->row0[iepo + 1] - col->row0[iepo]);
+                for (unsigned int row = col->row0[iepo]; row < col->row0[iepo + 1]; ++row)
+                {
+                    t_gobsgnss obs(site, _satnames[col->sat[row]], col->epo[iepo]);
+                    _fill(*col, row, obs);
+                    all_obs.emplace_back(obs);
+                }
+            }
+            col->mtx.unlock();
+        }
+
+        _grwmutex.unlock_shared();
+        return all_obs;
+    }
+
+    int t_gallobscol::obs(const string& site, const t_gtime& t, vector<t_gsatdata>& data)
+    {
+        size_t nsat = 0;
+
+        t_obscol* col = _site_col(site);
+        if (col)
+        {
+            col->mtx.lock();
+            int iepo = _col_epo(col->epo, t);
+            if (iepo >= 0 && iepo == col->live_epo)
+            {
+                for (; nsat < col->live.size(); ++nsat)
+                {
+                    if (nsat < data.size())
+                    {
+                        data[nsat].reset(*col->live[nsat]);
+                    }
+                    else
+                    {
+                        data.emplace_back(*col->live[nsat]);
+                    }
+                }
+            }
+            else if (iepo >= 0)
+            {
+                // rows are decoded straight into the caller's buffers, no shared objects are created
+                for (unsigned int row = col->row0[iepo]; row < col->row0[iepo + 1]; ++row, ++nsat)
+                {
+                    t_gobsgnss obs(site, _satnames[col->sat[row]], col->epo[iepo]);
+                    _fill(*col, row, obs);
+                    if (nsat < data.size())
+                    {
+                        data[nsat].reset(obs);
+                    }
+                    else
+                    {
+                        data.emplace_back(obs);
+                    }
+                }
+            }
+            col->mtx.unlock();
+        }
+
+        _grwmutex.unlock_shared();
+
+        data.erase(data.begin() + nsat, data.end());
+        return static_cast<int>(nsat);
+    }
+
+    vector<t_spt_gobs> t_gallobscol::obs_pt(const string& site, const t_gtime& t)
+    {
+        vector<t_spt_gobs> all_obs;
+
+        t_obscol* col = _site_col(site);
+        if (col)
+        {
+            col->mtx.lock();
+            int iepo = _col_epo(col->epo, t);
+            if (iepo >= 0)
+            {
+                if (iepo != col->live_epo)
+                {
+                    _release_live(*col);
+                    col->live = _epoch_pt(site, *col, iepo);
+                    col->live_epo = iepo;
+                }
+                all_obs = col->live;
+            }
+            col->mtx.unlock();
+        }
+
+        _grwmutex.unlock_shared();
+        return all_obs;
+    }
+
+    vector<t_gtime> t_gallobscol::epochs(const string& site)
+    {
+        vector<t_gtime> all_epochs;
+
+        t_obscol* col = _site_col(site);
+        if (col)
+        {
+            all_epochs = col->epo;
+        }
+
+        _grwmutex.unlock_shared();
+        return all_epochs;
+    }
+
+    t_gtime t_gallobscol::beg_obs(const string& site, double smpl)
+    {
+        t_gtime tmp = LAST_TIME;
+
+        t_obscol* col = _site_col(site);
+        if (!col || col->epo.empty())
+        {
+            _grwmutex.unlock_shared();
+            return tmp;
+        }
+        tmp = col->epo.front();
+
+        // get first synchronized obs
+        if (smpl > 0.0)
+        {
+            auto itEpoB = col->epo.begin();
+            auto itEpoE = col->epo.end();
+            int sod = static_cast<int>(dround(itEpoB->sod() + itEpoB->dsec()));
+
+            while (sod % static_cast<int>(smpl) != 0 && ++itEpoB != itEpoE)
+            {
+                sod = static_cast<int>(dround(itEpoB->sod() + itEpoB->dsec()));
+                tmp = *itEpoB;
+                tmp.reset_sod();
+                tmp.add_secs(sod);
+            }
+        }
+
+        _grwmutex.unlock_shared();
+        return tmp;
+    }
+
+    t_gtime t_gallobscol::end_obs(const string& site)
+    {
+        t_gtime tmp = FIRST_TIME;
+
+        t_obscol* col = _site_col(site);
+        if (col && !col->epo.empty())
+        {
+            tmp = col->epo.back();
+        }
+
+        _grwmutex.unlock_shared();
+        return tmp;
+    }
+
+    int t_gallobscol::addobs(t_spt_gobs obs)
+    {
+        if (obs->id_type() != t_gdata::OBSGNSS)
+        {
+            GREAT_WARN("warning: t_gobsgnss record not identified!");
+            return 1;
+        }
+
+        _grwmutex.lock();
+
+        _sync_obs(obs);
+        _map_sites.insert(obs->site());
+        _cols[obs->site()].stage.push_back(obs);
+
+        _grwmutex.unlock();
+        return 0;
+    }
+
+    unsigned int t_gallobscol::nepochs(const string& site)
+    {
+        unsigned int tmp = 0;
+
+        t_obscol* col = _site_col(site);
+        if (col)
+        {
+            tmp = col->epo.size();
+        }
+
+        _grwmutex.unlock_shared();
+        return tmp;
+    }
+
+    t_gallobs::t_map_osat t_gallobscol::find(const string& site, const t_gtime& t)
+    {
+        t_map_osat tmp;
+
+        t_obscol* col = _site_col(site);
+        if (col)
+        {
+            col->mtx.lock();
+            int iepo = _col_epo(col->epo, t);
+            if (iepo >= 0)
+            {
+                vector<t_spt_gobs> all_obs = _epoch_pt(site, *col, iepo);
+                for (const auto& obs : all_obs)
+                {
+                    tmp[obs->sat()] = obs;
+                }
+            }
+            col->mtx.unlock();
+        }
+
+        _grwmutex.unlock_shared();
+        return tmp;
+    }
+
+    t_gallobs::t_map_frq t_gallobscol::frqobs(const string& site)
+    {
+        t_map_frq mfrq;
+
+        t_obscol* col = _site_col(site);
+        if (col)
+        {
+            col->mtx.lock();
+            size_t nslot = col->slot.size();
+            for (size_t row = 0; row < col->sat.size(); ++row)
+            {
+                const string& prn = _satnames[col->sat[row]];
+                for (size_t s = 0; s < nslot; ++s)
+                {
+                    if (col->flag[row * nslot + s] & FLAG_OBS)
+                    {
+                        GOBS gobs = col->slot[s];
+                        mfrq[prn][int2gobsband(gobs2band(gobs))][gobs]++;
+                    }
+                }
+            }
+            col->mtx.unlock();
+        }
+
+        _grwmutex.unlock_shared();
+        return mfrq;
+    }
+
+    void t_gallobscol::clean_outer(const string& site, const t_gtime& beg, const t_gtime& end)
+    {
+        _grwmutex.lock();
+
+        auto itSITE = _cols.find(site);
+        if (itSITE == _cols.end())
+        {
+            _grwmutex.unlock();
+            return;
+        }
+        t_obscol& col = itSITE->second;
+        if (!col.stage.empty())
+        {
+            _compact(site, col);
+        }
+        _release_live(col);
+
+        // kept epochs [e0, e1) and rows [r0, r1)
+        size_t e0 = lower_bound(col.epo.begin(), col.epo.end(), beg) - col.epo.begin();
+        size_t e1 = upper_bound(col.epo.begin(), col.epo.end(), end) - col.epo.begin();
+        if (e1 < e0)
+        {
+            e1 = e0;
+        }
+        if (e0 == 0 && e1 == col.epo.size())
+        {
+            _grwmutex.unlock();
+            return;
+        }
+
+        size_t nslot = col.slot.size();
+        unsigned int r0 = col.row0[e0];
+        unsigned int r1 = col.row0[e1];
+
+        col.epo.erase(col.epo.begin() + e1, col.epo.end());
+        col.epo.erase(col.epo.begin(), col.epo.begin() + e0);
+        col.row0.erase(col.row0.begin() + e1 + 1, col.row0.end());
+        col.row0.erase(col.row0.begin(), col.row0.begin() + e0);
+        for (auto& row : col.row0)
+        {
+            row -= r0;
+        }
+        col.sat.erase(col.sat.begin() + r1, col.sat.end());
+        col.sat.erase(col.sat.begin(), col.sat.begin() + r0);
+        col.chn.erase(col.chn.begin() + r1, col.chn.end());
+        col.chn.erase(col.chn.begin(), col.chn.begin() + r0);
+        col.val.erase(col.val.begin() + r1 * nslot, col.val.end());
+        col.val.erase(col.val.begin(), col.val.begin() + r0 * nslot);
+        col.lli.erase(col.lli.begin() + r1 * nslot, col.lli.end());
+        col.lli.erase(col.lli.begin(), col.lli.begin() + r0 * nslot);
+        col.flag.erase(col.flag.begin() + r1 * nslot, col.flag.end());
+        col.flag.erase(col.flag.begin(), col.flag.begin() + r0 * nslot);
+
+        // sparse cells are shifted with their rows
+        for (map<size_t, int>* cells : {&col.slip, &col.outlier})
+        {
+            map<size_t, int> kept;
+            for (auto itCELL = cells->lower_bound(r0 * nslot); itCELL != cells->end() && itCELL->first < r1 * nslot; ++itCELL)
+            {
+                kept[itCELL->first - r0 * nslot] = itCELL->second;
+            }
+            cells->swap(kept);
+        }
+
+        _grwmutex.unlock();
+        return;
+    }
+
+    size_t t_gallobscol::memory(const string& site)
+    {
+        size_t bytes = 0;
+
+        t_obscol* col = _site_col(site);
+        if (col)
+        {
+            bytes += col->epo.capacity() * sizeof(t_gtime);
+            bytes += col->row0.capacity() * sizeof(unsigned int);
+            bytes += col->sat.capacity() * sizeof(unsigned short);
+            bytes += col->chn.capacity() * sizeof(short);
+            bytes += col->slot.capacity() * sizeof(GOBS);
+            bytes += col->val.capacity() * sizeof(double);
+            bytes += col->lli.capacity() + col->flag.capacity();
+            bytes += (col->slip.size() + col->outlier.size()) * (sizeof(size_t) + sizeof(int) + 4 * sizeof(void*));
+        }
+
+        _grwmutex.unlock_shared();
+        return bytes;
+    }
+
+    t_gallobscol::t_obscol* t_gallobscol::_site_col(const string& site)
+    {
+        _grwmutex.lock_shared();
+
+        auto itSITE = _cols.find(site);
+        if (itSITE == _cols.end())
+        {
+            return nullptr;
+        }
+
+        // first read after decoding, merge the staged records (map nodes stay valid)
+        if (!itSITE->second.stage.empty())
+        {
+            _grwmutex.unlock_shared();
+            _grwmutex.lock();
+            if (!itSITE->second.stage.empty())
+            {
+                _compact(site, itSITE->second);
+            }
+            _grwmutex.unlock();
+            _grwmutex.lock_shared();
+        }
+
+        return &itSITE->second;
+    }
+
+    void t_gallobscol::_compact(const string& site, t_obscol& col)
+    {
+        _release_live(col);
+
+        // records sorted by epoch, decoding order kept for the same epoch
+        vector<t_spt_gobs>& stage = col.stage;
+        stable_sort(stage.begin(), stage.end(), [](const t_spt_gobs& a, const t_spt_gobs& b) {
+            return a->epoch() < b->epoch();
+        });
+
+        // new epochs, records within DIFF_SEC share the first epoch (as in t_gallobs)
+        t_obscol cmp;
+        vector<t_gtime> epo_add;
+        for (const auto& obs : stage)
+        {
+            const t_gtime& t = obs->epoch();
+            if (_col_epo(col.epo, t) < 0 && (epo_add.empty() || fabs(t - epo_add.back()) > DIFF_SEC(_smp)))
+            {
+                epo_add.push_back(t);
+            }
+        }
+        cmp.epo.reserve(col.epo.size() + epo_add.size());
+        merge(col.epo.begin(), col.epo.end(), epo_add.begin(), epo_add.end(), back_inserter(cmp.epo));
+
+        // slots: existing ones keep their index, new GOBS are appended
+        cmp.slot = col.slot;
+        set<GOBS> known(col.slot.begin(), col.slot.end());
+        for (const auto& obs : stage)
+        {
+            for (const GOBS& gobs : obs->obs())
+            {
+                if (known.insert(gobs).second)
+                {
+                    cmp.slot.push_back(gobs);
+                }
+            }
+        }
+
+        // rows of each epoch: existing row (old >= 0) or staged record (rec >= 0)
+        struct t_row
+        {
+            unsigned short sat;
+            int old;
+            int rec;
+        };
+        vector<vector<t_row>> rows(cmp.epo.size());
+        for (size_t iold = 0; iold < col.epo.size(); ++iold)
+        {
+            size_t iepo = lower_bound(cmp.epo.begin(), cmp.epo.end(), col.epo[iold]) - cmp.epo.begin();
+            for (unsigned int row = col.row0[iold]; row < col.row0[iold + 1]; ++row)
+            {
+                rows[iepo].push_back({col.sat[row], int(row), -1});
+            }
+        }
+        for (size_t irec = 0; irec < stage.size(); ++irec)
+        {
+            int iepo = _col_epo(cmp.epo, stage[irec]->epoch());
+            unsigned short isat = _sat_index(stage[irec]->sat());
+            auto itROW = find_if(rows[iepo].begin(), rows[iepo].end(), [isat](const t_row& r) { return r.sat == isat; });
+            if (itROW == rows[iepo].end())
+            {
+                rows[iepo].push_back({isat, -1, int(irec)});
+            }
+            else if (_overwrite)
+            {
+                *itROW = {isat, -1, int(irec)};
+            }
+        }
+
+        // fill the new arrays, satellites ordered by name as in t_gallobs
+        size_t nrow = 0;
+        for (const auto& epo_rows : rows)
+        {
+            nrow += epo_rows.size();
+        }
+        size_t nslot = cmp.slot.size();
+        size_t nslot_old = col.slot.size();
+        cmp.row0.reserve(cmp.epo.size() + 1);
+        cmp.sat.reserve(nrow);
+        cmp.chn.reserve(nrow);
+        cmp.val.assign(nrow * nslot, 0.0);
+        cmp.lli.assign(nrow * nslot, 0);
+        cmp.flag.assign(nrow * nslot, 0);
+
+        for (auto& epo_rows : rows)
+        {
+            sort(epo_rows.begin(), epo_rows.end(), [this](const t_row& a, const t_row& b) {
+                return _satnames[a.sat] < _satnames[b.sat];
+            });
+
+            cmp.row0.push_back(cmp.sat.size());
+            for (const auto& r : epo_rows)
+            {
+                size_t row = cmp.sat.size();
+                cmp.sat.push_back(r.sat);
+                if (r.old >= 0)
+                {
+                    cmp.chn.push_back(col.chn[r.old]);
+                    for (size_t s = 0; s < nslot_old; ++s)
+                    {
+                        size_t cell_old = r.old * nslot_old + s;
+                        size_t cell = row * nslot + s;
+                        cmp.val[cell] = col.val[cell_old];
+                        cmp.lli[cell] = col.lli[cell_old];
+                        cmp.flag[cell] = col.flag[cell_old];
+                        if (cmp.flag[cell] & FLAG_SLIP)
+                        {
+                            cmp.slip[cell] = col.slip[cell_old];
+                        }
+                        if (cmp.flag[cell] & FLAG_OUTLIER)
+                        {
+                            cmp.outlier[cell] = col.outlier[cell_old];
+                        }
+                    }
+                }
+                else
+                {
+                    cmp.chn.push_back(DEF_CHANNEL);
+                    _write_back(cmp, row, *stage[r.rec]);
+                }
+            }
+        }
+        cmp.row0.push_back(cmp.sat.size());
+
+        col.epo.swap(cmp.epo);
+        col.row0.swap(cmp.row0);
+        col.sat.swap(cmp.sat);
+        col.chn.swap(cmp.chn);
+        col.slot.swap(cmp.slot);
+        col.val.swap(cmp.val);
+        col.lli.swap(cmp.lli);
+        col.flag.swap(cmp.flag);
+        col.slip.swap(cmp.slip);
+        col.outlier.swap(cmp.outlier);
+        vector<t_spt_gobs>().swap(col.stage);
+
+        GREAT_DEBUG("Columnar obs store: " + site + " epochs: " + int2str(col.epo.size()) + " rows: " + int2str(col.sat.size()) +
+                   " slots: " + int2str(col.slot.size()) + " size: " + int2str((col.val.size() * (sizeof(double) + 2) + col.sat.size() * 4) / 1024) + " kB");
+    }
+
+    int t_gallobscol::_col_epo(const vector<t_gtime>& epo, const t_gtime& t) const
+    {
+        if (epo.empty())
+        {
+            return -1;
+        }
+
+        auto it1 = lower_bound(epo.begin(), epo.end(), t); // greater || equal
+        auto it0 = it1;                                     // previous value
+
+        if (it0 != epo.begin())
+        {
+            it0--;
+        }
+        if (it1 == epo.end())
+        {
+            it1 = it0;
+        }
+
+        if (fabs(*it1 - t) <= DIFF_SEC(_smp))
+        {
+            return it1 - epo.begin();
+        }
+        else if (fabs(*it0 - t) <= DIFF_SEC(_smp))
+        {
+            return it0 - epo.begin();
+        }
+
+        return -1; // not found !
+    }
+
+    unsigned short t_gallobscol::_sat_index(const string& sat)
+    {
+        auto itSAT = _satidx.find(sat);
+        if (itSAT != _satidx.end())
+        {
+            return itSAT->second;
+        }
+
+        unsigned short idx = _satnames.size();
+        _satnames.push_back(sat);
+        _satidx[sat] = idx;
+        return idx;
+    }
+
+    void t_gallobscol::_fill(const t_obscol& col, size_t row, t_gobsgnss& obs) const
+    {
+        size_t nslot = col.slot.size();
+        if (col.chn[row] != DEF_CHANNEL)
+        {
+            obs.channel(col.chn[row]);
+        }
+
+        for (size_t s = 0; s < nslot; ++s)
+        {
+            size_t cell = row * nslot + s;
+            unsigned char flag = col.flag[cell];
+            if (!(flag & FLAG_OBS))
+            {
+                continue;
+            }
+
+            obs.addobs(col.slot[s], col.val[cell]);
+            if (col.lli[cell])
+            {
+                obs.addlli(col.slot[s], col.lli[cell]);
+            }
+            if (flag & FLAG_SLIP)
+            {
+                obs.addslip(col.slot[s], col.slip.at(cell));
+            }
+            if (flag & FLAG_OUTLIER)
+            {
+                obs.addoutliers(col.slot[s], col.outlier.at(cell));
+            }
+        }
+    }
+
+    void t_gallobscol::_write_back(t_obscol& col, size_t row, const t_gobsgnss& obs)
+    {
+        size_t nslot = col.slot.size();
+        for (size_t s = 0; s < nslot; ++s)
+        {
+            size_t cell = row * nslot + s;
+            if (col.flag[cell] & FLAG_SLIP)
+            {
+                col.slip.erase(cell);
+            }
+            if (col.flag[cell] & FLAG_OUTLIER)
+            {
+                col.outlier.erase(cell);
+            }
+            col.flag[cell] = 0;
+            col.lli[cell] = 0;
+        }
+
+        col.chn[row] = obs.channel();
+        const map<GOBS, int>& slips = obs.slip();
+        for (const GOBS& gobs : obs.obs())
+        {
+            auto itSLOT = std::find(col.slot.begin(), col.slot.end(), gobs);
+            if (itSLOT == col.slot.end())
+            {
+                continue; // types added after loading are not stored
+            }
+
+            size_t cell = row * nslot + (itSLOT - col.slot.begin());
+            col.val[cell] = obs.getobs(gobs);
+            col.lli[cell] = obs.getlli(gobs);
+            col.flag[cell] = FLAG_OBS;
+
+            auto itSLIP = slips.find(gobs);
+            if (itSLIP != slips.end())
+            {
+                col.slip[cell] = itSLIP->second;
+                col.flag[cell] |= FLAG_SLIP;
+            }
+            int outlier = obs.getoutliers(gobs);
+            if (outlier != 0)
+            {
+                col.outlier[cell] = outlier;
+                col.flag[cell] |= FLAG_OUTLIER;
+            }
+        }
+    }
+
+    void t_gallobscol::_release_live(t_obscol& col)
+    {
+        if (col.live_epo >= 0)
+        {
+            unsigned int row = col.row0[col.live_epo];
+            for (size_t i = 0; i < col.live.size(); ++i)
+            {
+                _write_back(col, row + i, *col.live[i]);
+            }
+        }
+        col.live_epo = -1;
+        col.live.clear();
+    }
+
+    vector<t_spt_gobs> t_gallobscol::_epoch_pt(const string& site, t_obscol& col, int iepo)
+    {
+        if (iepo == col.live_epo)
+        {
+            return col.live;
+        }
+
+        vector<t_spt_gobs> all_obs;
+        all_obs.reserve(col.row0[iepo + 1] - col.row0[iepo]);
+        for (unsigned int row = col.row0[iepo]; row < col.row0[iepo + 1]; ++row)
+        {
+            t_spt_gobs obs = make_shared<t_gobsgnss>(site, _satnames[col.sat[row]], col.epo[iepo]);
+            _fill(col, row, *obs);
+            all_obs.push_back(obs);
+        }
+        return all_obs;
+    }
+
+} // namespace gnut
@@ -0,0 +1,158 @@
+/**
+ * @file         gallobscol.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Columnar (structure-of-arrays) container for all observations
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GALLOBSCOL_H
+#define GALLOBSCOL_H
+
+#include "gall/gallobs.h"
+#include "gutils/gmutex.h"
+
+using namespace std;
+
+namespace gnut
+{
+    /**
+     *@brief Columnar observation store derive from t_gallobs
+     *
+     * Decoded records are staged per site and compacted on the first read into
+     * contiguous per-site arrays: sorted epochs, one row per epoch/satellite with
+     * a dense satellite index, and a fixed set of GOBS slots per site holding
+     * values, LLI and flags. The t_gallobs interface is kept, so processing code
+     * reads it through obs()/obs_pt()/epochs() unchanged.
+     *
+     * obs_pt() returns objects which may be modified by the caller (preprocessing
+     * adds slips/LLI). The last epoch returned by obs_pt() is kept per site, used
+     * by following obs() calls and written back to the arrays when another epoch
+     * is requested.
+     */
+    class LibGnut_LIBRARY_EXPORT t_gallobscol : public t_gallobs
+    {
+    public:
+        /** @brief default constructor. */
+        t_gallobscol();
+
+        /** @brief constructor with settings. */
+        explicit t_gallobscol(t_gsetbase* set);
+
+        /** @brief default destructor. */
+        virtual ~t_gallobscol();
+
+        /** @brief get all stations. */
+        set<string> stations() override;
+
+        /** @brief if store contains the site. */
+        bool isSite(const string& site) override;
+
+        /** @brief get all satellites for epoch t and system. */
+        set<string> sats(const string& site, const t_gtime& t, GSYS gnss) override;
+
+        /** @brief get all t_gsatdata for epoch t. */
+        vector<t_gsatdata> obs(const string& site, const t_gtime& t) override;
+
+        /** @brief fill caller-owned epoch buffer with t_gsatdata for epoch t. */
+        int obs(const string& site, const t_gtime& t, vector<t_gsatdata>& data) override;
+
+        /** @brief get all t_gobsgnss pointers for epoch t. */
+        vector<t_spt_gobs> obs_pt(const string& site, const t_gtime& t) override;
+
+        /** @brief get all epochs for site. */
+        vector<t_gtime> epochs(const string& site) override;
+
+        /** @brief get first epoch for site. */
+        t_gtime beg_obs(const string& site, double smpl = 0.0) override;
+
+        /** @brief get last epoch for site. */
+        t_gtime end_obs(const string& site) override;
+
+        /** @brief add single station observation (staged until the next read of the site). */
+        int addobs(t_spt_gobs obs) override;
+
+        /** @brief number of epochs for station. */
+        unsigned int nepochs(const string& site) override;
+
+        /** @brief find t_gobsgnss elements for site/epoch. */
+        t_map_osat find(const string& site, const t_gtime& t) override;
+
+        /** @brief get number of occurance of individual signals. */
+        t_map_frq frqobs(const string& site) override;
+
+        /** @brief remove epochs of the site outside the interval. */
+        void clean_outer(const string& site, const t_gtime& beg = FIRST_TIME, const t_gtime& end = LAST_TIME) override;
+
+        /**
+         * @brief memory used by the arrays of the site
+         *
+         * @param site
+         * @return size_t [bytes]
+         */
+        size_t memory(const string& site);
+
+    protected:
+        /** @brief per-site columns */
+        struct t_obscol
+        {
+            vector<t_spt_gobs> stage;     ///< decoded records, not yet compacted
+            vector<t_gtime> epo;          ///< sorted epochs
+            vector<unsigned int> row0;    ///< first row of each epoch (size epo + 1)
+            vector<unsigned short> sat;   ///< dense satellite index of each row
+            vector<short> chn;            ///< channel of each row
+            vector<GOBS> slot;            ///< GOBS of each slot
+            vector<double> val;           ///< values [row * nslot + slot]
+            vector<unsigned char> lli;    ///< lost-of-lock [row * nslot + slot]
+            vector<unsigned char> flag;   ///< OBS_FLAG bits [row * nslot + slot]
+            map<size_t, int> slip;        ///< sparse estimated slips [cell]
+            map<size_t, int> outlier;     ///< sparse outliers [cell]
+            int live_epo = -1;            ///< epoch index of the objects given by obs_pt
+            vector<t_spt_gobs> live;      ///< objects given by obs_pt (one per row)
+            t_gmutex mtx;                 ///< guards live objects and write-back
+        };
+
+        /** @brief flags of a cell */
+        enum OBS_FLAG
+        {
+            FLAG_OBS = 1,
+            FLAG_SLIP = 2,
+            FLAG_OUTLIER = 4
+        };
+
+        /** @brief get site columns (compacted), caller holds shared lock on return */
+        t_obscol* _site_col(const string& site);
+
+        /** @brief merge staged records into the site arrays */
+        void _compact(const string& site, t_obscol& col);
+
+        /** @brief index of epoch within DIFF_SEC, -1 if not found */
+        int _col_epo(const vector<t_gtime>& epo, const t_gtime& t) const;
+
+        /** @brief dense index of satellite (added if missing) */
+        unsigned short _sat_index(const string& sat);
+
+        /** @brief fill observation object from row */
+        void _fill(const t_obscol& col, size_t row, t_gobsgnss& obs) const;
+
+        /** @brief write object modified by the caller back to row */
+        void _write_back(t_obscol& col, size_t row, const t_gobsgnss& obs);
+
+        /** @brief write back and release live objects */
+        void _release_live(t_obscol& col);
+
+        /** @brief objects of epoch (live objects if available) */
+        vector<t_spt_gobs> _epoch_pt(const string& site, t_obscol& col, int iepo);
+
+    protected:
+        map<string, t_obscol> _cols;                ///< columns of all sites
+        vector<string> _satnames;                   ///< dense satellite index -> name
+        map<string, unsigned short> _satidx;        ///< satellite name -> dense index
+    };
+
+} // namespace gnut
+
+#endif
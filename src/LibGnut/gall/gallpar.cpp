@@ -21,25 +21,15 @@ namespace gnut
     {
         this->_vParam.push_back(newPar);
         this->_point_par.push_back(_max_point++);
-        this->_index_par[newPar.get_head()][newPar.get_timearc()] = this->_point_par[this->_point_par.size() - 1];
+        this->_key_par.push_back(_key(newPar));
+        this->_index_par[_key_par.back()][newPar.get_timearc()] = static_cast<int>(_vParam.size() - 1);
     }
 
     void t_gallpar::delParam(const int& i)
     {
-        auto& all = this->_index_par.at(_vParam[i].get_head());
-        for (auto iter = all.begin(); iter != all.end(); ++iter)
-        {
-            if (iter->second == _point_par[i])
-            {
-                all.erase(iter);
-                break;
-            }
-        }
-        if (this->_index_par[_vParam[i].get_head()].size() == 0)
-        {
-            this->_index_par.erase(_vParam[i].get_head());
-        }
+        _unindex(i);
         _point_par.erase(_point_par.begin() + i);
+        _key_par.erase(_key_par.begin() + i);
 
         _vParam.erase(_vParam.begin() + i);
     }
@@ -50,30 +40,94 @@ namespace gnut
                             const t_gtime& beg,
                             const t_gtime& end) const
     {
-        if (this->_index_par.count(t_gparhead(type, mark, prn)) == 0)
+        return getParam(type, nameId(mark), nameId(prn), beg, end);
+    }
+
+    int t_gallpar::getParam(const par_type& type,
+                            const int& site_id,
+                            const int& sat_id,
+                            const t_gtime& beg,
+                            const t_gtime& end) const
+    {
+        if (site_id < 0 || sat_id < 0)
         {
             return -1;
         }
-        else
+        auto itKEY = this->_index_par.find(_key(type, site_id, sat_id));
+        if (itKEY == this->_index_par.end())
+        {
+            return -1;
+        }
+
+        // positions are kept up to date by _unindex, no search over the parameters
+        const auto& all = itKEY->second;
+        t_gtimearc dst_timearc(beg, end);
+        for (auto iter = all.begin(); iter != all.end(); ++iter)
+        {
+            if (iter->first.inside(dst_timearc))
+            {
+                return iter->second;
+            }
+        }
+        return -1;
+    }
+
+    int t_gallpar::nameId(const string& name) const
+    {
+        auto itNAME = _name_id.find(name);
+        return (itNAME == _name_id.end()) ? -1 : itNAME->second;
+    }
+
+    t_gallpar::t_gparkey t_gallpar::_key(const t_gpar& par)
+    {
+        // ids are never reused, the names of removed parameters stay interned
+        int site_id = _name_id.insert(make_pair(par.site, static_cast<int>(_name_id.size()))).first->second;
+        int sat_id = _name_id.insert(make_pair(par.prn, static_cast<int>(_name_id.size()))).first->second;
+        return _key(par.parType, site_id, sat_id);
+    }
+
+    void t_gallpar::_unindex(const int& i)
+    {
+        auto itKEY = this->_index_par.find(_key_par[i]);
+        if (itKEY == this->_index_par.end())
+        {
+            return;
+        }
+        auto& all = itKEY->second;
+        for (auto iter = all.begin(); iter != all.end(); ++iter)
         {
-            const auto& all = this->_index_par.find(t_gparhead(type, mark, prn))->second;
-            t_gtimearc dst_timearc(beg, end);
+            if (iter->second == i)
+            {
+                all.erase(iter);
+                break;
+            }
+        }
+        if (all.size() == 0)
+        {
+            this->_index_par.erase(itKEY);
+        }
 
-            auto all_end = all.end();
-            auto par_beg = _point_par.begin();
-            auto par_end = _point_par.end();
-            for (auto iter = all.begin(); iter != all_end; ++iter)
+        // the following parameters move one position forward
+        for (auto& head : this->_index_par)
+        {
+            for (auto& arc : head.second)
             {
-                if (iter->first.inside(dst_timearc))
+                if (arc.second > i)
                 {
-                    auto ans = lower_bound(par_beg, par_end, iter->second);
-                    assert(ans != par_end && *ans == iter->second);
-                    return ans - par_beg;
+                    --arc.second;
                 }
             }
-            return -1;
         }
-        return -1;
+    }
+
+    void t_gallpar::_reindex_heads()
+    {
+        this->_index_par.clear();
+        for (unsigned int i = 0; i < _vParam.size(); i++)
+        {
+            _key_par[i] = _key(_vParam[i]);
+            this->_index_par[_key_par[i]][_vParam[i].get_timearc()] = static_cast<int>(i);
+        }
     }
 
     int t_gallpar::getParam(const int& index)
@@ -318,6 +372,7 @@ namespace gnut
     {
         _vParam.clear();
         this->_index_par.clear();
+        this->_key_par.clear();
         this->_point_par.clear();
         this->_max_point = 0;
         this->_last_point = make_pair(0, 0);
@@ -338,20 +393,9 @@ namespace gnut
                 ind.push_back(iter->index);
                 int i = iter - _vParam.begin();
 
-                auto& all = this->_index_par[_vParam[i].get_head()];
-                for (auto iter = all.begin(); iter != all.end(); ++iter)
-                {
-                    if (iter->second == _point_par[i])
-                    {
-                        all.erase(iter);
-                        break;
-                    }
-                }
-                if (this->_index_par[_vParam[i].get_head()].size() == 0)
-                {
-                    this->_index_par.erase(_vParam[i].get_head());
-                }
+                _unindex(i);
                 _point_par.erase(_point_par.begin() + i);
+                _key_par.erase(_key_par.begin() + i);
 
                 iter = _vParam.erase(iter);
             }
@@ -370,6 +414,7 @@ namespace gnut
         {
             iter->site = site;
         }
+        _reindex_heads();
     }
 
     set<string> t_gallpar::amb_prns()
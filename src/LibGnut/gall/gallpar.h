@@ -67,6 +67,20 @@ namespace gnut
                      const t_gtime& beg = FIRST_TIME,
                      const t_gtime& end = LAST_TIME) const;
 
+        /**
+         *@brief get parameter by the interned site/satellite ids (see nameId)
+         */
+        int getParam(const par_type& type,
+                     const int& site_id,
+                     const int& sat_id,
+                     const t_gtime& beg = FIRST_TIME,
+                     const t_gtime& end = LAST_TIME) const;
+
+        /**
+         *@brief interned id of a site/satellite name (-1 if never used by a parameter)
+         */
+        int nameId(const string& name) const;
+
         /**
          * @brief Get the Param object
          *
@@ -200,9 +214,29 @@ namespace gnut
         map<string, int> freq_sats_num(const int& freq);
 
     private:
+        /** @brief key of the parameter head: type, site id and satellite id */
+        typedef unsigned long long t_gparkey;
+
+        /** @brief key of the parameter head (names interned if new) */
+        t_gparkey _key(const t_gpar& par);
+
+        /** @brief key of the parameter head from the interned ids */
+        static t_gparkey _key(const par_type& type, const int& site_id, const int& sat_id)
+        {
+            return (static_cast<t_gparkey>(type) << 48) | (static_cast<t_gparkey>(site_id) << 24) | static_cast<t_gparkey>(sat_id);
+        }
+
+        /** @brief remove the index of the i-th parameter (the parameter is erased by the caller) */
+        void _unindex(const int& i);
+
+        /** @brief rebuild the index from the parameters */
+        void _reindex_heads();
+
         vector<t_gpar> _vParam;
-        map<string, vector<t_gpar>> _vOrbParam;            ///< add for orb param
-        map<t_gparhead, map<t_gtimearc, long>> _index_par; /// index -> point
+        map<string, vector<t_gpar>> _vOrbParam;                      ///< add for orb param
+        unordered_map<string, int> _name_id;                         ///< site/satellite name -> interned id
+        unordered_map<t_gparkey, map<t_gtimearc, int>> _index_par;   ///< head key -> time arc -> position in _vParam
+        vector<t_gparkey> _key_par;                                  ///< vParam -> head key
         long _max_point = 0;
         vector<long> _point_par;                                   /// point -> vParam
         map<pair<string, string>, vector<int>> _index_for_parital; /// index -> param
@@ -22,10 +22,10 @@ namespace gnut
 
     t_gallprec::t_gallprec() :
         t_gallnav(),
+        _index(nullptr),
         _degree_sp3(9),
         _sec(3600.0 * 6),
         _ref(t_gtime::GPS),
-        _clkref(t_gtime::GPS),
         _clkrnx(true),
         _clksp3(false),
         _clknav(false),
@@ -55,42 +55,61 @@ namespace gnut
 
     int t_gallprec::pos(const string& sat, const t_gtime& t, double xyz[3], double var[3], double vel[3], const bool& chk_mask)
     {
-        _gmutex.lock();
+        // the index is never modified once built, it is read without any lock
+        shared_ptr<const t_gprecindex> index = _get_index();
 
-        shared_ptr<t_geph> tmp;
-        tmp = t_gallprec::_find(sat, t);
-        if (tmp == _null)
+        if (var)
         {
-            for (int i = 0; i < 3; i++)
-            {
-                xyz[i] = 0.0;
-                if (var)
-                {
-                    var[i] = 0.0;
-                }
-                if (vel)
-                {
-                    vel[i] = 0.0;
-                }
-            }
-            _gmutex.unlock();
-            if (_posnav && t_gallnav::pos(sat, t, xyz, var, vel, chk_mask) >= 0)
+            var[0] = var[1] = var[2] = 0.0;
+        }
+        if (index->pos(sat, t, xyz, vel) > 0)
+        {
+            return 1;
+        }
+
+        for (int i = 0; i < 3; i++)
+        {
+            xyz[i] = 0.0;
+            if (vel)
             {
-                return 1;
+                vel[i] = 0.0;
             }
-            return -1;
         }
-
-        int irc = tmp->pos(t, xyz, var, vel, _chkHealth && chk_mask);
-        _gmutex.unlock();
-        return irc;
+        if (_posnav && t_gallnav::pos(sat, t, xyz, var, vel, chk_mask) >= 0)
+        {
+            return 1;
+        }
+        return -1;
     }
 
     int t_gallprec::clk(const string& sat, const t_gtime& t, double* clk, double* var, double* dclk, const bool& chk_mask)
     {
-        _gmutex.lock();
+        shared_ptr<const t_gprecindex> index = _get_index();
 
-        if (!_clkrnx || _get_clkdata(sat, t) < 0)
+        // indexed clocks (bias only), other cases from the discrete data
+        double tmp_clk = 0.0, tmp_dclk = 0.0;
+        int irc = _clkrnx ? index->clk(sat, t, tmp_clk, tmp_dclk) : -1;
+        if (irc > 0)
+        {
+            *clk = tmp_clk;
+            if (var)
+            {
+                *var = 0.0;
+            }
+            if (dclk)
+            {
+                *dclk = tmp_dclk;
+            }
+            return 1;
+        }
+
+        _grwmutex.lock_shared();
+
+        // interpolation data are local, concurrent readers do not share any scratch buffers
+        vector<double> CT, C, IFCB_F3;
+        t_gtime clkref(t_gtime::GPS);
+
+        if (irc < 0 || _get_clkdata(sat, t, CT, C, IFCB_F3, clkref) < 0)
         {
             *clk = 0.0;
             if (var)
@@ -102,7 +121,7 @@ namespace gnut
                 *dclk = 0.0;
             }
 
-            _gmutex.unlock();
+            _grwmutex.unlock_shared();
 
             if (_clksp3 && this->clk_int(sat, t, clk, var, dclk) >= 0)
             {
@@ -115,20 +134,88 @@ namespace gnut
             return -1;
         }
 
+        _grwmutex.unlock_shared();
+
         t_gpoly poly;
-        poly.interpolate(_CT, _C, t.diff(_clkref), *clk, *dclk);
-        *dclk = *dclk / (_CT.back() - _CT.front());
+        poly.interpolate(CT, C, t.diff(clkref), *clk, *dclk);
+        *dclk = *dclk / (CT.back() - CT.front());
 
-        _gmutex.unlock();
         return 1;
     }
 
+    void t_gallprec::pos(const vector<string>& sats,
+                         const vector<t_gtime>& t,
+                         vector<double>& xyz,
+                         vector<double>& vel,
+                         vector<int>& irc,
+                         const bool& chk_mask)
+    {
+        shared_ptr<const t_gprecindex> index = _get_index();
+
+        int n = min(sats.size(), t.size());
+        xyz.assign(3 * sats.size(), 0.0);
+        vel.assign(3 * sats.size(), 0.0);
+        irc.assign(sats.size(), -1);
+
+        vector<int> id(n);
+        for (int i = 0; i < n; i++)
+        {
+            id[i] = index->orb_id(sats[i]);
+        }
+        index->pos(n, id.data(), t.data(), xyz.data(), vel.data(), irc.data());
+
+        // satellites or times not indexed as in pos()
+        for (int i = 0; i < n; i++)
+        {
+            if (irc[i] <= 0)
+            {
+                irc[i] = this->pos(sats[i], t[i], &xyz[3 * i], NULL, &vel[3 * i], chk_mask);
+            }
+        }
+    }
+
+    void t_gallprec::clk(const vector<string>& sats,
+                         const vector<t_gtime>& t,
+                         vector<double>& clk,
+                         vector<double>& dclk,
+                         vector<int>& irc,
+                         const bool& chk_mask)
+    {
+        shared_ptr<const t_gprecindex> index = _get_index();
+
+        int n = min(sats.size(), t.size());
+        clk.assign(sats.size(), 0.0);
+        dclk.assign(sats.size(), 0.0);
+        irc.assign(sats.size(), -1);
+
+        if (_clkrnx)
+        {
+            vector<int> id(n);
+            for (int i = 0; i < n; i++)
+            {
+                id[i] = index->clk_id(sats[i]);
+            }
+            index->clk(n, id.data(), t.data(), clk.data(), dclk.data(), irc.data());
+        }
+
+        // discrete data and the other sources as in clk()
+        for (int i = 0; i < n; i++)
+        {
+            if (irc[i] <= 0)
+            {
+                irc[i] = this->clk(sats[i], t[i], &clk[i], NULL, &dclk[i], chk_mask);
+            }
+        }
+    }
+
     int t_gallprec::clk_int(const string& sat, const t_gtime& t, double* clk, double* var, double* dclk)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         shared_ptr<t_geph> tmp = t_gallprec::_find(sat, t);
 
+        _grwmutex.unlock_shared();
+
         if (tmp == _null)
         {
             *clk = 0.0;
@@ -140,23 +227,25 @@ namespace gnut
             {
                 *dclk = 0.0;
             }
-            _gmutex.unlock();
             return -1;
         }
         int irc = dynamic_pointer_cast<t_gephprec>(tmp)->clk_int(t, clk, var, dclk);
 
-        _gmutex.unlock();
         return irc;
     }
 
     void t_gallprec::add_interval(const string& sat, int intv)
     {
+        _grwmutex.lock();
         _intvm[sat] = intv;
+        _grwmutex.unlock();
     }
 
     void t_gallprec::add_agency(const string& agency)
     {
+        _grwmutex.lock();
         _agency = agency;
+        _grwmutex.unlock();
     }
 
     int t_gallprec::addpos(const string& sat,
@@ -166,7 +255,8 @@ namespace gnut
                            const t_gtriple& dxyz,
                            const double& dt)
     {
-        _gmutex.lock();
+        _grwmutex.lock();
+        atomic_store(&_index, shared_ptr<const t_gprecindex>());
 
         if (_overwrite || _mapsp3[sat].find(ep) == _mapsp3[sat].end())
         {
@@ -182,16 +272,16 @@ namespace gnut
         }
         else
         {
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return -1;
         }
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return 0;
     }
 
     int t_gallprec::addvel(const string& sat, const t_gtime& ep, double xyzt[4], double dxyz[4])
     {
-        _gmutex.lock();
+        _grwmutex.lock();
 
         if (_overwrite || _mapsp3[sat].find(ep) == _mapsp3[sat].end())
         {
@@ -207,16 +297,17 @@ namespace gnut
         }
         else
         {
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return -1;
         }
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return 0;
     }
 
     int t_gallprec::addclk(const string& sat, const t_gtime& ep, double clk[3], double dxyz[3])
     {
-        _gmutex.lock();
+        _grwmutex.lock();
+        atomic_store(&_index, shared_ptr<const t_gprecindex>());
 
         if (_overwrite || _mapclk[sat].find(ep) == _mapclk[sat].end())
         {
@@ -241,17 +332,18 @@ namespace gnut
         }
         else
         {
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return 1;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return 0;
     }
 
     int t_gallprec::addclk_tri(const string& sat, const t_gtime& ep, double clk[3], double dxyz[3])
     {
-        _gmutex.lock();
+        _grwmutex.lock();
+        atomic_store(&_index, shared_ptr<const t_gprecindex>());
 
         if (_overwrite || _mapclk[sat].find(ep) == _mapclk[sat].end())
         {
@@ -277,25 +369,26 @@ namespace gnut
         }
         else
         {
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return 1;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return 0;
     }
 
     unsigned int t_gallprec::nepochs(const string& prn)
     {
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         unsigned int tmp = 0;
-        if (_mapsp3.find(prn) != _mapsp3.end())
+        auto itPRN = _mapsp3.find(prn);
+        if (itPRN != _mapsp3.end())
         {
-            tmp = _mapsp3[prn].size();
+            tmp = itPRN->second.size();
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return tmp;
     }
 
@@ -303,7 +396,7 @@ namespace gnut
     {
         set<string> all_sat = t_gallnav::satellites();
 
-        _gmutex.lock();
+        _grwmutex.lock_shared();
 
         t_map_prn::const_iterator itSP3 = _mapsp3.begin();
         while (itSP3 != _mapsp3.end())
@@ -312,7 +405,7 @@ namespace gnut
             ++itSP3;
         }
 
-        _gmutex.unlock();
+        _grwmutex.unlock_shared();
         return all_sat;
     }
 
@@ -325,7 +418,7 @@ namespace gnut
 
         t_gallnav::clean_outer(beg, end);
 
-        _gmutex.lock();
+        _grwmutex.lock();
 
         map<string, t_map_epo>::const_iterator itPRN = _mapsp3.begin();
         while (itPRN != _mapsp3.end())
@@ -400,7 +493,14 @@ namespace gnut
             }
             itPRN++;
         }
-        _gmutex.unlock();
+
+        // cached polynomials may refer to removed data
+        _cache_rwmutex.lock();
+        _prec.clear();
+        _cache_rwmutex.unlock();
+        atomic_store(&_index, shared_ptr<const t_gprecindex>());
+
+        _grwmutex.unlock();
         return;
     }
 
@@ -423,19 +523,23 @@ namespace gnut
         }
 
         // alternative use of gnav
-        if (_mapsp3[sat].size() == 0)
+        _grwmutex.lock_shared();
+        bool nosp3 = (_mapsp3.find(sat) == _mapsp3.end() || _mapsp3.find(sat)->second.size() == 0);
+        _grwmutex.unlock_shared();
+        if (nosp3)
         {
             return ((_clknav && t_gallnav::nav(sat, t, xyz, var, vel, chk_mask) >= 0) ? 1 : -1);
         }
 
-        _gmutex.lock();
+        // approximative polynomials are cached per satellite (rarely used, exclusive access)
+        _grwmutex.lock();
 
         t_gtime beg(_mapsp3[sat].begin()->first);
         t_gtime end(_mapsp3[sat].rbegin()->first);
 
         if (t < beg - 900 || t > end + 900)
         {
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return ((_clknav && t_gallnav::nav(sat, t, xyz, var, vel) >= 0) ? 1 : -1);
         }
 
@@ -457,15 +561,12 @@ namespace gnut
             _poly_x[sat].evaluate(t.diff(_ref) / _sec, 0, xyz[0]);
             _poly_y[sat].evaluate(t.diff(_ref) / _sec, 0, xyz[1]);
             _poly_z[sat].evaluate(t.diff(_ref) / _sec, 0, xyz[2]);
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return 1;
         }
 
         // prepare approximative estimates
-        _PT.clear();
-        _X.clear();
-        _Y.clear();
-        _Z.clear();
+        vector<double> PT, X, Y, Z;
 
         map<t_gtime, t_map_dat>::iterator itBeg = _mapsp3[sat].begin();
         map<t_gtime, t_map_dat>::iterator itEnd = _mapsp3[sat].end();
@@ -474,7 +575,7 @@ namespace gnut
         int dst = distance(itBeg, itEnd); // tab values [#]
         if (dst < fitdeg)
         {
-            _gmutex.unlock();
+            _grwmutex.unlock();
             return ((_clknav && t_gallnav::nav(sat, t, xyz, var, vel, chk_mask) >= 0) ? 1 : -1);
         }
         if (dst < fitdat)
@@ -520,106 +621,104 @@ namespace gnut
         _sec = _poly_end[sat] - _poly_beg[sat];
         _ref = _poly_beg[sat] + _sec / 2;
 
-        while (_PT.size() < static_cast<unsigned int>(fitdat))
+        while (PT.size() < static_cast<unsigned int>(fitdat))
         {
             ++itReq;
             t_gtime tt = itReq->first;
-            _PT.push_back(tt.diff(_ref) / _sec);
-            _X.push_back(_mapsp3[sat][tt]["X"]);
-            _Y.push_back(_mapsp3[sat][tt]["Y"]);
-            _Z.push_back(_mapsp3[sat][tt]["Z"]);
+            PT.push_back(tt.diff(_ref) / _sec);
+            X.push_back(_mapsp3[sat][tt]["X"]);
+            Y.push_back(_mapsp3[sat][tt]["Y"]);
+            Z.push_back(_mapsp3[sat][tt]["Z"]);
         }
 
-        _poly_x[sat].fitpolynom(_PT, _X, fitdeg, _sec, _ref);
+        _poly_x[sat].fitpolynom(PT, X, fitdeg, _sec, _ref);
         _poly_x[sat].evaluate(t.diff(_ref) / _sec, 0, xyz[0]);
-        _poly_y[sat].fitpolynom(_PT, _Y, fitdeg, _sec, _ref);
+        _poly_y[sat].fitpolynom(PT, Y, fitdeg, _sec, _ref);
         _poly_y[sat].evaluate(t.diff(_ref) / _sec, 0, xyz[1]);
-        _poly_z[sat].fitpolynom(_PT, _Z, fitdeg, _sec, _ref);
+        _poly_z[sat].fitpolynom(PT, Z, fitdeg, _sec, _ref);
         _poly_z[sat].evaluate(t.diff(_ref) / _sec, 0, xyz[2]);
 
-        _gmutex.unlock();
+        _grwmutex.unlock();
         return 1;
     }
 
     shared_ptr<t_geph> t_gallprec::_find(const string& sat, const t_gtime& t)
     {
-        if (_mapsp3.find(sat) == _mapsp3.end())
+        auto itSP3 = _mapsp3.find(sat);
+        if (itSP3 == _mapsp3.end())
         {
             return _null;
         }
-        else if (_mapsp3[sat].size() == 0)
+        else if (itSP3->second.size() == 0)
         {
             return _null;
         }
+
         // if not exists satellite not in cache
-        t_map_sp3::iterator it = _prec.find(sat);
-        if (it == _prec.end())
+        shared_ptr<t_gephprec> prec;
+        _cache_rwmutex.lock_shared();
+        t_map_sp3::const_iterator it = _prec.find(sat);
+        if (it != _prec.end())
         {
-            if (_get_crddata(sat, t) < 0)
-            {
-                return _null;
-            }
+            prec = it->second;
         }
+        _cache_rwmutex.unlock_shared();
 
-        // could not find the data at all --- SHOULDN'T OCCURE, SINCE _get_crddata already return !
-        it = _prec.find(sat);
-        if (it == _prec.end())
+        if (prec == nullptr)
         {
-            return _null;
+            if (_get_crddata(sat, t, prec) < 0)
+            {
+                return _null;
+            }
         }
 
-        double t_minus_ref = t - (it->second)->epoch();
+        double t_minus_ref = t - prec->epoch();
 
         // standard case: cache - satellite found and cache still valid!
-        if (fabs((float)t_minus_ref) < (it->second)->interval() / _degree_sp3 && (it->second)->valid(t))
+        if (fabs((float)t_minus_ref) < prec->interval() / _degree_sp3 && prec->valid(t))
         {
-            return it->second;
+            return prec;
         }
         else
         {
-            t_gtime beg(_mapsp3[sat].begin()->first);
-            t_gtime end(_mapsp3[sat].rbegin()->first);
+            t_gtime beg(itSP3->second.begin()->first);
+            t_gtime end(itSP3->second.rbegin()->first);
 
             // update cache only if not close to the prec data boundaries
-            if ((fabs(t.diff(beg)) > (it->second)->interval() / 2 && fabs(t.diff(end)) > (it->second)->interval() / 2) ||
-                !(it->second)->valid(t))
+            if ((fabs(t.diff(beg)) > prec->interval() / 2 && fabs(t.diff(end)) > prec->interval() / 2) || !prec->valid(t))
             {
-                if (_get_crddata(sat, t) < 0)
+                if (_get_crddata(sat, t, prec) < 0)
                 {
                     return _null;
                 }
-                it = _prec.find(sat);
             }
         }
 
-        return it->second;
+        return prec;
     }
 
-    int t_gallprec::_get_crddata(const string& sat, const t_gtime& t)
+    int t_gallprec::_get_crddata(const string& sat, const t_gtime& t, shared_ptr<t_gephprec>& prec)
     {
-        _T.clear();
-        _PT.clear();
-        _X.clear();
-        _Y.clear();
-        _Z.clear();
-        _CT.clear();
-        _C.clear();
+        vector<t_gtime> T;
+        vector<double> X, Y, Z, C;
 
-        if (_mapsp3.find(sat) == _mapsp3.end())
+        auto itSP3 = _mapsp3.find(sat);
+        if (itSP3 == _mapsp3.end())
         {
             return -1;
         }
+        t_map_epo& epo = itSP3->second;
 
-        map<t_gtime, t_map_dat>::iterator itReq = _mapsp3[sat].lower_bound(t); // 1st equal|greater [than t]
+        map<t_gtime, t_map_dat>::iterator itReq = epo.lower_bound(t); // 1st equal|greater [than t]
 
-        if (itReq == _mapsp3[sat].end())
+        if (itReq == epo.end())
         {
             return -1;
         }
 
-        map<t_gtime, t_map_dat>::iterator itReq_tmp = --(_mapsp3[sat].lower_bound(t));
+        map<t_gtime, t_map_dat>::iterator itReq_tmp = --(epo.lower_bound(t));
 
-        if (itReq_tmp != std::end(_mapsp3[sat]))
+        if (itReq_tmp != std::end(epo))
         {
             if (abs(t.diff(itReq_tmp->first)) < abs(t.diff(itReq->first)))
             {
@@ -627,10 +726,10 @@ namespace gnut
             }
         }
 
-        _ref = itReq->first; // get the nearest epoch after t as reference
+        t_gtime ref = itReq->first; // get the nearest epoch after t as reference
 
-        map<t_gtime, t_map_dat>::iterator itBeg = _mapsp3[sat].begin();
-        map<t_gtime, t_map_dat>::iterator itEnd = _mapsp3[sat].end();
+        map<t_gtime, t_map_dat>::iterator itBeg = epo.begin();
+        map<t_gtime, t_map_dat>::iterator itEnd = epo.end();
         map<t_gtime, t_map_dat>::iterator it = itReq;
 
         if (itReq == itEnd)
@@ -674,7 +773,7 @@ namespace gnut
         // vector for polynomial
         for (unsigned int i = 0; i <= _degree_sp3; it++, i++)
         {
-            double tdiff = it->first - _ref;
+            double tdiff = it->first - ref;
 
             // check maximum interval allowed between reference and sta/end epochs
             if (fabs(tdiff) > static_cast<double>(_degree_sp3 * MAXDIFF_EPH))
@@ -682,54 +781,57 @@ namespace gnut
                 continue;
             }
 
-            if (it->second["X"] != UNDEFVAL_POS)
+            const t_map_dat& dat = it->second;
+            if (dat.at("X") != UNDEFVAL_POS)
             {
-                _PT.push_back(tdiff);
-                _T.push_back(it->first);
-                _X.push_back(it->second["X"]);
-                _Y.push_back(it->second["Y"]);
-                _Z.push_back(it->second["Z"]);
-                _CT.push_back(tdiff);
-                _C.push_back(it->second["C"]);
+                T.push_back(it->first);
+                X.push_back(dat.at("X"));
+                Y.push_back(dat.at("Y"));
+                Z.push_back(dat.at("Z"));
+                C.push_back(dat.at("C"));
             }
         }
 
-        if (_X.size() != _degree_sp3 + 1)
+        if (X.size() != _degree_sp3 + 1)
         {
             return -1;
         }
 
-        if (_prec.find(sat) != _prec.end())
-        {
-            _prec[sat]->degree(_degree_sp3);
-            _prec[sat]->add(sat, _T, _X, _Y, _Z, _C);
-        }
-        else
-        {
-            shared_ptr<t_gephprec> tmp(new t_gephprec());
-            tmp->degree(_degree_sp3);
-            tmp->add(sat, _T, _X, _Y, _Z, _C);
-            _prec[sat] = tmp;
-        }
+        // a new polynomial is always created, objects already handed out to other threads stay untouched
+        shared_ptr<t_gephprec> tmp(new t_gephprec());
+        tmp->degree(_degree_sp3);
+        tmp->add(sat, T, X, Y, Z, C);
+
+        _cache_rwmutex.lock();
+        _prec[sat] = tmp;
+        _cache_rwmutex.unlock();
 
+        prec = tmp;
         return 1;
     }
 
-    int t_gallprec::_get_clkdata(const string& sat, const t_gtime& t)
+    int t_gallprec::_get_clkdata(const string& sat,
+                                 const t_gtime& t,
+                                 vector<double>& CT,
+                                 vector<double>& C,
+                                 vector<double>& IFCB_F3,
+                                 t_gtime& clkref)
     {
-        _CT.clear();
-        _C.clear();
-        _IFCB_F3.clear();
+        CT.clear();
+        C.clear();
+        IFCB_F3.clear();
 
-        if (_mapclk.find(sat) == _mapclk.end())
+        auto itSAT = _mapclk.find(sat);
+        if (itSAT == _mapclk.end())
         {
             return -1;
         }
-        map<t_gtime, t_map_dat>::iterator itBeg = _mapclk[sat].begin();
-        map<t_gtime, t_map_dat>::iterator itEnd = _mapclk[sat].end();
-        map<t_gtime, t_map_dat>::iterator itReq = _mapclk[sat].lower_bound(t); // 1st equal|greater [than t]
+        t_map_epo& epo = itSAT->second;
+        map<t_gtime, t_map_dat>::iterator itBeg = epo.begin();
+        map<t_gtime, t_map_dat>::iterator itEnd = epo.end();
+        map<t_gtime, t_map_dat>::iterator itReq = epo.lower_bound(t); // 1st equal|greater [than t]
 
-        if (itReq == _mapclk[sat].end())
+        if (itReq == epo.end())
         {
             return -1; // too old products
         }
@@ -738,7 +840,7 @@ namespace gnut
             return -1; // too new products
         }
 
-        _clkref = itReq->first; // get the nearest epoch after t as reference
+        clkref = itReq->first; // get the nearest epoch after t as reference
 
         map<t_gtime, t_map_dat>::iterator it = itReq;
 
@@ -756,7 +858,7 @@ namespace gnut
         for (int i = 0; i <= limit; i++)
         {
             itleft--;
-            if (itleft == _mapclk[sat].end())
+            if (itleft == epo.end())
             {
                 flag_left = true;
                 break;
@@ -767,14 +869,14 @@ namespace gnut
         for (int i = 0; i < static_cast<int>(degree_clk - limit); i++)
         {
             itright++;
-            if (itright == _mapclk[sat].end())
+            if (itright == epo.end())
             {
                 flag_right = true;
                 break;
             }
         }
 
-        if (_mapclk[sat].size() < static_cast<unsigned int>(degree_clk))
+        if (epo.size() < static_cast<unsigned int>(degree_clk))
         {
             return -1;
         }
@@ -805,25 +907,25 @@ namespace gnut
             {
                 if (it->second.find("IFCB_F3") == it->second.end())
                 {
-                    double tdiff = it->first - t; // seconds !!!!!!!!!!!!!!!!!!!! instead of _clkref should be ReqT = t !!
-                    _CT.push_back(tdiff);
-                    _C.push_back(it->second["C0"] + it->second["C1"] * tdiff + it->second["C2"] * tdiff * tdiff);
+                    double tdiff = it->first - t; // seconds !!!!!!!!!!!!!!!!!!!! instead of clkref should be ReqT = t !!
+                    CT.push_back(tdiff);
+                    C.push_back(it->second["C0"] + it->second["C1"] * tdiff + it->second["C2"] * tdiff * tdiff);
                 }
                 else
                 {
                     it++;
-                    double tdiff = it->first - t; // seconds !!!!!!!!!!!!!!!!!!!! instead of _clkref should be ReqT = t !!
-                    _CT.push_back(tdiff);
-                    _C.push_back(it->second["C0"]);
-                    _IFCB_F3.push_back(it->second["IFCB_F3"]);
+                    double tdiff = it->first - t; // seconds !!!!!!!!!!!!!!!!!!!! instead of clkref should be ReqT = t !!
+                    CT.push_back(tdiff);
+                    C.push_back(it->second["C0"]);
+                    IFCB_F3.push_back(it->second["IFCB_F3"]);
                 }
                 return 1;
             }
             else
             {
-                double tdiff = it->first - t; // seconds !!!!!!!!!!!!!!!!!!!! instead of _clkref should be ReqT = t !!
-                _CT.push_back(tdiff);
-                _C.push_back(it->second["C0"] + it->second["C1"] * tdiff);
+                double tdiff = it->first - t; // seconds !!!!!!!!!!!!!!!!!!!! instead of clkref should be ReqT = t !!
+                CT.push_back(tdiff);
+                C.push_back(it->second["C0"] + it->second["C1"] * tdiff);
                 return 1;
             }
 
@@ -834,7 +936,7 @@ namespace gnut
             // vector for polynomial
             for (unsigned int i = 0; i <= degree_clk; it++, i++)
             {
-                double tdiff = it->first - _clkref;
+                double tdiff = it->first - clkref;
 
                 // check maximum interval allowed between reference and sta/end epochs
                 if (fabs(tdiff) > static_cast<double>(degree_clk * MAXDIFF_CLK))
@@ -844,28 +946,28 @@ namespace gnut
 
                 if (it->second["C0"] != UNDEFVAL_CLK)
                 {
-                    _CT.push_back(tdiff);
-                    _C.push_back(it->second["C0"]);
+                    CT.push_back(tdiff);
+                    C.push_back(it->second["C0"]);
                 }
             }
 
-            if (_C.size() != degree_clk + 1)
+            if (C.size() != degree_clk + 1)
             {
                 if (itReq != itBeg)
                 {
-                    _C.clear();
-                    _CT.clear();
+                    C.clear();
+                    CT.clear();
                     auto itFirst = itReq;
                     itFirst--;
-                    _C.push_back(itFirst->second["C0"]);
-                    if (fabs(itFirst->first - _clkref) > static_cast<double>(degree_clk * MAXDIFF_CLK))
+                    C.push_back(itFirst->second["C0"]);
+                    if (fabs(itFirst->first - clkref) > static_cast<double>(degree_clk * MAXDIFF_CLK))
                     {
                         return -1;
                     }
-                    _CT.push_back(itFirst->first - _clkref);
+                    CT.push_back(itFirst->first - clkref);
 
-                    _C.push_back(itReq->second["C0"]);
-                    _CT.push_back(0.0);
+                    C.push_back(itReq->second["C0"]);
+                    CT.push_back(0.0);
 
                     return 1;
                 }
@@ -877,6 +979,70 @@ namespace gnut
         return 1;
     }
 
+    shared_ptr<const t_gprecindex> t_gallprec::_get_index()
+    {
+        shared_ptr<const t_gprecindex> index = atomic_load(&_index);
+        if (index)
+        {
+            return index;
+        }
+
+        _grwmutex.lock();
+        index = atomic_load(&_index);
+        if (index)
+        {
+            _grwmutex.unlock();
+            return index;
+        }
+
+        shared_ptr<t_gprecindex> tmp = make_shared<t_gprecindex>(_degree_sp3);
+        for (const auto& itSAT : _mapsp3)
+        {
+            vector<t_gtime> T;
+            vector<double> X, Y, Z;
+            for (const auto& itEPO : itSAT.second)
+            {
+                auto itX = itEPO.second.find("X");
+                if (itX == itEPO.second.end())
+                {
+                    continue;
+                }
+                T.push_back(itEPO.first);
+                X.push_back(itX->second);
+                Y.push_back(itEPO.second.at("Y"));
+                Z.push_back(itEPO.second.at("Z"));
+            }
+            tmp->add_orb(itSAT.first, T, X, Y, Z);
+        }
+        for (const auto& itSAT : _mapclk)
+        {
+            // clocks with rates or IFCB are not indexed
+            vector<t_gtime> T;
+            vector<double> C;
+            bool bias = true;
+            for (const auto& itEPO : itSAT.second)
+            {
+                auto itC1 = itEPO.second.find("C1");
+                if ((itC1 != itEPO.second.end() && itC1->second < UNDEFVAL_CLK) || itEPO.second.count("IFCB_F3"))
+                {
+                    bias = false;
+                    break;
+                }
+                T.push_back(itEPO.first);
+                C.push_back(itEPO.second.at("C0"));
+            }
+            if (bias)
+            {
+                tmp->add_clk(itSAT.first, T, C);
+            }
+        }
+
+        atomic_store(&_index, shared_ptr<const t_gprecindex>(tmp));
+
+        _grwmutex.unlock();
+        return tmp;
+    }
+
     int t_gallprec::_get_delta_pos_vel(const string& sat, const t_gtime& t, int iod, t_gtime& tRef, t_map_dat& orbcorr)
     {
         if (_mapsp3.find(sat) == _mapsp3.end() || _mapsp3[sat].size() == 0)
@@ -19,8 +19,10 @@ History
 #ifndef GALLPREC_H
 #define GALLPREC_H
 
+#include <memory>
 #include "gall/gallnav.h"
 #include "gdata/gephprec.h"
+#include "gdata/gprecindex.h"
 #include "gutils/gtriple.h"
 #include "gmodels/gpoly.h"
 
@@ -123,6 +125,40 @@ namespace gnut
         int clk(const string& sat, const t_gtime& t, double* clk, double* var = NULL, double* dclk = NULL, const bool& chk_mask = true)
             override;
 
+        /**
+         * @brief positions and velocities of several satellites from one read of the index
+         *
+         * @param sats
+         * @param t
+         * @param xyz
+         * @param vel
+         * @param irc
+         * @param chk_mask
+         */
+        void pos(const vector<string>& sats,
+                 const vector<t_gtime>& t,
+                 vector<double>& xyz,
+                 vector<double>& vel,
+                 vector<int>& irc,
+                 const bool& chk_mask = true) override;
+
+        /**
+         * @brief clocks of several satellites from one read of the index
+         *
+         * @param sats
+         * @param t
+         * @param clk
+         * @param dclk
+         * @param irc
+         * @param chk_mask
+         */
+        void clk(const vector<string>& sats,
+                 const vector<t_gtime>& t,
+                 vector<double>& clk,
+                 vector<double>& dclk,
+                 vector<int>& irc,
+                 const bool& chk_mask = true) override;
+
         /**
          * @brief clk_int
          *
@@ -261,22 +297,32 @@ namespace gnut
         virtual shared_ptr<t_geph> _find(const string& sat, const t_gtime& t);
 
         /**
-         * @brief fill PT,X,Y,Z vectors
+         * @brief fit a new SP3 polynomial around t and put it into the cache
          *
          * @param sat
          * @param t
+         * @param prec  the new polynomial
          * @return int
          */
-        virtual int _get_crddata(const string& sat, const t_gtime& t);
+        virtual int _get_crddata(const string& sat, const t_gtime& t, shared_ptr<t_gephprec>& prec);
 
         /**
          * @brief fill CT,C vectors
          *
          * @param sat
          * @param t
+         * @param CT      vector of time-difference (X for polynomials)
+         * @param C       vector of clk correction  (Y for polynomials)
+         * @param IFCB_F3 vector of ifcb_f3
+         * @param clkref  selected reference epoch for clk data
          * @return int
          */
-        virtual int _get_clkdata(const string& sat, const t_gtime& t);
+        virtual int _get_clkdata(const string& sat,
+                                 const t_gtime& t,
+                                 vector<double>& CT,
+                                 vector<double>& C,
+                                 vector<double>& IFCB_F3,
+                                 t_gtime& clkref);
 
         /**
          * @brief return the ssr position and velocity correction.
@@ -302,16 +348,24 @@ namespace gnut
          */
         virtual int _get_delta_clk(const string& sat, const t_gtime& t, int iod, t_gtime& tRef, t_map_dat& clkcorr);
 
+        /**
+         * @brief interpolation index of the current data (built when first needed after a change)
+         *
+         * @return shared_ptr<const t_gprecindex> (kept by the caller while reading, superseded indexes are released by the last reader)
+         */
+        shared_ptr<const t_gprecindex> _get_index();
+
         t_map_sat _mapprec; // map of sp3 polynomials
         t_map_prn _mapsp3;  // precise orbits&clocks (SP3) - full discrete data sets
         t_map_prn _mapclk;  // precise clocks (CLOCK-RINEX) - full discrete data sets
 
     private:
         t_map_sp3 _prec;          ///< CACHE: single SP3 precise ephemeris for all satellites
+        t_grwmutex _cache_rwmutex; ///< CACHE: lock for _prec (cached polynomials are replaced, never modified)
+        shared_ptr<const t_gprecindex> _index; ///< INDEX: current interpolation index (nullptr after data changed), only atomic_load/atomic_store
         unsigned int _degree_sp3; ///< polynom degree for satellite sp3 position and clocks
         double _sec;              ///< default polynomial units
-        t_gtime _ref;             ///< selected reference epoch for crd data/polynomials
-        t_gtime _clkref;          ///< selected reference epoch for clk data/polynomials
+        t_gtime _ref;             ///< selected reference epoch for approximative polynomials
         bool _clkrnx;             ///< true: use               clk from Rinex Clocks
         bool _clksp3;             ///< true: use alternatively clk from sp3 (~15min!)
         bool _clknav;             ///< true: use alternatively nav (low-precise clocks)
@@ -327,17 +381,6 @@ namespace gnut
         map<string, t_gpoly> _poly_y;
         map<string, t_gpoly> _poly_z;
 
-        // BEGIN OF TEMPORARY (ALTERNATIVE for direct interpolation)
-        vector<double> _PT; ///< vector of time-difference (X for polynomials)
-        vector<t_gtime> _T; ///< vector of full time       (X for polynomials)
-        vector<double> _X;  ///< vector of x-coordinate    (Y for polynomials)
-        vector<double> _Y;  ///< vector of y-coordinate    (Y for polynomials)
-        vector<double> _Z;  ///< vector of z-coordinate    (Y for polynomials)
-
-        vector<double> _CT;      ///< vector of time-difference (X for polynomials)
-        vector<double> _C;       ///< vector of clk correction  (Y for polynomials)
-        vector<double> _IFCB_F3; ///< vector of ifcb_f3
-
         set<clk_type> _clk_type_list; ///< CLK TYPE
     };
 
@@ -135,7 +135,8 @@ namespace gnut
                     // end of antenna record --> process it
                     if (line.find("END OF ANTENNA", 60) != string::npos)
                     {
-                        // fill pcv
+                        // fill pcv (interpolation tables compiled once the record is complete)
+                        pcv->compile();
                         map<string, t_gdata*>::iterator it = _data.begin();
                         while (it != _data.end())
                         {
@@ -42,7 +42,6 @@
 
 #define BUFFER_INCREASE_FAC 1.5
 #define DEFAULT_BUFFER_SIZE 4096
-#define MAXIMUM_BUFFER_SIZE 240000 // 9000000
 using namespace std;
 using namespace great;
 using namespace spdlog;
@@ -138,6 +137,19 @@ namespace gnut
             return 0;
         } // = 0;
 
+        /**
+         * @brief split a complete file image into blocks decodable independently
+         * @param buff  whole file content
+         * @param sz    size of the content
+         * @param nblk  requested number of blocks
+         * @return offsets of the header end, of each further block and sz;
+         *         empty if the content cannot be split (decode sequentially)
+         */
+        virtual vector<size_t> data_blocks(const char* buff, size_t sz, int nblk)
+        {
+            return vector<size_t>();
+        }
+
         /** @brief get irc. */
         const int& irc() const
         {
@@ -106,6 +106,132 @@ namespace gnut
         _mutex.unlock();
         return _consume;
     }
+    vector<size_t> t_rinexo::data_blocks(const char* buff, size_t sz, int nblk)
+    {
+        vector<size_t> blocks;
+        if (nblk < 2)
+        {
+            return blocks;
+        }
+
+        // end of line from pos (sz if not found)
+        auto eol = [buff, sz](size_t pos) -> size_t {
+            const char* p = static_cast<const char*>(memchr(buff + pos, '\n', sz - pos));
+            return p ? static_cast<size_t>(p - buff) : sz;
+        };
+
+        // header: version, number of RINEX 2 observation types, end of header
+        double ver = 0.0;
+        int nobs = 0;
+        size_t pos = 0, hdr_end = 0;
+        while (pos < sz && hdr_end == 0)
+        {
+            size_t end = eol(pos);
+            if (end - pos > 60)
+            {
+                string label(buff + pos + 60, min<size_t>(end - pos - 60, 20));
+                if (label.find("RINEX VERSION") == 0)
+                {
+                    ver = str2dbl(string(buff + pos, 9));
+                }
+                else if (label.find("# / TYPES OF OBSERV") == 0 && nobs == 0)
+                {
+                    nobs = str2int(string(buff + pos, 6));
+                }
+                else if (label.find("END OF HEADER") == 0)
+                {
+                    hdr_end = end + 1;
+                }
+            }
+            pos = end + 1;
+        }
+        if (hdr_end == 0 || hdr_end >= sz || ver < 2.0 || ver >= 4.0)
+        {
+            return blocks;
+        }
+
+        // offsets of all epoch records
+        vector<size_t> epochs;
+        pos = hdr_end;
+        if (ver >= 3.0)
+        {
+            while (pos < sz)
+            {
+                size_t end = eol(pos);
+                if (buff[pos] == '>')
+                {
+                    // header records (new site occupation, header information) change the
+                    // decoder state for the following epochs, such files are decoded in sequence
+                    char flag = (end - pos > 31) ? buff[pos + 31] : ' ';
+                    if (flag == '3' || flag == '4')
+                    {
+                        return blocks;
+                    }
+                    epochs.push_back(pos);
+                }
+                pos = end + 1;
+            }
+        }
+        else
+        {
+            if (nobs <= 0)
+            {
+                return blocks;
+            }
+            int nline_sat = (nobs + 4) / 5;
+            while (pos < sz)
+            {
+                size_t end = eol(pos);
+                if (end - pos < 32)
+                {
+                    if (end + 1 >= sz)
+                    {
+                        break; // trailing empty line
+                    }
+                    return blocks;
+                }
+                char flag = buff[pos + 28];
+                int nsat = str2int(string(buff + pos + 29, 3));
+                if (flag < '0' || flag > '6' || flag == '3' || flag == '4' || nsat < 0)
+                {
+                    return blocks;
+                }
+                epochs.push_back(pos);
+
+                // satellite list continuation and observation lines, or special records
+                int nskip = nsat;
+                if (flag == '0' || flag == '1' || flag == '6')
+                {
+                    nskip = (nsat > 0 ? (nsat - 1) / 12 : 0) + nsat * nline_sat;
+                }
+                pos = end + 1;
+                for (int i = 0; i < nskip && pos < sz; ++i)
+                {
+                    pos = eol(pos) + 1;
+                }
+            }
+        }
+
+        // blocks of similar size starting at epoch records
+        blocks.push_back(hdr_end);
+        for (int k = 1; k < nblk; ++k)
+        {
+            size_t target = hdr_end + (sz - hdr_end) / nblk * k;
+            auto itEPO = lower_bound(epochs.begin(), epochs.end(), target);
+            if (itEPO != epochs.end() && *itEPO > blocks.back())
+            {
+                blocks.push_back(*itEPO);
+            }
+        }
+        blocks.push_back(sz);
+
+        if (blocks.size() < 3)
+        {
+            blocks.clear();
+        }
+        return blocks;
+    }
+
     int t_rinexo::_decode_head()
     {
         while (_complete && ((_tmpsize = t_gcoder::_getline(_line)) >= 0))
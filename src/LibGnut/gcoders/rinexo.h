@@ -74,6 +74,19 @@ namespace gnut
          */
         virtual int decode_data(char* buff, int sz, int& cnt, vector<string>& errmsg);
 
+        /**
+         * @brief split RINEX 2/3 observation file content at epoch records
+         *
+         * Blocks start at epoch records ('>' in RINEX 3) and keep the records with event
+         * flags 0-2, 5 and 6, files with header records (event flags 3, 4) are not split.
+         *
+         * @param buff  whole file content
+         * @param sz    size of the content
+         * @param nblk  requested number of blocks
+         * @return vector<size_t> header end, block starts, sz (empty if not split)
+         */
+        virtual vector<size_t> data_blocks(const char* buff, size_t sz, int nblk) override;
+
     protected:
         /**
          * @brief decode head
@@ -413,6 +413,7 @@ namespace gnut
 
         if (!this->_valid())
         {
+            _gmutex.unlock();
             return -1;
         }
 
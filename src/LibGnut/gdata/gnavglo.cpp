@@ -181,54 +181,31 @@ namespace gnut
             return -1;
         }
 
-        // init state vector (crd, vel)
-        ColumnVector yy(6);
-
         if (double_eq(_x, 0.0) || double_eq(_y, 0.0) || double_eq(_z, 0.0))
         {
             GREAT_DEBUG("Zero ephemerides:" + t.str_ymdhms(sat() + " "));
             return -1;
         }
 
-        yy << _x << _y << _z << _x_d << _y_d << _z_d;
-        // acceleration
-        t_gtriple acc(_x_dd, _y_dd, _z_dd);
-
-        int nsteps = (int)fabs(floor(Tk / _min_step + 0.5)); // step number for RungeKutta
-        double step = fabs(Tk) / nsteps;                     // step length for RungeKutta, length is cca 10s
-                                                             //  cout << Tk << " " << nsteps << " " << step << endl;
-        if (Tk < 0)
-        {
-            step = -step;
-        }
-        ColumnVector yy_integr(6);
-        yy_integr = _RungeKutta(step, nsteps, yy, acc);
-
-        xyz[0] = yy_integr(1);
-        xyz[1] = yy_integr(2);
-        xyz[2] = yy_integr(3);
+        // state vector (crd, vel)
+        double yy[6];
+        _integrate(Tk, yy);
 
         // PZ_90.11 to ITRF_2008 transformation
-        ColumnVector T(3);
-        T << -0.003 << -0.001 << 0.000;
-        Matrix R(3, 3);
-        R = 0;
-        double mas = (1 / (36e5)) * D2R;
-        R << 1 << 0.002 * mas << 0.042 * mas << -0.002 * mas << 1 << 0.019 * mas << -0.042 * mas << -0.019 * mas << 1;
-        ColumnVector xyzWGS;
-        xyzWGS = T + R * yy_integr.Rows(1, 3);
+        const double mas = (1 / (36e5)) * D2R;
+        const double rx = 0.019 * mas, ry = 0.042 * mas, rz = 0.002 * mas;
 
         // position at time t
-        xyz[0] = xyzWGS(1);
-        xyz[1] = xyzWGS(2);
-        xyz[2] = xyzWGS(3);
+        xyz[0] = -0.003 + yy[0] + rz * yy[1] + ry * yy[2];
+        xyz[1] = -0.001 - rz * yy[0] + yy[1] + rx * yy[2];
+        xyz[2] = 0.000 - ry * yy[0] - rx * yy[1] + yy[2];
 
         // velocity at positon t
         if (vel)
         {
-            vel[0] = yy_integr(4);
-            vel[1] = yy_integr(5);
-            vel[2] = yy_integr(6);
+            vel[0] = yy[3];
+            vel[1] = yy[4];
+            vel[2] = yy[5];
         }
 
         return 0;
@@ -307,6 +284,8 @@ namespace gnut
 
         _E = data[14];
 
+        _arcs.clear();
+
         _gmutex.unlock();
         return 0;
     }
@@ -317,6 +296,7 @@ namespace gnut
 
         if (!this->_valid())
         {
+            _gmutex.unlock();
             return -1;
         }
 
@@ -468,45 +448,86 @@ namespace gnut
         return false;
     }
 
-    ColumnVector t_gnavglo::_deriv(const ColumnVector& xx, const t_gtriple& acc)
+    void t_gnavglo::_deriv(const double xx[6], const double acc[3], double xxdot[6]) const
     {
-        t_gtriple crd(xx.rows(1, 3));
-        t_gtriple vel(xx.rows(4, 6));
-
-        double r = crd.crd_cvect().norm_Frobenius();
-
-        double k1 = -GM_PZ90 / (r * r * r);
-        double k2 = (3.0 / 2.0) * C20_PZ90 * (GM_PZ90 * Aell_PZ90 * Aell_PZ90) / pow(r, 5);
-
-        ColumnVector xxdot(6);
+        const double* crd = xx;
+        const double* vel = xx + 3;
+
+        double r2 = crd[0] * crd[0] + crd[1] * crd[1] + crd[2] * crd[2];
+        double r = sqrt(r2);
+
+        double k1 = -GM_PZ90 / (r2 * r);
+        double k2 = (3.0 / 2.0) * C20_PZ90 * (GM_PZ90 * Aell_PZ90 * Aell_PZ90) / (r2 * r2 * r);
+        double zr = 5.0 * crd[2] * crd[2] / r2;
+
+        xxdot[0] = vel[0];
+        xxdot[1] = vel[1];
+        xxdot[2] = vel[2];
+        xxdot[3] = k1 * crd[0] + k2 * (1.0 - zr) * crd[0] + OMEGA * OMEGA * crd[0] + 2 * OMEGA * vel[1] + acc[0];
+        xxdot[4] = k1 * crd[1] + k2 * (1.0 - zr) * crd[1] + OMEGA * OMEGA * crd[1] - 2 * OMEGA * vel[0] + acc[1];
+        xxdot[5] = k1 * crd[2] + k2 * (3.0 - zr) * crd[2] + acc[2];
+    }
 
-        xxdot(1) = vel[0];
-        xxdot(2) = vel[1];
-        xxdot(3) = vel[2];
-        xxdot(4) =
-            k1 * crd[0] + k2 * (1.0 - 5.0 * crd[2] * crd[2] / (r * r)) * crd[0] + OMEGA * OMEGA * crd[0] + 2 * OMEGA * vel[1] + acc[0];
-        xxdot(5) =
-            k1 * crd[1] + k2 * (1.0 - 5.0 * crd[2] * crd[2] / (r * r)) * crd[1] + OMEGA * OMEGA * crd[1] - 2 * OMEGA * vel[0] + acc[1];
-        xxdot(6) = k1 * crd[2] + k2 * (3.0 - 5.0 * crd[2] * crd[2] / (r * r)) * crd[2] + acc[2];
+    void t_gnavglo::_RungeKutta(double step, int nsteps, double yy[6], const double acc[3]) const
+    {
+        double k1[6], k2[6], k3[6], k4[6], tmp[6];
 
-        return xxdot;
+        for (int i = 1; i <= nsteps; i++)
+        {
+            _deriv(yy, acc, k1);
+            for (int j = 0; j < 6; j++)
+            {
+                tmp[j] = yy[j] + step * k1[j] / 2.0;
+            }
+            _deriv(tmp, acc, k2);
+            for (int j = 0; j < 6; j++)
+            {
+                tmp[j] = yy[j] + step * k2[j] / 2.0;
+            }
+            _deriv(tmp, acc, k3);
+            for (int j = 0; j < 6; j++)
+            {
+                tmp[j] = yy[j] + step * k3[j];
+            }
+            _deriv(tmp, acc, k4);
+            for (int j = 0; j < 6; j++)
+            {
+                yy[j] += step * (k1[j] / 6.0 + k2[j] / 3.0 + k3[j] / 3.0 + k4[j] / 6.0);
+            }
+        }
     }
 
-    ColumnVector t_gnavglo::_RungeKutta(double step, int nsteps, const ColumnVector& yy, const t_gtriple& acc)
+    void t_gnavglo::_integrate(double Tk, double yy[6])
     {
-        ColumnVector yyn = yy;
+        const double acc[3] = {_x_dd, _y_dd, _z_dd};
 
-        for (int i = 1; i <= nsteps; i++)
+        // checkpoints every _min_step from toc, the remainder is a single shorter step
+        t_arc& arc = _arcs[_min_step];
+        vector<array<double, 6>>& pts = (Tk < 0) ? arc.bwd : arc.fwd;
+        if (pts.empty())
         {
-            ColumnVector k1 = step * _deriv(yyn, acc);
-            ColumnVector k2 = step * _deriv(yyn + k1 / 2.0, acc);
-            ColumnVector k3 = step * _deriv(yyn + k2 / 2.0, acc);
-            ColumnVector k4 = step * _deriv(yyn + k3, acc);
+            pts.push_back({{_x, _y, _z, _x_d, _y_d, _z_d}});
+        }
 
-            yyn += k1 / 6.0 + k2 / 3.0 + k3 / 3.0 + k4 / 6.0;
+        double step = (Tk < 0) ? -_min_step : _min_step;
+        int k = static_cast<int>(fabs(Tk) / _min_step);
+        while (static_cast<int>(pts.size()) <= k)
+        {
+            array<double, 6> next = pts.back();
+            _RungeKutta(step, 1, next.data(), acc);
+            pts.push_back(next);
         }
 
-        return yyn;
+        for (int i = 0; i < 6; i++)
+        {
+            yy[i] = pts[k][i];
+        }
+
+        double rest = Tk - k * step;
+        if (rest != 0.0)
+        {
+            _RungeKutta(rest, 1, yy, acc);
+        }
     }
 
     int t_gnavglo::_iod() const
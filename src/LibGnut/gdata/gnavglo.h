@@ -19,6 +19,8 @@
 #ifndef GNAVGLO_H
 #define GNAVGLO_H
 
+#include <array>
+#include <map>
 #include <vector>
 
 #include "newmat/newmat.h"
@@ -171,22 +173,29 @@ namespace gnut
         /**
          * @brief six orbital differential equations
          *
-         * @param xx
-         * @param acc
-         * @return ColumnVector
+         * @param xx      state (crd, vel)
+         * @param acc     lunisolar acceleration
+         * @param xxdot   derivative of the state
          */
-        ColumnVector _deriv(const ColumnVector& xx, const t_gtriple& acc);
+        void _deriv(const double xx[6], const double acc[3], double xxdot[6]) const;
 
         /**
          * @brief Runge-Kutta integration
          *
-         * @param step
-         * @param nsteps
-         * @param yy
-         * @param acc
-         * @return ColumnVector
+         * @param step    step length [s]
+         * @param nsteps  number of steps
+         * @param yy      state (crd, vel), integrated in place
+         * @param acc     lunisolar acceleration
          */
-        ColumnVector _RungeKutta(double step, int nsteps, const ColumnVector& yy, const t_gtriple& acc);
+        void _RungeKutta(double step, int nsteps, double yy[6], const double acc[3]) const;
+
+        /**
+         * @brief state at toc + Tk, continued from the nearest checkpoint of the arc
+         *
+         * @param Tk      time from toc [s]
+         * @param yy      state (crd, vel) at toc + Tk
+         */
+        void _integrate(double Tk, double yy[6]);
 
         double _maxEphAge; ///< max age of ephemerises [s]
 
@@ -234,6 +243,14 @@ namespace gnut
         double _tau;    ///< SV clock bias [s]
         double _tki;    ///< message frame time [0 ... 86400 s]
         int _min_step;  ///< mininal step length for Runge Kutta
+
+        /** @brief states integrated from toc with a fixed step */
+        struct t_arc
+        {
+            vector<array<double, 6>> fwd; ///< states at toc + k * step
+            vector<array<double, 6>> bwd; ///< states at toc - k * step
+        };
+        map<int, t_arc> _arcs; ///< checkpoints by step length (cleared by data2nav)
     };
 
 } // namespace gnut
@@ -431,6 +431,7 @@ namespace gnut
 
         if (!this->_valid())
         {
+            _gmutex.unlock();
             return -1;
         }
 
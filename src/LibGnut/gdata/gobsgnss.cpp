@@ -2138,14 +2138,17 @@ namespace gnut
 
         if (!code.is_code())
         {
+            _gmutex.unlock();
             return NULL_GOBS;
         }
         if (!L1.is_phase())
         {
+            _gmutex.unlock();
             return NULL_GOBS;
         }
         if (!L2.is_phase())
         {
+            _gmutex.unlock();
             return NULL_GOBS;
         }
 
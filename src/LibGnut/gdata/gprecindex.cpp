@@ -0,0 +1,386 @@
+/**
+ * @file         gprecindex.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Read-only interpolation index of precise orbits and clocks
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "gdata/gprecindex.h"
+#include "gdata/gephprec.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_gprecindex::t_gprecindex(unsigned int degree) :
+        _degree(degree)
+    {
+    }
+
+    t_gprecindex::~t_gprecindex()
+    {
+    }
+
+    void t_gprecindex::add_orb(const string& sat, const vector<t_gtime>& t, const vector<double>& x,
+                               const vector<double>& y, const vector<double>& z)
+    {
+        int n = t.size();
+        int npts = _degree + 1;
+        if (n < npts || x.size() != t.size() || y.size() != t.size() || z.size() != t.size())
+        {
+            return;
+        }
+
+        auto itID = _orb_id.find(sat);
+        if (itID == _orb_id.end())
+        {
+            itID = _orb_id.insert(make_pair(sat, static_cast<int>(_orb.size()))).first;
+            _orb.push_back(t_series());
+        }
+        t_series& ser = _orb[itID->second];
+        ser.t0 = t[0];
+        ser.step = t[n - 1].diff(t[0]) / (n - 1);
+        ser.sec.resize(n);
+        ser.val.resize(3 * n);
+        for (int i = 0; i < n; i++)
+        {
+            ser.sec[i] = t[i].diff(t[0]);
+            ser.val[3 * i] = x[i];
+            ser.val[3 * i + 1] = y[i];
+            ser.val[3 * i + 2] = z[i];
+        }
+
+        // weights of all windows
+        ser.wgt.resize(n - npts + 1);
+        for (int b = 0; b + npts <= n; b++)
+        {
+            ser.wgt[b] = _weights(&ser.sec[b]);
+        }
+
+        // window of the nearest node (as t_gallprec::_get_crddata)
+        int limit = static_cast<int>(_degree / 2);
+        ser.beg.assign(n, -1);
+        for (int r = 0; r < n; r++)
+        {
+            int b = r - limit;
+            if (r < limit)
+            {
+                b = 0;
+            }
+            else if (n - r <= static_cast<int>(_degree) - limit)
+            {
+                b = n - npts;
+            }
+
+            bool valid = true;
+            for (int j = b; j < b + npts; j++)
+            {
+                if (fabs(ser.sec[j] - ser.sec[r]) > _degree * MAXDIFF_EPH || x[j] == UNDEFVAL_POS)
+                {
+                    valid = false;
+                    break;
+                }
+            }
+            if (valid)
+            {
+                ser.beg[r] = b;
+            }
+        }
+    }
+
+    void t_gprecindex::add_clk(const string& sat, const vector<t_gtime>& t, const vector<double>& c)
+    {
+        int n = t.size();
+        if (n < 2 || c.size() != t.size())
+        {
+            return;
+        }
+
+        auto itID = _clk_id.find(sat);
+        if (itID == _clk_id.end())
+        {
+            itID = _clk_id.insert(make_pair(sat, static_cast<int>(_clk.size()))).first;
+            _clk.push_back(t_series());
+        }
+        t_series& ser = _clk[itID->second];
+        ser.t0 = t[0];
+        ser.step = t[n - 1].diff(t[0]) / (n - 1);
+        ser.sec.resize(n);
+        ser.val = c;
+        for (int i = 0; i < n; i++)
+        {
+            ser.sec[i] = t[i].diff(t[0]);
+        }
+
+        // segment (k-1,k) for the first node not before t, (0,1) for the first node
+        ser.beg.assign(n, 0);
+        for (int k = 0; k < n; k++)
+        {
+            int i0 = (k == 0) ? 0 : k - 1;
+            if (ser.sec[i0 + 1] - ser.sec[i0] <= MAXDIFF_CLK && c[i0] != UNDEFVAL_CLK && c[i0 + 1] != UNDEFVAL_CLK)
+            {
+                ser.beg[k] = 1;
+            }
+        }
+    }
+
+    int t_gprecindex::pos(const string& sat, const t_gtime& t, double xyz[3], double vel[3]) const
+    {
+        int id = orb_id(sat);
+        if (id < 0)
+        {
+            return -1;
+        }
+        return _pos_ser(_orb[id], t, xyz, vel);
+    }
+
+    int t_gprecindex::clk(const string& sat, const t_gtime& t, double& clk, double& dclk) const
+    {
+        clk = dclk = 0.0;
+
+        int id = clk_id(sat);
+        if (id < 0)
+        {
+            return 0;
+        }
+        return _clk_ser(_clk[id], t, clk, dclk);
+    }
+
+    int t_gprecindex::orb_id(const string& sat) const
+    {
+        auto itID = _orb_id.find(sat);
+        return (itID == _orb_id.end()) ? -1 : itID->second;
+    }
+
+    int t_gprecindex::clk_id(const string& sat) const
+    {
+        auto itID = _clk_id.find(sat);
+        return (itID == _clk_id.end()) ? -1 : itID->second;
+    }
+
+    void t_gprecindex::pos(int n, const int* id, const t_gtime* t, double* xyz, double* vel, int* irc) const
+    {
+        for (int i = 0; i < n; i++)
+        {
+            if (id[i] < 0 || id[i] >= static_cast<int>(_orb.size()))
+            {
+                irc[i] = -1;
+                continue;
+            }
+            irc[i] = _pos_ser(_orb[id[i]], t[i], xyz + 3 * i, vel ? vel + 3 * i : NULL);
+        }
+    }
+
+    void t_gprecindex::clk(int n, const int* id, const t_gtime* t, double* clk, double* dclk, int* irc) const
+    {
+        for (int i = 0; i < n; i++)
+        {
+            clk[i] = dclk[i] = 0.0;
+            if (id[i] < 0 || id[i] >= static_cast<int>(_clk.size()))
+            {
+                irc[i] = 0;
+                continue;
+            }
+            irc[i] = _clk_ser(_clk[id[i]], t[i], clk[i], dclk[i]);
+        }
+    }
+
+    int t_gprecindex::_pos_ser(const t_series& ser, const t_gtime& t, double xyz[3], double vel[3]) const
+    {
+        int n = ser.sec.size();
+
+        double s = t.diff(ser.t0);
+        int r = _lower(ser, s);
+        if (r == n || s < -0.25)
+        {
+            return -1;
+        }
+        if (r > 0 && fabs(s - ser.sec[r - 1]) < fabs(s - ser.sec[r]))
+        {
+            r--;
+        }
+
+        int b = ser.beg[r];
+        if (b < 0)
+        {
+            return -1;
+        }
+
+        const t_weights& ws = _wset[ser.wgt[b]];
+        const double* val = &ser.val[3 * b];
+        int npts = ws.u.size();
+        double u = (s - ser.sec[b]) / ws.h;
+
+        // prefix/suffix products of (u - u_k) and their derivatives, so that the Lagrange basis
+        // l_j = w_j * prod_k!=j (u - u_k) is pre_j * suf_j+1 (no division by u - u_j, linear in npts)
+        const int MAXPTS = 24;
+        double buf[4 * (MAXPTS + 1)];
+        vector<double> heap;
+        double* pre = buf;
+        if (npts > MAXPTS)
+        {
+            heap.resize(4 * (npts + 1));
+            pre = heap.data();
+        }
+        double* dpre = pre + (npts + 1);
+        double* suf = dpre + (npts + 1);
+        double* dsuf = suf + (npts + 1);
+
+        pre[0] = 1.0;
+        dpre[0] = 0.0;
+        for (int j = 0; j < npts; j++)
+        {
+            double d = u - ws.u[j];
+            dpre[j + 1] = dpre[j] * d + pre[j];
+            pre[j + 1] = pre[j] * d;
+        }
+        suf[npts] = 1.0;
+        dsuf[npts] = 0.0;
+        for (int j = npts - 1; j >= 0; j--)
+        {
+            double d = u - ws.u[j];
+            dsuf[j] = dsuf[j + 1] * d + suf[j + 1];
+            suf[j] = suf[j + 1] * d;
+        }
+
+        double x = 0.0, y = 0.0, z = 0.0;
+        double vx = 0.0, vy = 0.0, vz = 0.0;
+        for (int j = 0; j < npts; j++)
+        {
+            double p = ws.w[j] * pre[j] * suf[j + 1];
+            double dp = ws.w[j] * (dpre[j] * suf[j + 1] + pre[j] * dsuf[j + 1]);
+            x += p * val[3 * j];
+            y += p * val[3 * j + 1];
+            z += p * val[3 * j + 2];
+            vx += dp * val[3 * j];
+            vy += dp * val[3 * j + 1];
+            vz += dp * val[3 * j + 2];
+        }
+
+        xyz[0] = x;
+        xyz[1] = y;
+        xyz[2] = z;
+        if (vel)
+        {
+            vel[0] = vx / ws.h;
+            vel[1] = vy / ws.h;
+            vel[2] = vz / ws.h;
+        }
+        return 1;
+    }
+
+    int t_gprecindex::_clk_ser(const t_series& ser, const t_gtime& t, double& clk, double& dclk) const
+    {
+        clk = dclk = 0.0;
+
+        int n = ser.sec.size();
+
+        double s = t.diff(ser.t0);
+        int k = _lower(ser, s);
+        if (k == n || s < 0.0)
+        {
+            return -1;
+        }
+        if (!ser.beg[k])
+        {
+            return 0;
+        }
+
+        // two-point Neville scheme of t_gpoly::interpolate relative to node k
+        int i0 = (k == 0) ? 0 : k - 1;
+        double X0 = ser.sec[i0] - ser.sec[k];
+        double X1 = ser.sec[i0 + 1] - ser.sec[k];
+        double Y0 = ser.val[i0];
+        double Y1 = ser.val[i0 + 1];
+        double x = s - ser.sec[k];
+
+        if (fabs(x - X0) > fabs(x - X1))
+        {
+            dclk = (X0 - x) * (Y0 - Y1) / (X1 - X0);
+            clk = Y0 + dclk;
+        }
+        else
+        {
+            dclk = (X1 - x) * (Y1 - Y0) / (X0 - X1);
+            clk = Y1 + dclk;
+        }
+        dclk /= (X1 - X0);
+
+        return 1;
+    }
+
+    int t_gprecindex::_lower(const t_series& ser, double s) const
+    {
+        int n = ser.sec.size();
+        int k = 0;
+        if (ser.step > 0.0)
+        {
+            k = static_cast<int>(ceil(s / ser.step));
+            k = max(0, min(n, k));
+            while (k > 0 && ser.sec[k - 1] >= s)
+            {
+                k--;
+            }
+            while (k < n && ser.sec[k] < s)
+            {
+                k++;
+            }
+        }
+        else
+        {
+            k = lower_bound(ser.sec.begin(), ser.sec.end(), s) - ser.sec.begin();
+        }
+        return k;
+    }
+
+    int t_gprecindex::_weights(const double* sec)
+    {
+        int npts = _degree + 1;
+        double h = (sec[npts - 1] - sec[0]) / _degree;
+
+        vector<double> u(npts);
+        for (int j = 0; j < npts; j++)
+        {
+            u[j] = (sec[j] - sec[0]) / h;
+        }
+
+        // windows with the same spacing share the weights
+        if (!_wset.empty())
+        {
+            const t_weights& last = _wset.back();
+            bool same = (fabs(last.h - h) < 1e-9);
+            for (int j = 0; same && j < npts; j++)
+            {
+                same = (fabs(last.u[j] - u[j]) < 1e-12);
+            }
+            if (same)
+            {
+                return _wset.size() - 1;
+            }
+        }
+
+        t_weights ws;
+        ws.h = h;
+        ws.u = u;
+        ws.w.assign(npts, 1.0);
+        for (int j = 0; j < npts; j++)
+        {
+            for (int k = 0; k < npts; k++)
+            {
+                if (k != j)
+                {
+                    ws.w[j] /= (u[j] - u[k]);
+                }
+            }
+        }
+        _wset.push_back(ws);
+        return _wset.size() - 1;
+    }
+
+} // namespace gnut
@@ -0,0 +1,143 @@
+/**
+ * @file         gprecindex.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Read-only interpolation index of precise orbits and clocks
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GPRECINDEX_H
+#define GPRECINDEX_H
+
+#include <unordered_map>
+#include <vector>
+#include "gexport/ExportLibGnut.h"
+#include "gutils/gtime.h"
+
+using namespace std;
+
+namespace gnut
+{
+    /**
+     * @brief read-only interpolation index of precise orbits and clocks
+     *
+     * Filled once from the discrete SP3/CLK data, then only queried. The nodes of
+     * each satellite are kept in contiguous arrays (seconds from the first node).
+     * For the orbits the Lagrange window of every nearest node is fixed in advance
+     * (the same window as the refitted t_gephprec polynomial) and its barycentric
+     * weights are precomputed; windows with the same node spacing share one set of
+     * weights. The queries find the node by the (nearly) uniform step and do not
+     * modify anything, so they need no lock.
+     */
+    class LibGnut_LIBRARY_EXPORT t_gprecindex
+    {
+    public:
+        /** @brief constructor with the degree of the orbit polynomials. */
+        explicit t_gprecindex(unsigned int degree = 9);
+
+        /** @brief default destructor. */
+        virtual ~t_gprecindex();
+
+        /**
+         * @brief add orbit nodes of a satellite (sorted by time, UNDEFVAL_POS for missing)
+         * @param[in]  sat       satellite
+         * @param[in]  t         node epochs
+         * @param[in]  x,y,z     node coordinates [m]
+         */
+        void add_orb(const string& sat, const vector<t_gtime>& t, const vector<double>& x, const vector<double>& y,
+                     const vector<double>& z);
+
+        /**
+         * @brief add clock nodes of a satellite (sorted by time, UNDEFVAL_CLK for missing)
+         * @param[in]  sat       satellite
+         * @param[in]  t         node epochs
+         * @param[in]  c         clock offsets [s]
+         */
+        void add_clk(const string& sat, const vector<t_gtime>& t, const vector<double>& c);
+
+        /**
+         * @brief interpolated position and velocity
+         * @return  1 computed, -1 no data for t
+         */
+        int pos(const string& sat, const t_gtime& t, double xyz[3], double vel[3] = NULL) const;
+
+        /**
+         * @brief interpolated clock (linear between the neighbouring nodes)
+         * @return  1 computed, 0 satellite or segment not indexed (use the discrete data), -1 no data for t
+         */
+        int clk(const string& sat, const t_gtime& t, double& clk, double& dclk) const;
+
+        /** @brief dense id of the orbit of a satellite (-1 not indexed) */
+        int orb_id(const string& sat) const;
+
+        /** @brief dense id of the clock of a satellite (-1 not indexed) */
+        int clk_id(const string& sat) const;
+
+        /**
+         * @brief interpolated positions and velocities of several satellites
+         * @param[in]  n     number of satellites
+         * @param[in]  id    orbit ids (orb_id, -1 skipped)
+         * @param[in]  t     epochs
+         * @param[out] xyz   positions [m], 3 per satellite
+         * @param[out] vel   velocities [m/s], 3 per satellite (NULL: not computed)
+         * @param[out] irc   1 computed, -1 no data
+         */
+        void pos(int n, const int* id, const t_gtime* t, double* xyz, double* vel, int* irc) const;
+
+        /**
+         * @brief interpolated clocks of several satellites
+         * @param[in]  n     number of satellites
+         * @param[in]  id    clock ids (clk_id, -1 skipped)
+         * @param[in]  t     epochs
+         * @param[out] clk   clock offsets [s]
+         * @param[out] dclk  clock drifts
+         * @param[out] irc   as clk()
+         */
+        void clk(int n, const int* id, const t_gtime* t, double* clk, double* dclk, int* irc) const;
+
+    protected:
+        /** @brief nodes of one satellite */
+        struct t_series
+        {
+            t_gtime t0;          ///< first node
+            double step = 0.0;   ///< typical node step [s]
+            vector<double> sec;  ///< nodes [s from t0]
+            vector<double> val;  ///< values (ncomp per node)
+            vector<int> beg;     ///< orbits: window start for the nearest node (-1 invalid), clocks: segment valid
+            vector<int> wgt;     ///< orbits: weight set of the window start
+        };
+
+        /** @brief barycentric weights of one window */
+        struct t_weights
+        {
+            double h;         ///< time unit [s]
+            vector<double> u; ///< nodes [h from the window start]
+            vector<double> w; ///< barycentric weights
+        };
+
+        /** @brief position and velocity from the nodes of a satellite */
+        int _pos_ser(const t_series& ser, const t_gtime& t, double xyz[3], double vel[3]) const;
+
+        /** @brief clock from the nodes of a satellite */
+        int _clk_ser(const t_series& ser, const t_gtime& t, double& clk, double& dclk) const;
+
+        /** @brief index of the first node not before s (lower bound) */
+        int _lower(const t_series& ser, double s) const;
+
+        /** @brief weight set of the nodes (shared with the previous window if equal) */
+        int _weights(const double* sec);
+
+        unsigned int _degree;                       ///< orbit polynomial degree
+        unordered_map<string, int> _orb_id;         ///< orbit ids by satellite
+        unordered_map<string, int> _clk_id;         ///< clock ids by satellite
+        vector<t_series> _orb;                      ///< orbits by id
+        vector<t_series> _clk;                      ///< clocks by id
+        vector<t_weights> _wset;                    ///< weight sets
+    };
+
+} // namespace gnut
+
+#endif
@@ -424,6 +424,98 @@ namespace gnut
         return;
     }
 
+    void t_gsatdata::reset(const t_gobsgnss& obs)
+    {
+        t_gobsgnss::operator=(obs);
+        id_type(t_gdata::SATDATA);
+        id_group(t_gdata::GRP_OBSERV);
+
+        _conf_crd = t_gtriple();
+        _e = t_gtriple();
+        is_process = false;
+        _satcrd = t_gtriple(0.0, 0.0, 0.0);
+        _satcrdcrs = t_gtriple();
+        _satpco = t_gtriple(0.0, 0.0, 0.0);
+        _satvel = t_gtriple();
+        _satvel_crs = t_gtriple();
+        _satindex = 0;
+        _reccrd = t_gtriple();
+        _reccrdcrs = t_gtriple();
+        _sat2reccrs = t_gtriple();
+        for (Matrix* mat : {&_orbfunct, &_rotmat, &_drdxpole, &_drdypole, &_drdut1, &_scf2crs, &_scf2trs})
+        {
+            if (mat->Storage() > 0)
+            {
+                mat->CleanUp();
+            }
+        }
+        _drate = 0.0;
+        _dloudx = t_gtriple();
+        _TR = t_gtime();
+        _TS = t_gtime();
+        _clk = 0.0;
+        _dclk = 0.0;
+        _reldelay = 0.0;
+        _ele = 0.0;
+        _ele_leo = 0.0;
+        _azi_rec = 0.0;
+        _azi_sat = 0.0;
+        _zen_rec = 0.0;
+        _zen_sat = 0.0;
+        _nadir = 0.0;
+        _rho = 0.0;
+        _eclipse = false;
+        _mfH = 0.0;
+        _mfW = 0.0;
+        _mfG = 0.0;
+        _wind = 0.0;
+        _low_prec = false;
+        _slipf = false;
+        _is_carrier_range.clear();
+        _isExistAug = false;
+        _code_res_norm.clear();
+        _phase_res_norm.clear();
+        _code_res_orig.clear();
+        _phase_res_orig.clear();
+        _beta_val = 999;
+        _orb_angle_val = 999;
+        _yaw = 999;
+    }
+
+    void t_gsatdata::copy_geometry(const t_gsatdata& other)
+    {
+        if (&other == this)
+        {
+            return;
+        }
+        _satcrd = other._satcrd;
+        _satcrdcrs = other._satcrdcrs;
+        _satpco = other._satpco;
+        _satvel = other._satvel;
+        _satvel_crs = other._satvel_crs;
+        _scf2crs = other._scf2crs;
+        _scf2trs = other._scf2trs;
+        _drate = other._drate;
+        _TR = other._TR;
+        _TS = other._TS;
+        _clk = other._clk;
+        _dclk = other._dclk;
+        _reldelay = other._reldelay;
+        _ele = other._ele;
+        _ele_leo = other._ele_leo;
+        _azi_rec = other._azi_rec;
+        _azi_sat = other._azi_sat;
+        _zen_rec = other._zen_rec;
+        _zen_sat = other._zen_sat;
+        _nadir = other._nadir;
+        _rho = other._rho;
+        _eclipse = other._eclipse;
+        _mfH = other._mfH;
+        _mfW = other._mfW;
+        _mfG = other._mfG;
+        _wind = other._wind;
+    }
+
     int t_gsatdata::_addprd(t_gallnav* gnav, const bool& corrTOT, const bool& msk_health)
     {
         string satname(_satid);
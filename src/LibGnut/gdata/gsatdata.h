@@ -356,6 +356,27 @@ namespace gnut
          */
         void clear();
 
+        /**
+         * @brief re-initialise in place with a new raw observation
+         *
+         * Same state as t_gsatdata(obs), but the storage of the element (observation
+         * maps, residual vectors) is reused, so an epoch buffer can be refilled
+         * every epoch without reallocating.
+         *
+         * @param obs raw observation
+         */
+        void reset(const t_gobsgnss& obs);
+
+        /**
+         * @brief take the satellite geometry and corrections of another object
+         *
+         * Positions, velocities, clocks, angles, rho, mapping functions and windup
+         * are copied, the observations and residuals are kept.
+         *
+         * @param other satellite data of the same satellite and epoch
+         */
+        void copy_geometry(const t_gsatdata& other);
+
         /**
          * @brief valid
          *
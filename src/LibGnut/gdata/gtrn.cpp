@@ -45,10 +45,12 @@ namespace gnut
         {
             if (it->first.compare(path) == 0)
             {
-                return it->second;
+                rxnhdr = it->second;
+                break;
             }
         }
 
+        _gmutex.unlock();
         return rxnhdr;
     }
 
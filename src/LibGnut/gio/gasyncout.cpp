@@ -0,0 +1,157 @@
+/**
+ * @file         gasyncout.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Buffered output file written by a background thread
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include "gio/gasyncout.h"
+#include "gio/great_log.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_gasyncout::t_gasyncout(t_giof* file, size_t size, double interval, size_t depth) :
+        _file(file),
+        _size(size > 0 ? size : 1),
+        _interval(chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(interval))),
+        _depth(depth > 0 ? depth : 1),
+        _last(chrono::steady_clock::now()),
+        _stop(false)
+    {
+        _buff.reserve(_size);
+        _thread = thread(&t_gasyncout::_run, this);
+    }
+
+    t_gasyncout::~t_gasyncout()
+    {
+        close();
+    }
+
+    void t_gasyncout::write(const char* buff, int size)
+    {
+        if (size < 1)
+        {
+            return;
+        }
+
+        unique_lock<mutex> lock(_mutex);
+        if (_stop)
+        {
+            return;
+        }
+        _buff.append(buff, size);
+        if (_buff.size() >= _size || chrono::steady_clock::now() - _last >= _interval)
+        {
+            _push(lock);
+        }
+    }
+
+    void t_gasyncout::write(const string& str)
+    {
+        write(str.c_str(), str.size());
+    }
+
+    void t_gasyncout::flush()
+    {
+        unique_lock<mutex> lock(_mutex);
+        if (!_stop && !_buff.empty())
+        {
+            _push(lock);
+        }
+    }
+
+    void t_gasyncout::close()
+    {
+        unique_lock<mutex> lock(_mutex);
+        if (!_thread.joinable())
+        {
+            return;
+        }
+        if (!_stop && !_buff.empty())
+        {
+            _push(lock);
+        }
+        _stop = true;
+        lock.unlock();
+
+        _cv_data.notify_one();
+        _thread.join();
+    }
+
+    void t_gasyncout::_push(unique_lock<mutex>& lock)
+    {
+        _cv_space.wait(lock, [this] { return _queue.size() < _depth; });
+
+        _queue.push_back(string());
+        _queue.back().swap(_buff);
+        _buff.reserve(_size);
+        _last = chrono::steady_clock::now();
+
+        _cv_data.notify_one();
+    }
+
+    void t_gasyncout::_run()
+    {
+        string buff;
+        while (true)
+        {
+            unique_lock<mutex> lock(_mutex);
+            auto ready = [this] { return _stop || !_queue.empty(); };
+            bool timeout = false;
+            if (_interval > chrono::steady_clock::duration::zero())
+            {
+                timeout = !_cv_data.wait_for(lock, _interval, ready);
+            }
+            else
+            {
+                _cv_data.wait(lock, ready);
+            }
+
+            if (timeout)
+            {
+                // no records handed over within the interval, take the waiting ones from the buffer
+                auto now = chrono::steady_clock::now();
+                if (_buff.empty() || now - _last < _interval)
+                {
+                    continue;
+                }
+                buff.swap(_buff);
+                _buff.reserve(_size);
+                _last = now;
+                lock.unlock();
+            }
+            else if (_queue.empty())
+            {
+                break; // stopped and everything written
+            }
+            else
+            {
+                buff.swap(_queue.front());
+                _queue.pop_front();
+                lock.unlock();
+                _cv_space.notify_one();
+            }
+
+            if (_file)
+            {
+                try
+                {
+                    _file->write(buff.c_str(), buff.size());
+                    _file->flush();
+                }
+                catch (exception& e)
+                {
+                    GREAT_ERROR("writing " + _file->name() + " failed: " + e.what());
+                }
+            }
+            buff.clear();
+        }
+    }
+
+} // namespace gnut
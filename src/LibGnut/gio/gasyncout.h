@@ -0,0 +1,92 @@
+/**
+ * @file         gasyncout.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Buffered output file written by a background thread
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GASYNCOUT_H
+#define GASYNCOUT_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "gexport/ExportLibGnut.h"
+#include "gio/giof.h"
+
+using namespace std;
+
+namespace gnut
+{
+    /**
+     * @brief buffered output written by a background thread
+     *
+     * The records are appended to a memory buffer. When the buffer reaches its size,
+     * or the flush interval has passed since the last hand-over, it is passed to the
+     * writer thread which writes and flushes the file. The writer also wakes up every
+     * interval and takes the buffer itself when no more records arrive. At most depth buffers wait for
+     * the writer, then write() blocks, so the memory is bounded by (depth + 1) * size
+     * whatever the length of the run.
+     */
+    class LibGnut_LIBRARY_EXPORT t_gasyncout
+    {
+    public:
+        /**
+         * @brief constructor, starts the writer thread
+         * @param[in]  file      output file (not owned, used only by the writer thread until close())
+         * @param[in]  size      buffer size [bytes]
+         * @param[in]  interval  maximum time the records wait in the buffer [s]
+         * @param[in]  depth     maximum number of buffers waiting for the writer
+         */
+        t_gasyncout(t_giof* file, size_t size = 262144, double interval = 1.0, size_t depth = 4);
+
+        /** @brief destructor, writes the rest (close()). */
+        virtual ~t_gasyncout();
+
+        /** @brief append records */
+        void write(const char* buff, int size);
+        void write(const string& str);
+
+        /** @brief pass the buffer to the writer thread */
+        void flush();
+
+        /** @brief write all buffers and stop the writer thread */
+        void close();
+
+        /** @brief output file */
+        t_giof* file() const
+        {
+            return _file;
+        }
+
+    protected:
+        /** @brief writer thread */
+        void _run();
+
+        /** @brief move the buffer to the queue (_mutex locked by the caller) */
+        void _push(unique_lock<mutex>& lock);
+
+        t_giof* _file;                            ///< output file
+        size_t _size;                             ///< buffer size [bytes]
+        chrono::steady_clock::duration _interval; ///< maximum time in the buffer
+        size_t _depth;                            ///< maximum number of queued buffers
+        string _buff;                             ///< buffer being filled
+        chrono::steady_clock::time_point _last;   ///< last hand-over
+        deque<string> _queue;                     ///< buffers waiting for the writer
+        bool _stop;                               ///< no more buffers
+        mutex _mutex;                             ///< queue lock
+        condition_variable _cv_data;              ///< buffer queued / stop
+        condition_variable _cv_space;             ///< buffer written
+        thread _thread;                           ///< writer thread
+    };
+
+} // namespace gnut
+
+#endif
@@ -0,0 +1,127 @@
+/**
+ * @file         gepochqueue.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Bounded lock-free queue of decoded observation epochs
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <thread>
+#include "gio/gepochqueue.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_gepochqueue::t_gepochqueue(size_t capacity) :
+        _ring(max<size_t>(capacity, 1) + 1),
+        _head(0),
+        _tail(0),
+        _closed(false)
+    {
+    }
+
+    t_gepochqueue::~t_gepochqueue()
+    {
+    }
+
+    bool t_gepochqueue::push(t_gobsepoch& epo)
+    {
+        if (_closed.load(memory_order_acquire))
+        {
+            return false;
+        }
+
+        size_t tail = _tail.load(memory_order_relaxed);
+        size_t next = (tail + 1) % _ring.size();
+        if (next == _head.load(memory_order_acquire))
+        {
+            return false;
+        }
+
+        _ring[tail] = std::move(epo);
+        _tail.store(next, memory_order_release);
+        return true;
+    }
+
+    bool t_gepochqueue::pop(t_gobsepoch& epo)
+    {
+        size_t head = _head.load(memory_order_relaxed);
+        if (head == _tail.load(memory_order_acquire))
+        {
+            return false;
+        }
+
+        epo = std::move(_ring[head]);
+        _head.store((head + 1) % _ring.size(), memory_order_release);
+        return true;
+    }
+
+    bool t_gepochqueue::push_wait(t_gobsepoch& epo)
+    {
+        unsigned int nwait = 0;
+        while (!push(epo))
+        {
+            if (_closed.load(memory_order_acquire))
+            {
+                return false;
+            }
+            _backoff(nwait);
+        }
+        return true;
+    }
+
+    bool t_gepochqueue::pop_wait(t_gobsepoch& epo)
+    {
+        unsigned int nwait = 0;
+        while (!pop(epo))
+        {
+            // epochs pushed before closing are still delivered
+            if (_closed.load(memory_order_acquire))
+            {
+                return pop(epo);
+            }
+            _backoff(nwait);
+        }
+        return true;
+    }
+
+    void t_gepochqueue::close()
+    {
+        _closed.store(true, memory_order_release);
+    }
+
+    bool t_gepochqueue::closed() const
+    {
+        return _closed.load(memory_order_acquire);
+    }
+
+    size_t t_gepochqueue::size() const
+    {
+        size_t head = _head.load(memory_order_acquire);
+        size_t tail = _tail.load(memory_order_acquire);
+        return (tail + _ring.size() - head) % _ring.size();
+    }
+
+    size_t t_gepochqueue::capacity() const
+    {
+        return _ring.size() - 1;
+    }
+
+    void t_gepochqueue::_backoff(unsigned int& nwait) const
+    {
+        // short waits stay on the core, longer ones (paced replay, slow consumer) sleep
+        if (++nwait < 64)
+        {
+            this_thread::yield();
+        }
+        else
+        {
+            this_thread::sleep_for(chrono::microseconds(50));
+        }
+    }
+
+} // namespace gnut
@@ -0,0 +1,87 @@
+/**
+ * @file         gepochqueue.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Bounded lock-free queue of decoded observation epochs
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GEPOCHQUEUE_H
+#define GEPOCHQUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include "gexport/ExportLibGnut.h"
+#include "gall/gallobs.h"
+
+using namespace std;
+
+namespace gnut
+{
+    /** @brief one decoded epoch of a site */
+    struct t_gobsepoch
+    {
+        t_gtime epoch;                          ///< epoch
+        string site;                            ///< site name
+        vector<t_spt_gobs> obs;                 ///< satellite records of the epoch
+        map<string, int> glofrq;                ///< GLONASS frequency numbers (only when changed)
+        chrono::steady_clock::time_point stamp; ///< time of the push (latency)
+    };
+
+    /**
+     * @brief bounded single-producer/single-consumer queue of epochs
+     *
+     * The ring is preallocated, push and pop only move the epoch and advance an
+     * atomic index, no locks are taken. The waiting variants spin with yield and
+     * sleep shortly after a while. close() is called by either side to stop the
+     * other one (end of data or end of processing).
+     */
+    class LibGnut_LIBRARY_EXPORT t_gepochqueue
+    {
+    public:
+        /** @brief constructor with capacity (number of epochs). */
+        explicit t_gepochqueue(size_t capacity = 64);
+
+        /** @brief default destructor. */
+        virtual ~t_gepochqueue();
+
+        /** @brief push epoch (moved), false if the queue is full or closed. */
+        bool push(t_gobsepoch& epo);
+
+        /** @brief pop epoch, false if the queue is empty. */
+        bool pop(t_gobsepoch& epo);
+
+        /** @brief push epoch, wait while the queue is full, false if closed. */
+        bool push_wait(t_gobsepoch& epo);
+
+        /** @brief pop epoch, wait while the queue is empty, false if closed and empty. */
+        bool pop_wait(t_gobsepoch& epo);
+
+        /** @brief no more epochs will be pushed/popped. */
+        void close();
+
+        /** @brief queue closed */
+        bool closed() const;
+
+        /** @brief number of epochs in the queue */
+        size_t size() const;
+
+        /** @brief maximum number of epochs in the queue */
+        size_t capacity() const;
+
+    protected:
+        /** @brief wait a bit (spin, yield, sleep) */
+        void _backoff(unsigned int& nwait) const;
+
+        vector<t_gobsepoch> _ring; ///< preallocated slots (capacity + 1)
+        atomic<size_t> _head;      ///< next slot to pop (consumer)
+        atomic<size_t> _tail;      ///< next slot to push (producer)
+        atomic<bool> _closed;      ///< closed by producer or consumer
+    };
+
+} // namespace gnut
+
+#endif
@@ -0,0 +1,147 @@
+/**
+ * @file         gkmlout.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        KML file written incrementally
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <sstream>
+#include "gio/gkmlout.h"
+#include "gio/great_log.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_gkmlout::t_gkmlout(const string& name, size_t size, double interval) :
+        _name(name),
+        _root("kml"),
+        _file(),
+        _out(nullptr),
+        _spool(nullptr),
+        _indent("  "),
+        _open(false)
+    {
+        _file.mask(name);
+        _out = new t_gasyncout(&_file, size, interval);
+    }
+
+    t_gkmlout::~t_gkmlout()
+    {
+        if (_open)
+        {
+            close(xml_node());
+        }
+        delete _out;
+        if (_spool)
+        {
+            fclose(_spool);
+        }
+    }
+
+    void t_gkmlout::begin(const xml_node& document)
+    {
+        if (_open)
+        {
+            return;
+        }
+        _spool = tmpfile();
+        if (!_spool)
+        {
+            GREAT_WARN("KML " + _name + ": no temporary file for the track");
+        }
+        if (document.parent() && document.parent().name()[0] != '\0')
+        {
+            _root = document.parent().name();
+        }
+
+        string head = "<?xml version=\"1.0\"?>\n<" + _root + ">\n" + _indent + "<Document>\n";
+        _out->write(head);
+        for (xml_node child = document.first_child(); child; child = child.next_sibling())
+        {
+            _out->write(_print(child));
+        }
+        _open = true;
+    }
+
+    void t_gkmlout::add(const xml_node& node)
+    {
+        if (_open)
+        {
+            _out->write(_print(node));
+        }
+    }
+
+    void t_gkmlout::track(const string& coord)
+    {
+        if (_open && _spool)
+        {
+            fputs(coord.c_str(), _spool);
+            fputc('\n', _spool);
+        }
+    }
+
+    void t_gkmlout::close(const xml_node& placemark)
+    {
+        if (!_open)
+        {
+            return;
+        }
+
+        if (placemark)
+        {
+            // print the placemark around a marker and replace it by the spooled coordinates
+            const string marker = "@TRACK@";
+            xml_node coords = placemark.child("LineString").child("coordinates");
+            if (coords)
+            {
+                coords.text().set(marker.c_str());
+            }
+            string str = _print(placemark);
+            size_t pos = str.find(marker);
+            if (pos == string::npos || !_spool)
+            {
+                _out->write(str);
+            }
+            else
+            {
+                string indent;
+                for (int i = 0; i < 5; i++)
+                {
+                    indent += _indent;
+                }
+                _out->write(str.substr(0, pos) + "\n");
+
+                rewind(_spool);
+                char line[256];
+                while (fgets(line, sizeof(line), _spool))
+                {
+                    _out->write(indent + line);
+                }
+                _out->write(indent.substr(_indent.size()) + str.substr(pos + marker.size()));
+            }
+            if (coords)
+            {
+                coords.remove_child(coords.first_child());
+            }
+        }
+
+        _out->write(_indent + "</Document>\n</" + _root + ">\n");
+        _out->close();
+        _open = false;
+
+        GREAT_INFO("XML-file saved: " + _file.name());
+    }
+
+    string t_gkmlout::_print(const xml_node& node) const
+    {
+        ostringstream os;
+        node.print(os, _indent.c_str(), format_indent, encoding_auto, 2);
+        return os.str();
+    }
+
+} // namespace gnut
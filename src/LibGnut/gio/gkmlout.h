@@ -0,0 +1,81 @@
+/**
+ * @file         gkmlout.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        KML file written incrementally
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GKMLOUT_H
+#define GKMLOUT_H
+
+#include <cstdio>
+#include <string>
+#include "gexport/ExportLibGnut.h"
+#include "gio/gasyncout.h"
+#include "pugixml/src/pugixml.hpp"
+
+using namespace std;
+using namespace pugi;
+
+namespace gnut
+{
+    /**
+     * @brief KML document written while it is produced
+     *
+     * The head (styles) and every epoch placemark are printed as soon as they are
+     * complete and go to the file through t_gasyncout. The coordinates of the track
+     * are spooled to a temporary file, and the track placemark is written by close()
+     * as the last element of the Document. Only one epoch is kept in memory.
+     */
+    class LibGnut_LIBRARY_EXPORT t_gkmlout
+    {
+    public:
+        /**
+         * @brief constructor
+         * @param[in]  name      file name
+         * @param[in]  size      buffer size [bytes]
+         * @param[in]  interval  maximum time the records wait in the buffer [s]
+         */
+        t_gkmlout(const string& name, size_t size = 262144, double interval = 1.0);
+
+        /** @brief destructor, closes the document if not yet done. */
+        virtual ~t_gkmlout();
+
+        /**
+         * @brief write the declaration, the root and the children of the Document
+         * @param[in]  document  Document element (its parent is the root)
+         */
+        void begin(const xml_node& document);
+
+        /** @brief write an element of the Document (epoch placemark) */
+        void add(const xml_node& node);
+
+        /** @brief add a point of the track (lon,lat) */
+        void track(const string& coord);
+
+        /**
+         * @brief write the track placemark (coordinates from the spool) and close the document
+         * @param[in]  placemark track placemark with an empty LineString/coordinates element
+         */
+        void close(const xml_node& placemark);
+
+    protected:
+        /** @brief print the node as a child of the Document */
+        string _print(const xml_node& node) const;
+
+        string _name;       ///< file name
+        string _root;       ///< root element
+        t_giof _file;       ///< KML file
+        t_gasyncout* _out;  ///< buffered output of the file
+        FILE* _spool;       ///< track coordinates
+        string _indent;     ///< indentation of one level
+        bool _open;         ///< document begun and not closed
+    };
+
+} // namespace gnut
+
+#endif
@@ -0,0 +1,248 @@
+/**
+ * @file         gmmapfile.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Memory-mapped file io, optionally decoding blocks of the file in parallel
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <thread>
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "gio/gmmapfile.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_gmmapfile::t_gmmapfile() :
+        t_gfile(),
+        _mdata(nullptr),
+        _msize(0)
+#ifdef _WIN32
+        ,
+        _hfile(nullptr),
+        _hmap(nullptr)
+#endif
+    {
+    }
+
+    t_gmmapfile::~t_gmmapfile()
+    {
+        _unmap();
+    }
+
+    void t_gmmapfile::run_read()
+    {
+        if (!_map())
+        {
+            t_gfile::run_read();
+            return;
+        }
+
+        _gmutex.lock();
+        if (_coder)
+        {
+            _coder->clear();
+            _stop = 0;
+            _running = 1;
+
+            size_t beg = _decode_head(_coder, _msize);
+            _decode_data(_coder, beg, _msize);
+        }
+        _stop_common();
+        _gmutex.unlock();
+    }
+
+    void t_gmmapfile::run_read(int nthreads, const function<t_gcoder*()>& make_coder)
+    {
+        vector<size_t> blocks;
+        if (nthreads > 1 && _coder && _map())
+        {
+            blocks = _coder->data_blocks(_mdata, _msize, nthreads);
+        }
+        if (blocks.size() < 3)
+        {
+            run_read();
+            return;
+        }
+
+        _gmutex.lock();
+        _stop = 0;
+        _running = 1;
+
+        // one decoder per block, headers are decoded in order before the blocks
+        vector<t_gcoder*> coders(blocks.size() - 1, nullptr);
+        coders[0] = _coder;
+        for (size_t i = 1; i < coders.size(); ++i)
+        {
+            coders[i] = make_coder();
+        }
+        for (size_t i = 0; i < coders.size(); ++i)
+        {
+            if (coders[i])
+            {
+                coders[i]->clear();
+                _decode_head(coders[i], blocks[0]);
+            }
+        }
+
+        vector<thread> workers;
+        for (size_t i = 0; i < coders.size(); ++i)
+        {
+            if (coders[i])
+            {
+                workers.push_back(thread(&t_gmmapfile::_decode_data, this, coders[i], blocks[i], blocks[i + 1]));
+            }
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        for (size_t i = 1; i < coders.size(); ++i)
+        {
+            delete coders[i];
+        }
+
+        _stop_common();
+        _gmutex.unlock();
+    }
+
+    bool t_gmmapfile::_map()
+    {
+        if (_mdata)
+        {
+            return true;
+        }
+
+        // compressed files and file masks are read by t_gfile
+        string name = mask();
+        if (_gzip || name.empty() || name.find('$') != string::npos)
+        {
+            return false;
+        }
+
+#ifdef _WIN32
+        HANDLE hfile = CreateFileA(name.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (hfile == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+        LARGE_INTEGER fsize;
+        if (!GetFileSizeEx(hfile, &fsize) || fsize.QuadPart == 0)
+        {
+            CloseHandle(hfile);
+            return false;
+        }
+        HANDLE hmap = CreateFileMappingA(hfile, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (hmap == NULL)
+        {
+            CloseHandle(hfile);
+            return false;
+        }
+        void* data = MapViewOfFile(hmap, FILE_MAP_READ, 0, 0, 0);
+        if (data == NULL)
+        {
+            CloseHandle(hmap);
+            CloseHandle(hfile);
+            return false;
+        }
+        _hfile = hfile;
+        _hmap = hmap;
+        _msize = static_cast<size_t>(fsize.QuadPart);
+#else
+        int fd = open(name.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            close(fd);
+            return false;
+        }
+        void* data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+        madvise(data, st.st_size, MADV_SEQUENTIAL);
+        _msize = static_cast<size_t>(st.st_size);
+#endif
+        _mdata = static_cast<const char*>(data);
+
+        GREAT_DEBUG("File mapped: " + name + " size: " + int2str(_msize));
+        return true;
+    }
+
+    void t_gmmapfile::_unmap()
+    {
+        if (!_mdata)
+        {
+            return;
+        }
+#ifdef _WIN32
+        UnmapViewOfFile(_mdata);
+        CloseHandle(_hmap);
+        CloseHandle(_hfile);
+        _hmap = _hfile = nullptr;
+#else
+        munmap(const_cast<char*>(_mdata), _msize);
+#endif
+        _mdata = nullptr;
+        _msize = 0;
+    }
+
+    size_t t_gmmapfile::_decode_head(t_gcoder* coder, size_t end)
+    {
+        // same pieces as t_gfile::init_read, the rest of the last piece stays in the decoder
+        vector<string> errmsg;
+        size_t pos = 0;
+        while (pos < end && _stop != 1)
+        {
+            int nbytes = static_cast<int>(min<size_t>(FILEHDR_SIZE, end - pos));
+            int irc = coder->decode_head(const_cast<char*>(_mdata + pos), nbytes, errmsg);
+            pos += nbytes;
+            if (irc < 0)
+            {
+                break;
+            }
+        }
+        return pos;
+    }
+
+    void t_gmmapfile::_decode_data(t_gcoder* coder, size_t beg, size_t end)
+    {
+        // the decoders copy the input into their own buffer, the mapping is never written
+        vector<string> errmsg;
+        int count = 0;
+        size_t pos = beg;
+        while (pos < end && _stop != 1)
+        {
+            int nbytes = static_cast<int>(min<size_t>(MMAP_PIECE_SIZE, end - pos));
+            coder->decode_data(const_cast<char*>(_mdata + pos), nbytes, count, errmsg);
+            pos += nbytes;
+
+            if (coder->end_epoch > t_gtime(0, 0) && coder->epoch > coder->end_epoch)
+            {
+                break;
+            }
+        }
+    }
+
+} // namespace gnut
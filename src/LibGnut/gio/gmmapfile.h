@@ -0,0 +1,81 @@
+/**
+ * @file         gmmapfile.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Memory-mapped file io, optionally decoding blocks of the file in parallel
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GMMAPFILE_H
+#define GMMAPFILE_H
+
+#include <functional>
+#include "gio/gfile.h"
+
+// bytes passed to the decoder in one call (copied into its decode buffer, which grows as needed)
+#define MMAP_PIECE_SIZE 524288
+
+using namespace std;
+
+namespace gnut
+{
+    /**
+     * @brief class for t_gmmapfile derive from t_gfile
+     *
+     * Uncompressed files are mapped into memory and handed to the decoder in pieces
+     * of the mapping, without read calls and intermediate chunk buffers (the decoder
+     * still copies each piece into its own decode buffer).
+     * Compressed files (or a failed mapping) fall back to t_gfile reading.
+     */
+    class LibGnut_LIBRARY_EXPORT t_gmmapfile : public t_gfile
+    {
+    public:
+        /** @brief default constructor. */
+        t_gmmapfile();
+
+        /** @brief default destructor. */
+        virtual ~t_gmmapfile();
+
+        /** @brief read and decode the whole file with the decoder set by coder(). */
+        virtual void run_read() override;
+
+        /**
+         * @brief read and decode the file by several decoders in parallel
+         *
+         * The decoder set by coder() splits the content (t_gcoder::data_blocks), each
+         * block gets its own decoder created by make_coder (the first block uses the
+         * decoder set by coder()). All decoders read the header first. If the content
+         * cannot be split, run_read() is used.
+         *
+         * @param nthreads   number of blocks/threads
+         * @param make_coder creates a decoder with the same data containers
+         */
+        void run_read(int nthreads, const function<t_gcoder*()>& make_coder);
+
+    protected:
+        /** @brief map the file, false if not possible */
+        bool _map();
+
+        /** @brief release the mapping */
+        void _unmap();
+
+        /** @brief decode header from bytes before end, return position of the first byte not passed */
+        size_t _decode_head(t_gcoder* coder, size_t end);
+
+        /** @brief decode data between beg and end */
+        void _decode_data(t_gcoder* coder, size_t beg, size_t end);
+
+        const char* _mdata; ///< mapped content
+        size_t _msize;      ///< mapped size
+#ifdef _WIN32
+        void* _hfile; ///< file handle
+        void* _hmap;  ///< mapping handle
+#endif
+    };
+
+} // namespace gnut
+
+#endif
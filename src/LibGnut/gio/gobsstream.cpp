@@ -0,0 +1,165 @@
+/**
+ * @file         gobsstream.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Observation file replayed epoch by epoch into a bounded queue
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <thread>
+#include "gio/gobsstream.h"
+#include "gcoders/gcoder.h"
+#include "gio/great_log.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_gobsstream::t_gobsstream(t_gsetbase* set, size_t capacity) :
+        t_gfile(),
+        _queue(capacity),
+        _speed(0.0),
+        _header(false),
+        _eof(false),
+        _nepo(0),
+        _nglo(0)
+    {
+        _window.gset(set);
+    }
+
+    t_gobsstream::~t_gobsstream()
+    {
+    }
+
+    bool t_gobsstream::open()
+    {
+        _gmutex.lock();
+
+        if (!_header && _coder)
+        {
+            _coder->clear();
+            init_read();
+            _header = true;
+        }
+
+        // read until the first epoch is complete (site known)
+        char* loc_buff = new char[_size];
+        while (_coder && !_eof && _stop != 1)
+        {
+            set<string> sites = _window.stations();
+            if (!sites.empty() && _window.nepochs(*sites.begin()) > 1)
+            {
+                break;
+            }
+            _read_chunk(loc_buff);
+        }
+        delete[] loc_buff;
+
+        set<string> sites = _window.stations();
+        if (!sites.empty())
+        {
+            _site = *sites.begin();
+        }
+
+        _gmutex.unlock();
+        return !_site.empty();
+    }
+
+    void t_gobsstream::run_read()
+    {
+        if (_site.empty() && !open())
+        {
+            GREAT_WARN("No observations in stream: " + path());
+            _queue.close();
+            return;
+        }
+
+        _gmutex.lock();
+        _stop = 0;
+        _running = 1;
+
+        char* loc_buff = new char[_size];
+        bool queue_open = _forward(false);
+        while (queue_open && !_eof && _stop != 1)
+        {
+            _read_chunk(loc_buff);
+            queue_open = _forward(_eof);
+        }
+        delete[] loc_buff;
+
+        _queue.close();
+        GREAT_INFO("Stream " + _site + " finished, epochs: " + int2str(_nepo));
+
+        _stop_common();
+        _gmutex.unlock();
+    }
+
+    bool t_gobsstream::_read_chunk(char* buff)
+    {
+        vector<string> errmsg;
+        int nbytes = _gio_read(buff, _size);
+        if (nbytes <= 0)
+        {
+            _eof = true;
+            return false;
+        }
+
+        _coder->decode_data(buff, nbytes, _count, errmsg);
+        if (_coder->end_epoch > t_gtime(0, 0) && _coder->epoch > _coder->end_epoch)
+        {
+            _eof = true;
+        }
+        return !_eof;
+    }
+
+    bool t_gobsstream::_forward(bool last)
+    {
+        // the newest epoch may still miss satellites until the next one is decoded
+        vector<t_gtime> epochs = _window.epochs(_site);
+        size_t nfwd = last ? epochs.size() : (epochs.size() > 1 ? epochs.size() - 1 : 0);
+
+        for (size_t i = 0; i < nfwd; ++i)
+        {
+            t_gobsepoch epo;
+            epo.epoch = epochs[i];
+            epo.site = _site;
+            epo.obs = _window.obs_pt(_site, epochs[i]);
+
+            const map<string, int>& glofrq = _window.glo_freq_num();
+            if (glofrq.size() != _nglo)
+            {
+                epo.glofrq = glofrq;
+                _nglo = glofrq.size();
+            }
+
+            // pacing by the epoch times
+            if (_nepo == 0)
+            {
+                _epo0 = epochs[i];
+                _wall0 = chrono::steady_clock::now();
+            }
+            else if (_speed > 0.0)
+            {
+                double dt = epochs[i].diff(_epo0) / _speed;
+                this_thread::sleep_until(_wall0 + chrono::duration_cast<chrono::steady_clock::duration>(chrono::duration<double>(dt)));
+            }
+
+            epo.stamp = chrono::steady_clock::now();
+            if (!_queue.push_wait(epo))
+            {
+                return false;
+            }
+            ++_nepo;
+        }
+
+        if (nfwd > 0)
+        {
+            _window.clean_outer(_site, nfwd < epochs.size() ? epochs[nfwd] : LAST_TIME);
+        }
+        return true;
+    }
+
+} // namespace gnut
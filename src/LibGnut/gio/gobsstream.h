@@ -0,0 +1,101 @@
+/**
+ * @file         gobsstream.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Observation file replayed epoch by epoch into a bounded queue
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GOBSSTREAM_H
+#define GOBSSTREAM_H
+
+#include "gio/gfile.h"
+#include "gio/gepochqueue.h"
+
+using namespace std;
+
+namespace gnut
+{
+    /**
+     * @brief class for t_gobsstream derive from t_gfile
+     *
+     * The file is read chunk by chunk, the decoder set by coder() fills a small
+     * window container (window()). Each complete epoch (all but the newest decoded
+     * one) is moved from the window into the queue, so only a few epochs are kept
+     * in memory. The replay is paced by the epoch times (speed() times real time)
+     * or runs as fast as the consumer takes the epochs (speed 0).
+     */
+    class LibGnut_LIBRARY_EXPORT t_gobsstream : public t_gfile
+    {
+    public:
+        /**
+         * @brief constructor
+         * @param[in]  set       settings for the window container
+         * @param[in]  capacity  number of epochs in the queue
+         */
+        t_gobsstream(t_gsetbase* set, size_t capacity = 64);
+
+        /** @brief default destructor. */
+        virtual ~t_gobsstream();
+
+        /** @brief window container, to be added to the decoder */
+        t_gallobs* window()
+        {
+            return &_window;
+        }
+
+        /** @brief queue of decoded epochs (consumer side) */
+        t_gepochqueue* queue()
+        {
+            return &_queue;
+        }
+
+        /** @brief set replay speed (multiple of real time, 0 = unpaced) */
+        void speed(double speed)
+        {
+            _speed = speed;
+        }
+
+        /** @brief decode the header and the first epoch (site known), false if no data */
+        bool open();
+
+        /** @brief site of the stream (empty before the first epoch is decoded) */
+        string site() const
+        {
+            return _site;
+        }
+
+        /** @brief number of epochs pushed into the queue */
+        size_t nepochs() const
+        {
+            return _nepo;
+        }
+
+        /** @brief replay the file into the queue (could be run in a separate thread), closes the queue at the end. */
+        virtual void run_read() override;
+
+    protected:
+        /** @brief read and decode one chunk, false at the end of file */
+        bool _read_chunk(char* buff);
+
+        /** @brief move complete epochs (all if last) from the window to the queue, false if the queue was closed */
+        bool _forward(bool last);
+
+        t_gallobs _window;                            ///< decoded epochs not yet in the queue
+        t_gepochqueue _queue;                         ///< epochs for the consumer
+        double _speed;                                ///< replay speed
+        string _site;                                 ///< site of the stream
+        bool _header;                                 ///< header decoded
+        bool _eof;                                    ///< end of file reached
+        size_t _nepo;                                 ///< number of epochs pushed
+        size_t _nglo;                                 ///< number of GLONASS frequencies pushed
+        t_gtime _epo0;                                ///< first pushed epoch (pacing)
+        chrono::steady_clock::time_point _wall0;      ///< wall time of the first pushed epoch (pacing)
+    };
+
+} // namespace gnut
+
+#endif
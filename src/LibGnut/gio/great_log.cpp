@@ -80,6 +80,11 @@ namespace gnut
 
             _gspdlog->set_level(level);
             _gspdlog->flush_on(level);
+            if (level < GREAT_LOG_ACTIVE_LEVEL)
+            {
+                _gspdlog->warn("log level {} requested, messages below {} are not compiled in this build",
+                               spdlog::level::to_string_view(level), spdlog::level::to_string_view(static_cast<spdlog::level::level_enum>(GREAT_LOG_ACTIVE_LEVEL)));
+            }
 
             spdlog::flush_every(std::chrono::seconds(3));
         }
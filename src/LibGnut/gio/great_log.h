@@ -75,6 +75,20 @@ namespace gnut
          */
         std::shared_ptr<spdlog::logger> get_logger();
 
+        /**
+         * @brief logger without the shared_ptr copy (used by the GREAT_* macros)
+         *
+         * @return spdlog::logger*
+         */
+        spdlog::logger* logger()
+        {
+            if (!_gspdlog)
+            {
+                init_logger("", spdlog::level::info);
+            }
+            return _gspdlog.get();
+        }
+
     private:
         /**
          * @brief Construct the t_great_log object
@@ -114,12 +128,52 @@ namespace gnut
 #define PLOG_FUNCTION
 
 #define SPACE_ROW "========================================================="
-#define GREAT_TRACE(...) SPDLOG_LOGGER_CALL(t_great_log::get_instance().get_logger().get(), spdlog::level::trace, __VA_ARGS__)
-#define GREAT_DEBUG(...) SPDLOG_LOGGER_CALL(t_great_log::get_instance().get_logger().get(), spdlog::level::debug, __VA_ARGS__)
-#define GREAT_INFO(...) SPDLOG_LOGGER_CALL(t_great_log::get_instance().get_logger().get(), spdlog::level::info, __VA_ARGS__)
-#define GREAT_WARN(...) SPDLOG_LOGGER_CALL(t_great_log::get_instance().get_logger().get(), spdlog::level::warn, __VA_ARGS__)
-#define GREAT_ERROR(...) SPDLOG_LOGGER_CALL(t_great_log::get_instance().get_logger().get(), spdlog::level::err, __VA_ARGS__)
-#define GREAT_CRITICAL(...) SPDLOG_LOGGER_CALL(t_great_log::get_instance().get_logger().get(), spdlog::level::critical, __VA_ARGS__)
+
+/**
+ * @brief lowest level compiled in (SPDLOG_LEVEL_*)
+ *
+ * Messages below this level are removed by the preprocessor, their arguments are never evaluated.
+ * Release builds (NDEBUG) keep INFO and above, otherwise everything is kept. Can be set by
+ * the GREAT_LOG_ACTIVE_LEVEL cmake option.
+ */
+#ifndef GREAT_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define GREAT_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+#else
+#define GREAT_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+#endif
+
+/**
+ * @brief log if the level is enabled at runtime
+ *
+ * The arguments (string concatenation, time formatting, ...) are evaluated only when the
+ * message is written, so disabled messages cost a single level check.
+ */
+#define GREAT_LOG(level, ...)                                                       \
+    do                                                                              \
+    {                                                                               \
+        spdlog::logger* great_logger_ = t_great_log::get_instance().logger();       \
+        if (great_logger_->should_log(level))                                       \
+        {                                                                           \
+            SPDLOG_LOGGER_CALL(great_logger_, level, __VA_ARGS__);                  \
+        }                                                                           \
+    } while (0)
+
+#if GREAT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_TRACE
+#define GREAT_TRACE(...) GREAT_LOG(spdlog::level::trace, __VA_ARGS__)
+#else
+#define GREAT_TRACE(...) (void)0
+#endif
+#if GREAT_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+#define GREAT_DEBUG(...) GREAT_LOG(spdlog::level::debug, __VA_ARGS__)
+#else
+#define GREAT_DEBUG(...) (void)0
+#endif
+#define GREAT_INFO(...) GREAT_LOG(spdlog::level::info, __VA_ARGS__)
+#define GREAT_WARN(...) GREAT_LOG(spdlog::level::warn, __VA_ARGS__)
+#define GREAT_ERROR(...) GREAT_LOG(spdlog::level::err, __VA_ARGS__)
+#define GREAT_CRITICAL(...) GREAT_LOG(spdlog::level::critical, __VA_ARGS__)
 
     // no line
     // #define PLOG_TRACE(...)       t_tool_log::Instance().getLogger().get()->trace(__VA_ARGS__)
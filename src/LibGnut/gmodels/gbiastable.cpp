@@ -0,0 +1,120 @@
+/**
+ * @file         gbiastable.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Read-only table of resolved code and phase biases
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <algorithm>
+#include "gmodels/gbiastable.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_gbiastable::t_gbiastable()
+    {
+    }
+
+    t_gbiastable::~t_gbiastable()
+    {
+    }
+
+    void t_gbiastable::add(const string& ac, const t_gtime& epo, const string& sat, const t_cell& cell)
+    {
+        auto itAC = _ac_id.find(ac);
+        if (itAC == _ac_id.end())
+        {
+            itAC = _ac_id.insert(make_pair(ac, static_cast<int>(_ac.size()))).first;
+            _ac.push_back(vector<t_interval>());
+        }
+        vector<t_interval>& intervals = _ac[itAC->second];
+        if (intervals.empty() || intervals.back().beg != epo)
+        {
+            intervals.push_back(t_interval());
+            intervals.back().beg = epo;
+        }
+        t_interval& itv = intervals.back();
+
+        auto itSAT = _sat_id.find(sat);
+        if (itSAT == _sat_id.end())
+        {
+            itSAT = _sat_id.insert(make_pair(sat, static_cast<int>(_sat_id.size()))).first;
+        }
+        int id = itSAT->second;
+        if (static_cast<int>(itv.sat_beg.size()) <= id)
+        {
+            itv.sat_beg.resize(_sat_id.size(), -1);
+            itv.sat_num.resize(_sat_id.size(), 0);
+        }
+        if (itv.sat_beg[id] < 0)
+        {
+            itv.sat_beg[id] = itv.cells.size();
+        }
+        itv.cells.push_back(cell);
+        itv.sat_num[id]++;
+    }
+
+    void t_gbiastable::primary(const string& ac)
+    {
+        _primary = ac;
+    }
+
+    const string& t_gbiastable::primary() const
+    {
+        return _primary;
+    }
+
+    const t_gbiastable::t_cell* t_gbiastable::find(const string& ac, const t_gtime& epo, const string& sat, const GOBS& gobs, bool strict) const
+    {
+        auto itAC = _ac_id.find(ac);
+        auto itSAT = _sat_id.find(sat);
+        if (itAC == _ac_id.end() || itSAT == _sat_id.end())
+        {
+            return nullptr;
+        }
+        const vector<t_interval>& intervals = _ac[itAC->second];
+        if (intervals.empty())
+        {
+            return nullptr;
+        }
+
+        // last interval starting not after epo, the first one for earlier epochs
+        auto itEPO = upper_bound(intervals.begin(), intervals.end(), epo,
+                                 [](const t_gtime& t, const t_interval& itv) { return t < itv.beg; });
+        const t_interval& itv = (itEPO == intervals.begin()) ? intervals.front() : *(itEPO - 1);
+
+        const t_cell* cell = _cell(itv, itSAT->second, gobs);
+        if (!cell && strict && gobs == C6X)
+        {
+            cell = _cell(itv, itSAT->second, C6C);
+        }
+        if (cell && strict && (epo < cell->beg || epo > cell->end))
+        {
+            return nullptr;
+        }
+        return cell;
+    }
+
+    const t_gbiastable::t_cell* t_gbiastable::_cell(const t_interval& itv, int sat, const GOBS& gobs) const
+    {
+        if (sat >= static_cast<int>(itv.sat_beg.size()) || itv.sat_beg[sat] < 0)
+        {
+            return nullptr;
+        }
+        const t_cell* cell = &itv.cells[itv.sat_beg[sat]];
+        for (int i = 0; i < itv.sat_num[sat]; i++)
+        {
+            if (cell[i].gobs == gobs)
+            {
+                return &cell[i];
+            }
+        }
+        return nullptr;
+    }
+
+} // namespace gnut
@@ -0,0 +1,103 @@
+/**
+ * @file         gbiastable.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Read-only table of resolved code and phase biases
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GBIASTABLE_H
+#define GBIASTABLE_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "gexport/ExportLibGnut.h"
+#include "gutils/gnss.h"
+#include "gutils/gtime.h"
+
+using namespace std;
+
+namespace gnut
+{
+    /**
+     * @brief read-only table of resolved biases
+     *
+     * Filled once from the t_gallbias container (after the biases are connected to
+     * their reference signals), then only queried. For every AC the validity intervals
+     * start at the epochs of the container; in each interval the biases are stored in
+     * one contiguous array, grouped by satellite (dense ids) and sorted by signal. The
+     * primary AC is fixed when the table is built. The queries modify nothing and need
+     * no lock.
+     */
+    class LibGnut_LIBRARY_EXPORT t_gbiastable
+    {
+    public:
+        /** @brief one resolved bias */
+        struct t_cell
+        {
+            GOBS gobs;    ///< signal of the container key
+            GOBS sig;     ///< signal of the bias (differs from gobs after a connection)
+            GOBS ref;     ///< reference signal
+            double bias;  ///< bias [m]
+            t_gtime beg;  ///< valid from
+            t_gtime end;  ///< valid until
+        };
+
+        /** @brief default constructor. */
+        t_gbiastable();
+
+        /** @brief default destructor. */
+        virtual ~t_gbiastable();
+
+        /**
+         * @brief add a bias (by AC, epochs in increasing order, then by satellite and signal)
+         * @param[in]  ac      analysis center
+         * @param[in]  epo     epoch of the container (start of the interval)
+         * @param[in]  sat     satellite
+         * @param[in]  cell    resolved bias
+         */
+        void add(const string& ac, const t_gtime& epo, const string& sat, const t_cell& cell);
+
+        /** @brief set the primary AC */
+        void primary(const string& ac);
+
+        /** @brief primary AC */
+        const string& primary() const;
+
+        /**
+         * @brief bias of the interval of epo
+         * @param[in]  ac      analysis center
+         * @param[in]  epo     epoch
+         * @param[in]  sat     satellite
+         * @param[in]  gobs    signal
+         * @param[in]  strict  as t_gallbias::_find: C6X falls back to C6C and the bias must be valid at epo
+         * @return  bias or nullptr
+         */
+        const t_cell* find(const string& ac, const t_gtime& epo, const string& sat, const GOBS& gobs, bool strict = true) const;
+
+    protected:
+        /** @brief biases of one interval */
+        struct t_interval
+        {
+            t_gtime beg;          ///< start of the interval
+            vector<int> sat_beg;  ///< first cell of the satellite (-1 none), by satellite id
+            vector<int> sat_num;  ///< number of cells of the satellite, by satellite id
+            vector<t_cell> cells; ///< cells by satellite and signal
+        };
+
+        /** @brief cell of the signal in the interval */
+        const t_cell* _cell(const t_interval& itv, int sat, const GOBS& gobs) const;
+
+        string _primary;                     ///< primary AC
+        unordered_map<string, int> _ac_id;   ///< AC ids
+        unordered_map<string, int> _sat_id;  ///< satellite ids
+        vector<vector<t_interval>> _ac;      ///< intervals by AC id
+    };
+
+} // namespace gnut
+
+#endif
@@ -10,6 +10,7 @@
 #include <stdlib.h>
 #include <iostream>
 #include <iomanip>
+#include <cmath>
 
 #include "gmodels/gpcv.h"
 #include "gutils/gsysconv.h"
@@ -331,11 +332,6 @@ namespace gnut
             return -1;
         }
 
-        map<double, double> mapDataf1;
-        mapDataf1 = _mapzen[f1];
-        map<double, double> mapDataf2;
-        mapDataf2 = _mapzen[f2];
-
         double eleS = satdata.ele();
         double rS = satdata.satcrd().crd_cvect().NormFrobenius();
         double rR = site.crd_cvect().NormFrobenius();
@@ -346,9 +342,7 @@ namespace gnut
         double corrf1 = 0.0;
         double corrf2 = 0.0;
 
-        t_ginterp interp;
-
-        if (interp.linear(mapDataf1, zen, corrf1) < 0 || interp.linear(mapDataf2, zen, corrf2) < 0)
+        if (_interp(f1, zen, 0.0, false, corrf1) < 0 || _interp(f2, zen, 0.0, false, corrf2) < 0)
         {
             _gmutex.unlock();
             return -1;
@@ -429,105 +423,19 @@ namespace gnut
         double corrf1 = 0.0;
         double corrf2 = 0.0;
 
-        if (_azi_dependent(f1) && _azi_dependent(f2))
-        {
-            // AZI-dependant calibration available
-            t_gpair p_az(azi, zen);
-            map<t_gpair, double> mapDataf1;
-            map<t_gpair, double> mapDataf2;
-
-            for (map<GFRQ, t_map_A>::iterator itGFRQ = _mapazi.begin(); itGFRQ != _mapazi.end(); itGFRQ++)
-            {
-                GFRQ f = itGFRQ->first;
-                if (f != f1 && f != f2)
-                {
-                    continue;
-                }
-
-                map<double, t_map_Z>::iterator itA1 = itGFRQ->second.lower_bound(azi);
-                if (itA1 == itGFRQ->second.end() || itA1 == itGFRQ->second.begin())
-                {
-                    _gmutex.unlock();
-                    return -1;
-                }
-                map<double, t_map_Z>::iterator itA2 = itA1;
-                itA2--;
-
-                map<double, double>::iterator itZ1 = itA1->second.lower_bound(zen);
-                if (itZ1 == itA1->second.end() || itZ1 == itA1->second.begin())
-                {
-                    _gmutex.unlock();
-                    return -1;
-                }
-                map<double, double>::iterator itZ2 = itZ1;
-                itZ2--;
-
-                map<double, double>::iterator itZ3 = itA2->second.lower_bound(zen);
-                if (itZ3 == itA2->second.end() || itZ3 == itA2->second.begin())
-                {
-                    _gmutex.unlock();
-                    return -1;
-                }
-                map<double, double>::iterator itZ4 = itZ3;
-                itZ4--;
-
-                t_gpair p1(itA1->first, itZ1->first);
-                t_gpair p2(itA1->first, itZ2->first);
-                t_gpair p3(itA2->first, itZ3->first);
-                t_gpair p4(itA2->first, itZ4->first);
-
-                if (f == f1)
-                {
-                    mapDataf1[p1] = itZ1->second;
-                    mapDataf1[p2] = itZ2->second;
-                    mapDataf1[p3] = itZ3->second;
-                    mapDataf1[p4] = itZ4->second;
-                }
-                else if (f == f2)
-                {
-                    mapDataf2[p1] = itZ1->second;
-                    mapDataf2[p2] = itZ2->second;
-                    mapDataf2[p3] = itZ3->second;
-                    mapDataf2[p4] = itZ4->second;
-                }
-                else
-                {
-                    continue;
-                }
-            }
-
-            t_ginterp interp;
-            if (interp.bilinear(mapDataf1, p_az, corrf1) < 0 || interp.bilinear(mapDataf2, p_az, corrf2) < 0)
-            {
-                _gmutex.unlock();
-                return -1;
-            }
-        }
-        else
+        bool azi_dep = _azi_dependent(f1) && _azi_dependent(f2);
+        if (!azi_dep)
         { // AZI-dependant calibration NOT available (only NOAZI)
-
             if (_gnote)
             {
                 _gnote->mesg(GWARNING, "gpcv", "no REC AZI PCV [" + _anten + "/freq:" + t_gfreq::gfreq2str(f1) + "], just used NOAZI");
             }
+        }
 
-            map<double, double> mapDataf1;
-            map<double, double> mapDataf2;
-
-            if (_mapzen.find(f1) == _mapzen.end() || _mapzen.find(f2) == _mapzen.end())
-            {
-                _gmutex.unlock();
-                return -1;
-            }
-
-            mapDataf1 = _mapzen[f1];
-            mapDataf2 = _mapzen[f2];
-            t_ginterp interp;
-            if (interp.linear(mapDataf1, zen, corrf1) < 0 || interp.linear(mapDataf2, zen, corrf2) < 0)
-            {
-                _gmutex.unlock();
-                return -1;
-            }
+        if (_interp(f1, zen, azi, azi_dep, corrf1) < 0 || _interp(f2, zen, azi, azi_dep, corrf2) < 0)
+        {
+            _gmutex.unlock();
+            return -1;
         }
 
         corrf1 /= 1000.0;
@@ -687,77 +595,9 @@ namespace gnut
         double azi = satdata.azi_sat() * R2D;
 
         double corrf1 = 0.0;
-        if (_azi_dependent(f1))
+        if (_interp(f1, zen, azi, _azi_dependent(f1), corrf1) < 0)
         {
-            t_gpair p_az(azi, zen);
-            map<t_gpair, double> mapDataf1;
-
-            for (map<GFRQ, t_map_A>::iterator itGFRQ = _mapazi.begin(); itGFRQ != _mapazi.end(); itGFRQ++)
-            {
-                GFRQ f = itGFRQ->first;
-
-                if (f != f1)
-                {
-                    continue;
-                }
-
-                map<double, t_map_Z>::iterator itA1 = itGFRQ->second.lower_bound(azi);
-                if (itA1 == itGFRQ->second.end() || itA1 == itGFRQ->second.begin())
-                {
-                    return -1;
-                }
-                map<double, t_map_Z>::iterator itA2 = itA1;
-                itA2--;
-
-                map<double, double>::iterator itZ1 = itA1->second.lower_bound(zen);
-                if (itZ1 == itA1->second.end() || itZ1 == itA1->second.begin())
-                {
-                    return -1;
-                }
-                map<double, double>::iterator itZ2 = itZ1;
-                itZ2--;
-
-                map<double, double>::iterator itZ3 = itA2->second.lower_bound(zen);
-                if (itZ3 == itA2->second.end() || itZ3 == itA2->second.begin())
-                {
-                    return -1;
-                }
-                map<double, double>::iterator itZ4 = itZ3;
-                itZ4--;
-
-                t_gpair p1(itA1->first, itZ1->first);
-                t_gpair p2(itA1->first, itZ2->first);
-                t_gpair p3(itA2->first, itZ3->first);
-                t_gpair p4(itA2->first, itZ4->first);
-
-                if (f == f1)
-                {
-                    mapDataf1[p1] = itZ1->second;
-                    mapDataf1[p2] = itZ2->second;
-                    mapDataf1[p3] = itZ3->second;
-                    mapDataf1[p4] = itZ4->second;
-                }
-                else
-                {
-                    continue;
-                }
-            }
-            t_ginterp interp;
-            if (interp.bilinear(mapDataf1, p_az, corrf1) < 0)
-            {
-                return -1;
-            }
-        }
-        else
-        {
-            map<double, double> mapDataf1;
-            mapDataf1 = _mapzen.at(f1);
-
-            t_ginterp interp;
-            if (interp.linear(mapDataf1, zen, corrf1) < 0)
-            {
-                return -1;
-            }
+            return -1;
         }
 
         corrf1 /= 1000.0;
@@ -810,91 +650,18 @@ namespace gnut
 
         double corrf1 = 0.0;
 
-        if (_azi_dependent(f1))
-        {
-            // AZI-dependant calibration available
-            t_gpair p_az(azi, zen);
-            map<t_gpair, double> mapDataf1;
-            for (map<GFRQ, t_map_A>::iterator itGFRQ = _mapazi.begin(); itGFRQ != _mapazi.end(); itGFRQ++)
-            {
-                GFRQ f = itGFRQ->first;
-
-                if (f != f1)
-                {
-                    continue;
-                }
-
-                map<double, t_map_Z>::iterator itA1 = itGFRQ->second.lower_bound(azi);
-                if (itA1 == itGFRQ->second.end() || itA1 == itGFRQ->second.begin())
-                {
-                    return -1;
-                }
-                map<double, t_map_Z>::iterator itA2 = itA1;
-                itA2--;
-
-                map<double, double>::iterator itZ1 = itA1->second.lower_bound(zen);
-                if (itZ1 == itA1->second.end() || itZ1 == itA1->second.begin())
-                {
-                    return -1;
-                }
-                map<double, double>::iterator itZ2 = itZ1;
-                itZ2--;
-
-                map<double, double>::iterator itZ3 = itA2->second.lower_bound(zen);
-                if (itZ3 == itA2->second.end() || itZ3 == itA2->second.begin())
-                {
-                    return -1;
-                }
-                map<double, double>::iterator itZ4 = itZ3;
-                itZ4--;
-
-                t_gpair p1(itA1->first, itZ1->first);
-                t_gpair p2(itA1->first, itZ2->first);
-                t_gpair p3(itA2->first, itZ3->first);
-                t_gpair p4(itA2->first, itZ4->first);
-
-                if (f == f1)
-                {
-                    mapDataf1[p1] = itZ1->second;
-                    mapDataf1[p2] = itZ2->second;
-                    mapDataf1[p3] = itZ3->second;
-                    mapDataf1[p4] = itZ4->second;
-                }
-                else
-                {
-                    continue;
-                }
-            }
-
-            t_ginterp interp;
-            if (interp.bilinear(mapDataf1, p_az, corrf1) < 0)
-            {
-                return -1;
-            }
-        }
-        else
+        bool azi_dep = _azi_dependent(f1);
+        if (!azi_dep)
         { // AZI-dependant calibration NOT available (only NOAZI)
-
             if (_gnote)
             {
                 _gnote->mesg(GWARNING, "gpcv", "no REC AZI PCV [" + _anten + "/freq:" + t_gfreq::gfreq2str(f1) + "], just used NOAZI");
             }
+        }
 
-            map<double, double> mapDataf1;
-            if (_mapzen.find(f1) != _mapzen.end())
-            {
-                mapDataf1 = _mapzen[f1];
-            }
-            else
-            {
-                return -1;
-            }
-
-            t_ginterp interp;
-            if (interp.linear(mapDataf1, zen, corrf1) < 0)
-            {
-                return -1;
-            }
+        if (_interp(f1, zen, azi, azi_dep, corrf1) < 0)
+        {
+            return -1;
         }
 
         corrf1 /= 1000.0;
@@ -1969,6 +1736,12 @@ namespace gnut
 
     bool t_gpcv::_azi_dependent(GFRQ f)
     {
+        const t_pcvgrid* grid = _grid_of(f);
+        if (grid)
+        {
+            return !grid->azi.empty() && !_pcv_noazi;
+        }
+
         t_map_azi::iterator it = _mapazi.find(f);
 
         bool ret = false;
@@ -1996,4 +1769,214 @@ namespace gnut
         return ret;
     }
 
+    void t_gpcv::compile()
+    {
+        _grid.clear();
+        for (auto itZEN = _mapzen.begin(); itZEN != _mapzen.end(); ++itZEN)
+        {
+            t_pcvgrid grid;
+            grid.frq = itZEN->first;
+            for (auto itZ = itZEN->second.begin(); itZ != itZEN->second.end(); ++itZ)
+            {
+                grid.zen.push_back(itZ->first);
+            }
+            int nz = grid.zen.size();
+            if (nz < 2)
+            {
+                continue;
+            }
+
+            // NOAZI: value and slope of the intervals (the last node has no interval)
+            grid.noazi.assign(2 * nz, 0.0);
+            auto itZ = itZEN->second.begin();
+            for (int iz = 0; iz < nz; iz++, ++itZ)
+            {
+                grid.noazi[2 * iz] = itZ->second;
+                if (iz > 0)
+                {
+                    grid.noazi[2 * iz - 1] = (grid.noazi[2 * iz] - grid.noazi[2 * iz - 2]) / (grid.zen[iz] - grid.zen[iz - 1]);
+                }
+            }
+
+            // AZI: all azimuths must have the zenith nodes of NOAZI
+            auto itAZI = _mapazi.find(grid.frq);
+            bool same_nodes = true;
+            vector<double> vals;
+            if (itAZI != _mapazi.end())
+            {
+                for (auto itA = itAZI->second.begin(); itA != itAZI->second.end() && same_nodes; ++itA)
+                {
+                    same_nodes = (static_cast<int>(itA->second.size()) == nz);
+                    int iz = 0;
+                    for (auto itAZ = itA->second.begin(); same_nodes && itAZ != itA->second.end(); ++itAZ, ++iz)
+                    {
+                        same_nodes = (itAZ->first == grid.zen[iz]);
+                        vals.push_back(itAZ->second);
+                    }
+                    grid.azi.push_back(itA->first);
+                }
+            }
+            if (!same_nodes || grid.azi.size() == 1)
+            {
+                continue;
+            }
+
+            int na = grid.azi.size();
+            if (na > 1)
+            {
+                grid.cell.resize(4 * (na - 1) * (nz - 1));
+                for (int ia = 0; ia < na - 1; ia++)
+                {
+                    double da = grid.azi[ia + 1] - grid.azi[ia];
+                    for (int iz = 0; iz < nz - 1; iz++)
+                    {
+                        double dz = grid.zen[iz + 1] - grid.zen[iz];
+                        double f00 = vals[ia * nz + iz];
+                        double f01 = vals[ia * nz + iz + 1];
+                        double f10 = vals[(ia + 1) * nz + iz];
+                        double f11 = vals[(ia + 1) * nz + iz + 1];
+
+                        double* c = &grid.cell[4 * (ia * (nz - 1) + iz)];
+                        c[0] = f00;
+                        c[1] = (f10 - f00) / da;
+                        c[2] = (f01 - f00) / dz;
+                        c[3] = (f11 - f10 - f01 + f00) / (da * dz);
+                    }
+                }
+            }
+            _grid.push_back(grid);
+        }
+    }
+
+    const t_gpcv::t_pcvgrid* t_gpcv::_grid_of(GFRQ f) const
+    {
+        for (const auto& grid : _grid)
+        {
+            if (grid.frq == f)
+            {
+                return &grid;
+            }
+        }
+        return nullptr;
+    }
+
+    int t_gpcv::_interp(GFRQ f, double zen, double azi, bool azi_dep, double& corr)
+    {
+        const t_pcvgrid* grid = _grid_of(f);
+        if (!grid)
+        {
+            return _interp_map(f, zen, azi, azi_dep, corr);
+        }
+
+        // same cells as the map lower_bound/t_ginterp interpolation (no extrapolation)
+        int nz = grid->zen.size();
+        int iz = _lower(grid->zen, zen);
+        if (azi_dep)
+        {
+            int na = grid->azi.size();
+            int ia = _lower(grid->azi, azi);
+            if (ia == 0 || ia == na || iz == 0 || iz == nz)
+            {
+                return -1;
+            }
+            ia--;
+            iz--;
+
+            const double* c = &grid->cell[4 * (ia * (nz - 1) + iz)];
+            double u = azi - grid->azi[ia];
+            double v = zen - grid->zen[iz];
+            corr = c[0] + c[1] * u + (c[2] + c[3] * u) * v;
+            return 1;
+        }
+
+        if (iz < nz && double_eq(grid->zen[iz], zen))
+        {
+            corr = grid->noazi[2 * iz];
+            return 1;
+        }
+        if (iz == 0 || iz == nz)
+        {
+            return -1;
+        }
+        iz--;
+        corr = grid->noazi[2 * iz] + grid->noazi[2 * iz + 1] * (zen - grid->zen[iz]);
+        return 1;
+    }
+
+    int t_gpcv::_interp_map(GFRQ f, double zen, double azi, bool azi_dep, double& corr)
+    {
+        t_ginterp interp;
+        if (!azi_dep)
+        {
+            t_map_zen::iterator itZEN = _mapzen.find(f);
+            if (itZEN == _mapzen.end() || interp.linear(itZEN->second, zen, corr) < 0)
+            {
+                return -1;
+            }
+            return 1;
+        }
+
+        t_map_azi::iterator itGFRQ = _mapazi.find(f);
+        if (itGFRQ == _mapazi.end())
+        {
+            return -1;
+        }
+
+        map<double, t_map_Z>::iterator itA1 = itGFRQ->second.lower_bound(azi);
+        if (itA1 == itGFRQ->second.end() || itA1 == itGFRQ->second.begin())
+        {
+            return -1;
+        }
+        map<double, t_map_Z>::iterator itA2 = itA1;
+        itA2--;
+
+        map<double, double>::iterator itZ1 = itA1->second.lower_bound(zen);
+        if (itZ1 == itA1->second.end() || itZ1 == itA1->second.begin())
+        {
+            return -1;
+        }
+        map<double, double>::iterator itZ2 = itZ1;
+        itZ2--;
+
+        map<double, double>::iterator itZ3 = itA2->second.lower_bound(zen);
+        if (itZ3 == itA2->second.end() || itZ3 == itA2->second.begin())
+        {
+            return -1;
+        }
+        map<double, double>::iterator itZ4 = itZ3;
+        itZ4--;
+
+        map<t_gpair, double> mapData;
+        mapData[t_gpair(itA1->first, itZ1->first)] = itZ1->second;
+        mapData[t_gpair(itA1->first, itZ2->first)] = itZ2->second;
+        mapData[t_gpair(itA2->first, itZ3->first)] = itZ3->second;
+        mapData[t_gpair(itA2->first, itZ4->first)] = itZ4->second;
+
+        if (interp.bilinear(mapData, t_gpair(azi, zen), corr) < 0)
+        {
+            return -1;
+        }
+        return 1;
+    }
+
+    int t_gpcv::_lower(const vector<double>& nodes, double x)
+    {
+        int n = nodes.size();
+        if (std::isnan(x))
+        {
+            return 0;
+        }
+        int k = static_cast<int>(ceil((x - nodes[0]) / (nodes[n - 1] - nodes[0]) * (n - 1)));
+        k = max(0, min(n, k));
+        while (k > 0 && nodes[k - 1] >= x)
+        {
+            k--;
+        }
+        while (k < n && nodes[k] < x)
+        {
+            k++;
+        }
+        return k;
+    }
+
 } // namespace gnut
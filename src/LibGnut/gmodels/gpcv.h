@@ -283,6 +283,7 @@ namespace gnut
         void pcvzen(GFRQ f, const t_map_Z& t)
         {
             _mapzen[f] = t;
+            _grid.clear();
         }
         t_map_Z pcvzen(GFRQ f)
         {
@@ -297,6 +298,7 @@ namespace gnut
         void pcvazi(GFRQ f, const t_map_A& t)
         {
             _mapazi[f] = t;
+            _grid.clear();
         }
         t_map_A pcvazi(GFRQ f)
         {
@@ -311,10 +313,40 @@ namespace gnut
             _pcv_noazi = b;
         }
 
+        /**
+         * @brief compile the PCV maps into regular grid tables (called when the antenna is complete)
+         *
+         * Frequencies whose nodes are not regular (or not complete) are left to the maps.
+         * The setters of the maps discard the tables.
+         */
+        void compile();
+
     private:
+        /** @brief PCV of one frequency on the regular grid */
+        struct t_pcvgrid
+        {
+            GFRQ frq;              ///< frequency
+            vector<double> zen;    ///< zenith (nadir) nodes [deg]
+            vector<double> azi;    ///< azimuth nodes [deg] (empty if NOAZI only)
+            vector<double> noazi;  ///< NOAZI: value and slope of each zenith interval [mm, mm/deg]
+            vector<double> cell;   ///< AZI: bilinear coefficients of each azimuth/zenith cell (4 per cell) [mm]
+        };
+
         /** @brief Does the calibration contain azi-depenedant data. */
         bool _azi_dependent(GFRQ f);
 
+        /** @brief compiled table of the frequency (nullptr if not compiled) */
+        const t_pcvgrid* _grid_of(GFRQ f) const;
+
+        /** @brief interpolated PCV [mm] of the frequency (AZI-dependent or NOAZI values) */
+        int _interp(GFRQ f, double zen, double azi, bool azi_dep, double& corr);
+
+        /** @brief interpolated PCV [mm] from the maps (not compiled frequencies) */
+        int _interp_map(GFRQ f, double zen, double azi, bool azi_dep, double& corr);
+
+        /** @brief index of the first node not before x (nodes of a regular grid) */
+        static int _lower(const vector<double>& nodes, double x);
+
         t_gephplan _ephplan;
 
         bool _trans;   ///< transmitter[true], receiver[false]
@@ -335,6 +367,7 @@ namespace gnut
         t_map_pco _mappco; ///< map of PCOs (all frequencies)
         t_map_zen _mapzen; ///< map of NOAZI values (all frequencies)
         t_map_azi _mapazi; ///< map of AZI-dep values (all frequencies)
+        vector<t_pcvgrid> _grid; ///< compiled tables (all frequencies)
 
         bool _pcv_noazi;
     };
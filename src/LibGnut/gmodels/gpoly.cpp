@@ -316,8 +316,8 @@ namespace gnut
         {
             throw "interpolate order too big!!";
         }
-        static bool first = true;
-        static double coeff[maxorder][maxorder];
+        thread_local bool first = true;
+        thread_local double coeff[maxorder][maxorder];
         // temp down
         if (first)
         {
@@ -39,6 +39,7 @@ namespace gnut
         }
 
         _maxres_norm = dynamic_cast<t_gsetproc*>(_settings)->max_res_norm();
+        _isFLT = (dynamic_cast<t_gsetgen*>(_settings)->estimator() == "FLT");
         _tropo_mf = dynamic_cast<t_gsetproc*>(_settings)->tropo_mf();
         _trpModStr = dynamic_cast<t_gsetproc*>(_settings)->tropo_model();
         _resid_type = dynamic_cast<t_gsetproc*>(_settings)->residuals();
@@ -127,9 +128,7 @@ namespace gnut
     {
         // Cartesian coordinates to ellipsodial coordinates
         t_gtriple xyz, ell;
-        string strEst = dynamic_cast<t_gsetgen*>(_settings)->estimator();
-        bool isFLT = (strEst == "FLT");
-        if (isFLT)
+        if (_isFLT)
         {
             if (param.getCrdParam(_site, xyz) < 0)
             {
@@ -586,11 +585,15 @@ namespace gnut
             resType = "All residual";
         }
 
-        ostringstream os;
-        os << _site << " outlier (" << resType << ": " << obsType << ") " << prn << " size:" << fixed << setw(2) << data_size
-           << " v: " << fixed << setw(16) << right << setprecision(3) << maxres << " ele: " << fixed << setw(6) << setprecision(2) << ele
-           << " " << epo.str_hms();
-        GREAT_DEBUG(os.str());
+        GREAT_DEBUG("{} outlier ({}: {}) {} size:{:2d} v: {:>16.3f} ele: {:6.2f} {}",
+                    _site,
+                    resType,
+                    obsType,
+                    prn,
+                    data_size,
+                    maxres,
+                    ele,
+                    epo.str_hms());
     }
 
 } // namespace gnut
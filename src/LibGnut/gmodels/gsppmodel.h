@@ -99,6 +99,7 @@ namespace gnut
         map<GSYS, double> _maxres_C;                    ///< code maximal residual
         map<GSYS, double> _maxres_L;                    ///< phase maximal residual
         double _maxres_norm;                            ///< normal maximal residual
+        bool _isFLT = false;                            ///< filter estimator (crd from parameters)
         shared_ptr<t_gobj> _grec;                       ///< grec
         TROPMODEL _trpModStr;                           ///< trop mod(str)
         ZTDMPFUNC _tropo_mf;                            ///< trop mf
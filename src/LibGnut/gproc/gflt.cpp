@@ -12,6 +12,7 @@
 #include <cmath>
 #include <iostream>
 #include <chrono>
+#include <algorithm>
 
 #include "gproc/gflt.h"
 #include "gutils/gmatrixconv.h"
@@ -204,6 +205,28 @@ namespace gnut
         return res;
     }
 
+    void t_gflt::update(const vector<vector<pair<int, double>>>& B,
+                        const vector<double>& P,
+                        const vector<double>& l,
+                        ColumnVector& dx,
+                        SymmetricMatrix& Qx)
+    {
+        Matrix A(B.size(), Qx.Nrows());
+        DiagonalMatrix Pl(P.size());
+        ColumnVector ll(l.size());
+        A = 0.0;
+        for (unsigned int row = 0; row < B.size(); row++)
+        {
+            for (const auto& coeff : B[row])
+            {
+                A(row + 1, coeff.first) = coeff.second;
+            }
+            Pl(row + 1) = P[row];
+            ll(row + 1) = l[row];
+        }
+        update(A, Pl, ll, dx, Qx);
+    }
+
     void t_gflt::resetQ()
     {
         _Qx = _Qx0;
@@ -247,6 +270,73 @@ namespace gnut
         Qx << I_KA * Qx * I_KA.t() + K * Pli * K.t(); // update variance-covariance matrix of state
     }
 
+    void t_kalman::update(const vector<vector<pair<int, double>>>& B,
+                          const vector<double>& P,
+                          const vector<double>& l,
+                          ColumnVector& dx,
+                          SymmetricMatrix& Qx)
+    {
+        int n = Qx.Nrows();
+        dx.ReSize(n);
+        dx = 0.0;
+
+        // lower triangle stored by rows: (i,j), i >= j at i*(i+1)/2 + j
+        Real* q = Qx.Store();
+        Real* x = dx.Store();
+        vector<double> u(n);
+
+        for (unsigned int iobs = 0; iobs < B.size(); iobs++)
+        {
+            const vector<pair<int, double>>& h = B[iobs];
+            if (h.empty() || P[iobs] <= 0.0)
+            {
+                continue;
+            }
+
+            // u = Q * h'
+            fill(u.begin(), u.end(), 0.0);
+            for (const auto& coeff : h)
+            {
+                int k = coeff.first - 1;
+                const Real* qk = q + k * (k + 1) / 2;
+                for (int j = 0; j < k; j++)
+                {
+                    u[j] += qk[j] * coeff.second;
+                }
+                for (int j = k; j < n; j++)
+                {
+                    u[j] += q[j * (j + 1) / 2 + k] * coeff.second;
+                }
+            }
+
+            // innovation and its variance
+            double s = 1.0 / P[iobs];
+            double v = l[iobs];
+            for (const auto& coeff : h)
+            {
+                s += coeff.second * u[coeff.first - 1];
+                v -= coeff.second * x[coeff.first - 1];
+            }
+            if (!(s > 0.0))
+            {
+                throw NPDException(Qx);
+            }
+
+            // x += u * v / s, Q -= u * u' / s
+            double vs = v / s;
+            for (int i = 0; i < n; i++)
+            {
+                x[i] += u[i] * vs;
+                double ui = u[i] / s;
+                Real* qi = q + i * (i + 1) / 2;
+                for (int j = 0; j <= i; j++)
+                {
+                    qi[j] -= ui * u[j];
+                }
+            }
+        }
+    }
+
     void t_SRF::update()
     {
         t_SRF::update(_A, _P, _l, _dx, _Qx);
@@ -342,6 +432,85 @@ namespace gnut
         Qx << (SS.t() * SS);
     }
 
+    void t_SRF::update(const vector<vector<pair<int, double>>>& B,
+                       const vector<double>& P,
+                       const vector<double>& l,
+                       ColumnVector& dx,
+                       SymmetricMatrix& Qx)
+    {
+        int n = Qx.Nrows();
+        dx.ReSize(n);
+        dx = 0.0;
+
+        // Q = W * W', W starts lower triangular and becomes a general square root
+        // (NPDException is passed to the caller as by t_kalman)
+        Matrix W = Cholesky(Qx);
+
+        Real* w = W.Store();
+        Real* x = dx.Store();
+        vector<double> f(n), g(n);
+
+        for (unsigned int iobs = 0; iobs < B.size(); iobs++)
+        {
+            const vector<pair<int, double>>& h = B[iobs];
+            if (h.empty() || P[iobs] <= 0.0)
+            {
+                continue;
+            }
+
+            // f = W' * h'
+            fill(f.begin(), f.end(), 0.0);
+            for (const auto& coeff : h)
+            {
+                const Real* wk = w + (coeff.first - 1) * n;
+                for (int j = 0; j < n; j++)
+                {
+                    f[j] += wk[j] * coeff.second;
+                }
+            }
+
+            double r = 1.0 / P[iobs];
+            double alpha = r;
+            for (int j = 0; j < n; j++)
+            {
+                alpha += f[j] * f[j];
+            }
+
+            // g = W * f (gain direction)
+            for (int i = 0; i < n; i++)
+            {
+                const Real* wi = w + i * n;
+                double gi = 0.0;
+                for (int j = 0; j < n; j++)
+                {
+                    gi += wi[j] * f[j];
+                }
+                g[i] = gi;
+            }
+
+            double v = l[iobs];
+            for (const auto& coeff : h)
+            {
+                v -= coeff.second * x[coeff.first - 1];
+            }
+
+            // x += g * v / alpha, W -= gamma * g * f'
+            double gamma = 1.0 / (alpha + sqrt(r * alpha));
+            for (int i = 0; i < n; i++)
+            {
+                x[i] += g[i] * v / alpha;
+                Real* wi = w + i * n;
+                double gg = gamma * g[i];
+                for (int j = 0; j < n; j++)
+                {
+                    wi[j] -= gg * f[j];
+                }
+            }
+        }
+
+        Qx << W * W.t();
+    }
+
     void t_SRIF::update(const Matrix& A, const DiagonalMatrix& Pl, const ColumnVector& l, ColumnVector& dx, SymmetricMatrix& Qx)
     {
         int nObs = A.Nrows();
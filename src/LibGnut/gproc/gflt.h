@@ -19,6 +19,7 @@
 #ifndef FLT_H
 #define FLT_H
 
+#include <vector>
 #include "newmat/newmat.h"
 #include "newmat/newmatap.h"
 #include "gall/gallpar.h"
@@ -67,6 +68,24 @@ namespace gnut
          */
         virtual void update(const Matrix& A, const SymmetricMatrix& P, const ColumnVector& l, ColumnVector& dx, SymmetricMatrix& Q) {};
 
+        /**
+         * @brief update parametere by uncorrelated observations with sparse design rows.
+         *
+         * Default: expanded to dense A and diagonal P.
+         *
+         * @param[in]  B        rows of A as (parameter index from 1, coefficient)
+         * @param[in]  P        weights (diagonal of P)
+         * @param[in]  l        l vector
+         * @param[out] dx       dx matrix in flt
+         * @param[in,out] Q     Q matrix in flt
+         * @return void
+         */
+        virtual void update(const vector<vector<pair<int, double>>>& B,
+                            const vector<double>& P,
+                            const vector<double>& l,
+                            ColumnVector& dx,
+                            SymmetricMatrix& Q);
+
         /**
          * @brief add data.
          *
@@ -254,6 +273,18 @@ namespace gnut
         virtual void update();
         void update(const Matrix& A, const DiagonalMatrix& P, const ColumnVector& l, ColumnVector& dx, SymmetricMatrix& Q);
         void update(const Matrix& A, const SymmetricMatrix& P, const ColumnVector& l, ColumnVector& dx, SymmetricMatrix& Q);
+
+        /**
+         * @brief sequential update, one scalar observation after another.
+         *
+         * Each observation costs O(n * nnz) for Q*h and O(n^2/2) for the rank-one
+         * update of the lower triangle of Q, no matrix is inverted.
+         */
+        void update(const vector<vector<pair<int, double>>>& B,
+                    const vector<double>& P,
+                    const vector<double>& l,
+                    ColumnVector& dx,
+                    SymmetricMatrix& Q) override;
     };
 
     /** @brief class for Square root covariance filter derive from t_gflt. */
@@ -292,6 +323,19 @@ namespace gnut
          * @return void
          */
         void update(const Matrix& A, const SymmetricMatrix& P, const ColumnVector& l, ColumnVector& dx, SymmetricMatrix& Q);
+
+        /**
+         * @brief sequential square root update (Potter), one scalar observation after another.
+         *
+         * The square root of Q is updated by O(n^2) per observation instead of the
+         * QR decomposition of the (nObs + nPar) square array. Throws NPDException
+         * when Q is not positive definite, Q is then unchanged.
+         */
+        void update(const vector<vector<pair<int, double>>>& B,
+                    const vector<double>& P,
+                    const vector<double>& l,
+                    ColumnVector& dx,
+                    SymmetricMatrix& Q) override;
     };
 
     /** @brief class for Square root information filter derive from t_gflt. */
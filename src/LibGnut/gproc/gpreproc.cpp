@@ -672,7 +672,7 @@ namespace gnut
 
         if (bands_t1.size() <= 1)
         {
-            GREAT_DEBUG(gobs1->epoch().str_ymdhms("Not enough bands available: ") + " " + gobs1->sat());
+            GREAT_DEBUG("{} {}", gobs1->epoch().str_ymdhms("Not enough bands available: "), gobs1->sat());
             return -1;
         }
 
@@ -19,6 +19,7 @@ namespace gnut
     t_gsppflt::t_gsppflt(string mark, t_gsetbase* set) :
         t_gspp(mark, set),
         _minsat(static_cast<size_t>(SPP_MINSAT)),
+        _Qslot(_Qx),
         _filter(0),
         _smooth(false),
         _n_NPD_flt(0),
@@ -148,6 +149,7 @@ namespace gnut
     t_gsppflt::t_gsppflt(string mark, t_gsetbase* set, string mode) :
         t_gspp(mark, set, mode),
         _minsat(static_cast<size_t>(SPP_MINSAT)),
+        _Qslot(_Qx),
         _filter(0),
         _smooth(false),
         _n_NPD_flt(0),
@@ -378,12 +380,11 @@ namespace gnut
             }
 
             // clean/collect/filter epoch data
-            _data.erase(_data.begin(), _data.end());
-            _data = _gobs->obs(_site, now);
+            _gobs->obs(_site, now, _data);
 
             if (_data.size() == 0)
             {
-                GREAT_DEBUG(_site + now.str_ymdhms(" no observation found at epoch: "));
+                GREAT_DEBUG("{}{}", _site, now.str_ymdhms(" no observation found at epoch: "));
                 if (_sampling > 1)
                 {
                     now.add_secs(int(sign * _sampling)); // =<1Hz data
@@ -403,7 +404,7 @@ namespace gnut
             if (irc_epo < 0)
             {
                 _success = false;
-                GREAT_DEBUG(_site + now.str_ymdhms(" epoch ") + " was not calculated");
+                GREAT_DEBUG("{}{} was not calculated", _site, now.str_ymdhms(" epoch "));
 
                 if (_sampling > 1)
                 {
@@ -420,11 +421,11 @@ namespace gnut
                 _success = true;
             }
 
-            GREAT_DEBUG(_site + now.str_ymdhms(" processing epoch: "));
+            GREAT_DEBUG("{}{}", _site, now.str_ymdhms(" processing epoch: "));
 
             if (_param.getCrdParam(_site, xyz) <= 0)
             {
-                GREAT_DEBUG(_site + now.str_ymdhms(" No coordinates included in params: "));
+                GREAT_DEBUG("{}{}", _site, now.str_ymdhms(" No coordinates included in params: "));
             }
 
             _map_crd[obsEpo] = xyz;
@@ -709,7 +710,7 @@ namespace gnut
 
         if (_data.size() < _minsat)
         {
-            GREAT_DEBUG(_site + _epoch.str_ymdhms(" epoch ") + " skipped: " + int2str(_data.size()) + " < _minsat)");
+            GREAT_DEBUG("{}{} skipped: {} < _minsat)", _site, _epoch.str_ymdhms(" epoch "), _data.size());
             _restore(QsavBP, XsavBP);
             return -1;
         }
@@ -1261,8 +1262,7 @@ namespace gnut
 
         if (_data.size() < _minsat)
         {
-            GREAT_DEBUG(_epoch.str_ymdhms(_site + " epoch ") + " skipped (Bancroft not calculated: " + int2str(_data.size()) +
-                        " < _minsat)");
+            GREAT_DEBUG("{} skipped (Bancroft not calculated: {} < _minsat)", _epoch.str_ymdhms(_site + " epoch "), _data.size());
             return -1;
         }
 
@@ -1270,7 +1270,7 @@ namespace gnut
 
         if (BB.Nrows() < static_cast<int>(_minsat))
         {
-            GREAT_DEBUG(_epoch.str_ymdhms(_site + " epoch ") + " skipped (Bancroft not calculated: BB.Nrows < _minsat)");
+            GREAT_DEBUG("{} skipped (Bancroft not calculated: BB.Nrows < _minsat)", _epoch.str_ymdhms(_site + " epoch "));
             return -1;
         }
 
@@ -1297,8 +1297,8 @@ namespace gnut
         {
             string warning =
                 "WARNING: Unexpected site (" + _site + ") coordinates from Bancroft. Orbits/clocks or code observations should be checked.";
-            GREAT_DEBUG(warning + _epoch.str_ymdhms(" Epoch "));
-            GREAT_DEBUG(warning + _epoch.str_ymdhms(" Epoch "));
+            GREAT_DEBUG("{}{}", warning, _epoch.str_ymdhms(" Epoch "));
+            GREAT_DEBUG("{}{}", warning, _epoch.str_ymdhms(" Epoch "));
             if (!_phase)
             {
                 return -1;
@@ -1389,36 +1389,31 @@ namespace gnut
             // check elevation cut-off
             if (iter->ele_deg() < _minElev)
             {
-                ostringstream os;
-                os << "Erasing " << iter->sat() << " data due to low elevation angle (ele = " << fixed << setprecision(1) << iter->ele_deg()
-                   << ") " << iter->epoch().str_ymdhms();
-                GREAT_DEBUG(os.str());
+                GREAT_DEBUG("Erasing {} data due to low elevation angle (ele = {:.1f}) {}", iter->sat(), iter->ele_deg(), iter->epoch().str_ymdhms());
                 iter = _data.erase(iter); // !!!! zveda iterator !!!!
                 if (_data.size() < _minsat)
                 {
-                    GREAT_DEBUG(_site + _epoch.str_ymdhms(" epoch ") + int2str(_data.size()) + " skipped (data.size < _minsat)");
+                    GREAT_DEBUG("{}{}{} skipped (data.size < _minsat)", _site, _epoch.str_ymdhms(" epoch "), _data.size());
                     return -1;
                 }
                 continue;
             }
 
             // Printing beta and orbit angles for deep verbosity
-            ostringstream os;
-            os << iter->sat() << " " << iter->epoch().str_ymdhms() << " " << fixed << setprecision(1) << iter->beta() << " "
-               << iter->orb_angle() << endl;
-            GREAT_DEBUG(os.str());
+            GREAT_DEBUG("{} {} {:.1f} {:.1f}", iter->sat(), iter->epoch().str_ymdhms(), iter->beta(), iter->orb_angle());
 
             // check satellite eclipsing
             if (iter->ecl())
             {
-                ostringstream os;
-                os << "Erasing " << iter->sat() << " data due to satellite eclipsing (beta = " << fixed << setprecision(1) << iter->beta()
-                   << " ,orbit angle = " << iter->orb_angle() << ") " << iter->epoch().str_ymdhms();
-                GREAT_DEBUG(os.str());
+                GREAT_DEBUG("Erasing {} data due to satellite eclipsing (beta = {:.1f} ,orbit angle = {:.1f}) {}",
+                            iter->sat(),
+                            iter->beta(),
+                            iter->orb_angle(),
+                            iter->epoch().str_ymdhms());
                 iter = _data.erase(iter); // !!!! zveda iterator !!!!
                 if (_data.size() < _minsat)
                 {
-                    GREAT_DEBUG(_site + _epoch.str_ymdhms(" epoch ") + int2str(_data.size()) + " skipped (data.size < _minsat)");
+                    GREAT_DEBUG("{}{}{} skipped (data.size < _minsat)", _site, _epoch.str_ymdhms(" epoch "), _data.size());
                     return -1;
                 }
             }
@@ -1449,6 +1444,9 @@ namespace gnut
             _syncIFB();
         }
 
+        // parameters added/removed above, compacted once
+        _Qslot.commit();
+
         _Noise.ReSize(_Qx.Nrows());
         _Noise = 0;
 
@@ -1831,7 +1829,6 @@ namespace gnut
         string satname = gsatdata.sat();
 
         int i;
-        int base_size = dynamic_cast<t_gsetgen*>(_set)->list_base().size();
         i = gsatdata.addprd(_gnav); // add sat crd and clk
 
         if (i < 0)
@@ -1987,8 +1984,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::GLO_ISB, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_glo * _sig_init_glo;
+            _Qslot.add(_sig_init_glo * _sig_init_glo);
         }
 
         // Add GAL ISB parameter
@@ -1997,8 +1993,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::GAL_ISB, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_gal * _sig_init_gal;
+            _Qslot.add(_sig_init_gal * _sig_init_gal);
         }
 
         // Add BDS ISB parameter
@@ -2007,8 +2002,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::BDS_ISB, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_bds * _sig_init_bds;
+            _Qslot.add(_sig_init_bds * _sig_init_bds);
         }
 
         // Add QZS ISB parameter
@@ -2017,15 +2011,14 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::QZS_ISB, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_qzs * _sig_init_qzs;
+            _Qslot.add(_sig_init_qzs * _sig_init_qzs);
         }
 
         // Remove GLO ISB paremeter
         if (parGlo && !obsGlo)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::GLO_ISB, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2034,7 +2027,7 @@ namespace gnut
         if (parGal && !obsGal)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::GAL_ISB, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2043,7 +2036,7 @@ namespace gnut
         if (parBds && !obsBds)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::BDS_ISB, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2052,7 +2045,7 @@ namespace gnut
         if (parQzs && !obsQzs)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::QZS_ISB, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2086,8 +2079,7 @@ namespace gnut
                     parSION.value(0.0);
 
                     _param.addParam(parSION);
-                    Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-                    _Qx(_param.parNumber(), _param.parNumber()) = _sig_init_vion * _sig_init_vion;
+                    _Qslot.add(_sig_init_vion * _sig_init_vion);
                 }
             }
 
@@ -2103,7 +2095,7 @@ namespace gnut
                 set<string>::iterator prnITER = mapPRN.find(sat);
                 if (prnITER == mapPRN.end())
                 {
-                    Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+                    _Qslot.remove(_param[i].index);
                     _param.delParam(i);
                     _param.reIndex();
                     i--;
@@ -2123,7 +2115,7 @@ namespace gnut
                 set<string>::iterator prnITER = mapPRN.find(sat);
                 if (prnITER == mapPRN.end())
                 {
-                    Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+                    _Qslot.remove(_param[i].index);
                     _param.delParam(i);
                     _param.reIndex();
                     i--;
@@ -2277,8 +2269,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_GPS, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000;
+            _Qslot.add(3000.0 * 3000);
         }
 
         // Add GAL IFB parameter
@@ -2287,8 +2278,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_GAL, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000;
+            _Qslot.add(3000.0 * 3000);
         }
 
         // Add BDS IFB parameter
@@ -2297,8 +2287,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_BDS, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000 * 3000;
+            _Qslot.add(3000 * 3000);
         }
 
         // Add QZS IFB parameter
@@ -2307,8 +2296,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_QZS, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000;
+            _Qslot.add(3000.0 * 3000);
         }
 
         // Add GAL IFB_2 parameter
@@ -2317,8 +2305,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_GAL_2, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000;
+            _Qslot.add(3000.0 * 3000);
         }
 
         // Add GAL IFB_3 parameter
@@ -2327,8 +2314,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_GAL_3, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000.0 * 3000;
+            _Qslot.add(3000.0 * 3000);
         }
 
         // Add BDS IFB_2 parameter
@@ -2337,8 +2323,7 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_BDS_2, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000 * 3000;
+            _Qslot.add(3000 * 3000);
         }
 
         // Add BDS IFB_3 parameter
@@ -2347,15 +2332,14 @@ namespace gnut
             t_gpar newPar(_data.begin()->site(), par_type::IFB_BDS_3, _param.parNumber() + 1, "");
             newPar.value(0.0);
             _param.addParam(newPar);
-            Matrix_addRC(_Qx, _param.parNumber(), _param.parNumber());
-            _Qx(_param.parNumber(), _param.parNumber()) = 3000 * 3000;
+            _Qslot.add(3000 * 3000);
         }
 
         // Remove GPS IFB paremeter
         if (parGps && !obsGps)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::IFB_GPS, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2364,7 +2348,7 @@ namespace gnut
         if (parGal && !obsGal)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::IFB_GAL, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2373,7 +2357,7 @@ namespace gnut
         if (parBds && !obsBds)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::IFB_BDS, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2382,7 +2366,7 @@ namespace gnut
         if (parQzs && !obsQzs)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::IFB_QZS, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2391,7 +2375,7 @@ namespace gnut
         if (parGal_2 && !obsGal_4)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::IFB_GAL_2, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2400,7 +2384,7 @@ namespace gnut
         if (parGal_3 && !obsGal_5)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::IFB_GAL_3, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2409,7 +2393,7 @@ namespace gnut
         if (parBds_2 && !obsBds_4)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::IFB_BDS_2, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
@@ -2418,7 +2402,7 @@ namespace gnut
         if (parBds_3 && !obsBds_5)
         {
             int i = _param.getParam(_data.begin()->site(), par_type::IFB_BDS_3, "");
-            Matrix_remRC(_Qx, _param[i].index, _param[i].index);
+            _Qslot.remove(_param[i].index);
             _param.delParam(i);
             _param.reIndex();
         }
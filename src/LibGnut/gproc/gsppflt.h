@@ -28,6 +28,7 @@
 #include "gutils/gsysconv.h"
 #include "gmodels/gstochasticmodel.h"
 #include "gset/gsetflt.h"
+#include "gutils/gslotcov.h"
 
 namespace gnut
 {
@@ -132,6 +133,7 @@ namespace gnut
 
         t_gallpar _param;
         SymmetricMatrix _Qx;     ///< Parameters and covariance matrix
+        t_gslotcov _Qslot;       ///< slots of _Qx for adding/removing parameters, committed after the synchronization
         DiagonalMatrix _Noise;   ///< Noise matrix
         t_gtime _epoch;          ///< Epoch time
         t_gflt* _filter;         ///< Estimation objects
@@ -72,7 +72,9 @@ namespace gnut
     t_gsetout::t_gsetout() :
         t_gsetbase(),
         _append(false),
-        _verb(0)
+        _verb(0),
+        _buffer(256),
+        _flush(1.0)
     {
         _set.insert(XMLKEY_OUT);
     }
@@ -111,6 +113,36 @@ namespace gnut
         return tmp;
     }
 
+    int t_gsetout::buffer_size()
+    {
+        _gmutex.lock();
+
+        xml_attribute attr = _doc.child(XMLKEY_ROOT).child(XMLKEY_OUT).attribute("buffer");
+        int tmp = attr ? attr.as_int() : _buffer;
+        if (tmp < 1)
+        {
+            tmp = 1;
+        }
+
+        _gmutex.unlock();
+        return tmp * 1024;
+    }
+
+    double t_gsetout::flush_interval()
+    {
+        _gmutex.lock();
+
+        xml_attribute attr = _doc.child(XMLKEY_ROOT).child(XMLKEY_OUT).attribute("flush");
+        double tmp = attr ? attr.as_double() : _flush;
+        if (tmp < 0.0)
+        {
+            tmp = 0.0;
+        }
+
+        _gmutex.unlock();
+        return tmp;
+    }
+
     string t_gsetout::outputs(const string& fmt)
     {
         _gmutex.lock();
@@ -310,10 +342,16 @@ namespace gnut
     {
         _gmutex.lock();
 
-        cerr << " <outputs append=\"" << _append << "\" verb=\"" << _verb << "\" >\n"
+        cerr << " <outputs append=\"" << _append << "\" verb=\"" << _verb << "\" buffer=\"" << _buffer << "\" flush=\"" << _flush
+             << "\" >\n"
              << "   <flt> file://dir/name </flt>    \t\t <!-- filter output encoder -->\n"
              << " </outputs>\n";
 
+        cerr << "\t<!-- outputs description:\n"
+             << "\t buffer  .. size of the output buffers [kB]\n"
+             << "\t flush   .. maximum time the records wait in the buffers [s]\n"
+             << "\t -->\n\n";
+
         _gmutex.unlock();
         return;
     }
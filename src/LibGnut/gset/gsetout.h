@@ -91,6 +91,18 @@ namespace gnut
          */
         bool append();
 
+        /**
+         * @brief  get size of the output buffers
+         * @return int : buffer size [bytes]
+         */
+        int buffer_size();
+
+        /**
+         * @brief  get maximum time the records wait in the output buffers
+         * @return double : flush interval [s]
+         */
+        double flush_interval();
+
         // elements
         /**
          * @brief  get format output size
@@ -156,6 +168,8 @@ namespace gnut
         set<OFMT> _OFMT_supported; ///< vector of supported OFMTs (app-specific)
         bool _append;              ///< append mode
         int _verb;                 ///< output verbosity
+        int _buffer;               ///< output buffer size [kB]
+        double _flush;             ///< output flush interval [s]
 
     private:
     };
@@ -65,6 +65,10 @@ namespace gnut
         _sd_sat = false;
         _basepos = BASEPOS::SPP;
         _minsat = static_cast<size_t>(6);
+        _num_threads = 1;
+        _obs_store = "MAP";
+        _stream_speed = 0.0;
+        _eop_accuracy = 1e-11;
 
         _meanpolemodel = modeofmeanpole::cubic;
     }
@@ -438,6 +442,97 @@ namespace gnut
         return tmp_int;
     }
 
+    int t_gsetproc::num_threads()
+    {
+        _gmutex.lock();
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_PROC).child_value("num_threads");
+        str_erase(tmp);
+        int tmp_int;
+        if (tmp != "")
+        {
+            tmp_int = std::stoi(tmp);
+        }
+        else
+        {
+            tmp_int = _num_threads;
+        }
+        if (tmp_int < 1)
+        {
+            tmp_int = 1;
+        }
+        _gmutex.unlock();
+        return tmp_int;
+    }
+
+    string t_gsetproc::obs_store()
+    {
+        _gmutex.lock();
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_PROC).child_value("obs_store");
+        str_erase(tmp);
+        transform(tmp.begin(), tmp.end(), tmp.begin(), ::toupper);
+        if (tmp != "COLUMNAR")
+        {
+            tmp = _obs_store;
+        }
+        _gmutex.unlock();
+        return tmp;
+    }
+
+    bool t_gsetproc::stream()
+    {
+        _gmutex.lock();
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_PROC).child_value("stream");
+        str_erase(tmp);
+        transform(tmp.begin(), tmp.end(), tmp.begin(), ::toupper);
+        bool tmp_bool = (tmp == "TRUE" ? true : false);
+        _gmutex.unlock();
+        return tmp_bool;
+    }
+
+    double t_gsetproc::stream_speed()
+    {
+        _gmutex.lock();
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_PROC).child_value("stream_speed");
+        str_erase(tmp);
+        double tmp_double;
+        if (tmp != "")
+        {
+            tmp_double = std::stod(tmp);
+        }
+        else
+        {
+            tmp_double = _stream_speed;
+        }
+        if (tmp_double < 0.0)
+        {
+            tmp_double = 0.0;
+        }
+        _gmutex.unlock();
+        return tmp_double;
+    }
+
+    double t_gsetproc::eop_accuracy()
+    {
+        _gmutex.lock();
+        string tmp = _doc.child(XMLKEY_ROOT).child(XMLKEY_PROC).child_value("eop_accuracy");
+        str_erase(tmp);
+        double tmp_double;
+        if (tmp != "")
+        {
+            tmp_double = std::stod(tmp);
+        }
+        else
+        {
+            tmp_double = _eop_accuracy;
+        }
+        if (tmp_double < 0.0)
+        {
+            tmp_double = 0.0;
+        }
+        _gmutex.unlock();
+        return tmp_double;
+    }
+
     string t_gsetproc::ref_clk()
     {
         _gmutex.lock();
@@ -686,6 +781,8 @@ namespace gnut
         _default_node(node, "pos_kin", _pos_kin == true ? "true" : "false");
         _default_node(node, "sd_sat", _sd_sat == true ? "true" : "false");
         _default_node(node, "min_sat", (to_string(_minsat)).c_str());
+        _default_node(node, "num_threads", (to_string(_num_threads)).c_str());
+        _default_node(node, "obs_store", _obs_store.c_str());
         _default_node(node, "basepos", basepos2str(_basepos).c_str());
 
         _gmutex.unlock();
@@ -714,6 +811,8 @@ namespace gnut
              << "   minimum_elev=\"" << _minimum_elev << "\" \n"
              << "   max_res_norm=\"" << _max_res_norm << "\" \n"
              << "   basepos=\"" << basepos2str(_basepos) << "\" \n"
+             << "   num_threads=\"" << _num_threads << "\" \n"
+             << "   obs_store=\"" << _obs_store << "\" \n"
              << " />\n";
 
         cerr << "\t<!-- process description:\n"
@@ -733,6 +832,8 @@ namespace gnut
              << "\t minimum_elev  .. elevation angle cut-off [degree]\n"
              << "\t max_res_norm  .. maximal normalized residuals\n"
              << "\t basepos  .. base site coordinate\n"
+             << "\t num_threads   .. number of sites processed in parallel\n"
+             << "\t obs_store     .. observation container (MAP, COLUMNAR)\n"
              << "\t -->\n\n";
 
         _gmutex.unlock();
@@ -245,6 +245,21 @@ namespace gnut
         /**@brief min satellite number */
         int minsat();
 
+        /**@brief number of threads for processing sites in parallel */
+        int num_threads();
+
+        /**@brief observation container: MAP (nested maps) or COLUMNAR (per-site epoch arrays) */
+        string obs_store();
+
+        /**@brief streaming mode: observation files are replayed epoch by epoch into the filters (each file feeds one filter) */
+        bool stream();
+
+        /**@brief replay speed of streaming mode (multiple of real time, 0 = as fast as possible) */
+        double stream_speed();
+
+        /**@brief accuracy bound of the interpolated TRS to CRS rotation [rad] (0 = exact rotation every epoch) */
+        double eop_accuracy();
+
         /**@brief set process */
         string ref_clk();
         SLIPMODEL slip_model();
@@ -358,6 +373,10 @@ namespace gnut
         double _rec_zen_end;            ///< end zenith angle of receiver PCV
         double _rec_dzen;               ///< zenith angle of receiver PCV
         int _minsat;                    ///< minimum satellite number
+        int _num_threads;               ///< number of processing threads (sites in parallel)
+        string _obs_store;              ///< observation container type
+        double _stream_speed;           ///< replay speed of streaming mode
+        double _eop_accuracy;           ///< accuracy bound of the interpolated TRS to CRS rotation
         BASEPOS _basepos;               ///< base position
         bool _sd_sat;                   ///< single differented between sat and sat_ref
         modeofmeanpole _meanpolemodel;  ///< different mean pole modeling
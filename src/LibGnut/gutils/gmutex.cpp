@@ -15,7 +15,9 @@
 namespace gnut
 {
 
-    t_gmutex::t_gmutex()
+    t_gmutex::t_gmutex() :
+        _owner(thread::id()),
+        _depth(0)
     {
 #ifdef USE_OPENMP
         omp_init_lock(&_mutex);
@@ -24,13 +26,14 @@ namespace gnut
         isLock = false;
     }
 
-    t_gmutex::t_gmutex(const t_gmutex& Other)
+    t_gmutex::t_gmutex(const t_gmutex& Other) :
+        _owner(thread::id()),
+        _depth(0)
     {
 #ifdef USE_OPENMP
         omp_init_lock(&this->_mutex);
-        isLock = Other.isLock;
 #endif
-        isLock = Other.isLock;
+        isLock = false;
     }
 
     t_gmutex::~t_gmutex()
@@ -42,37 +45,107 @@ namespace gnut
         return t_gmutex();
     }
 
+    // nested lock() from the owning thread only counts the depth, the mutex is released
+    // by the unlock() of the outermost lock(), other threads always wait for the owner
     void t_gmutex::lock()
     {
-#ifdef USE_OPENMP
-        if (!isLock)
+        if (_owner.load() == this_thread::get_id())
         {
-            omp_set_lock(&_mutex);
-            isLock = true;
+            _depth++;
+            return;
         }
+#ifdef USE_OPENMP
+        omp_set_lock(&_mutex);
 #else
-        if (!isLock)
-        {
-            _mutex.lock();
-            isLock = true;
-        }
+        _mutex.lock();
 #endif
+        _owner.store(this_thread::get_id());
+        _depth = 1;
+        isLock = true;
     }
 
     void t_gmutex::unlock()
     {
-#ifdef USE_OPENMP
-        if (isLock)
+        if (_owner.load() != this_thread::get_id())
         {
-            omp_unset_lock(&_mutex);
-            isLock = false;
+            return;
         }
-#else
-        if (isLock)
+        if (--_depth > 0)
         {
-            _mutex.unlock();
-            isLock = false;
+            return;
         }
+        isLock = false;
+        _owner.store(thread::id());
+#ifdef USE_OPENMP
+        omp_unset_lock(&_mutex);
+#else
+        _mutex.unlock();
+#endif
+    }
+
+    t_grwmutex::t_grwmutex()
+    {
+#if defined _WIN32 || defined _WIN64
+        InitializeSRWLock(&_rwlock);
+#else
+        pthread_rwlock_init(&_rwlock, NULL);
+#endif
+    }
+
+    t_grwmutex::t_grwmutex(const t_grwmutex& Other)
+    {
+#if defined _WIN32 || defined _WIN64
+        InitializeSRWLock(&_rwlock);
+#else
+        pthread_rwlock_init(&_rwlock, NULL);
+#endif
+    }
+
+    t_grwmutex::~t_grwmutex()
+    {
+#if !defined _WIN32 && !defined _WIN64
+        pthread_rwlock_destroy(&_rwlock);
+#endif
+    }
+
+    t_grwmutex& t_grwmutex::operator=(const t_grwmutex& Other)
+    {
+        return *this;
+    }
+
+    void t_grwmutex::lock()
+    {
+#if defined _WIN32 || defined _WIN64
+        AcquireSRWLockExclusive(&_rwlock);
+#else
+        pthread_rwlock_wrlock(&_rwlock);
+#endif
+    }
+
+    void t_grwmutex::unlock()
+    {
+#if defined _WIN32 || defined _WIN64
+        ReleaseSRWLockExclusive(&_rwlock);
+#else
+        pthread_rwlock_unlock(&_rwlock);
+#endif
+    }
+
+    void t_grwmutex::lock_shared()
+    {
+#if defined _WIN32 || defined _WIN64
+        AcquireSRWLockShared(&_rwlock);
+#else
+        pthread_rwlock_rdlock(&_rwlock);
+#endif
+    }
+
+    void t_grwmutex::unlock_shared()
+    {
+#if defined _WIN32 || defined _WIN64
+        ReleaseSRWLockShared(&_rwlock);
+#else
+        pthread_rwlock_unlock(&_rwlock);
 #endif
     }
 
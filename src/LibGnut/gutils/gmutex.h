@@ -33,10 +33,18 @@
 
 #include <thread>
 #include <mutex>
+#include <atomic>
 
 namespace gnut
 {
-    /** @brief class for t_gmutex. */
+    /**
+     * @brief class for t_gmutex, recursive mutual exclusion.
+     *
+     * The owning thread may call lock() again, every lock() needs its own unlock() and the
+     * mutex is released by the unlock() of the outermost lock(). A path which returns
+     * without its unlock() keeps the mutex, other threads then wait for it forever.
+     * unlock() from a thread not holding the mutex is ignored.
+     */
     class LibGnut_LIBRARY_EXPORT t_gmutex
     {
     public:
@@ -52,10 +60,10 @@ namespace gnut
         /** @brief override operator =. */
         t_gmutex operator=(const t_gmutex& Other);
 
-        /** @brief lock. */
+        /** @brief lock (nested calls of the owner increase the depth). */
         void lock();
 
-        /** @brief unlock. */
+        /** @brief unlock (releases the mutex when the depth drops to zero). */
         void unlock();
 
         bool isLock = false;
@@ -66,6 +74,50 @@ namespace gnut
 #else
         mutex _mutex;
 
+#endif
+        atomic<thread::id> _owner; ///< thread holding the lock
+        int _depth;                ///< number of lock() of the owner not yet unlocked (only the owner changes it)
+    };
+
+    /**
+     * @brief class for t_grwmutex, reader/writer lock for read-mostly data containers.
+     *
+     * Any number of threads may hold the shared (read) lock at the same time, the exclusive
+     * (write) lock is used while the container is being filled. The lock is not recursive,
+     * a thread must not acquire it again before releasing it.
+     */
+    class LibGnut_LIBRARY_EXPORT t_grwmutex
+    {
+    public:
+        /** @brief default constructor. */
+        t_grwmutex();
+
+        /** @brief copy constructor (creates a new unlocked mutex). */
+        t_grwmutex(const t_grwmutex& Other);
+
+        /** @brief default destructor. */
+        ~t_grwmutex();
+
+        /** @brief override operator = (the lock itself is never copied). */
+        t_grwmutex& operator=(const t_grwmutex& Other);
+
+        /** @brief exclusive (write) lock. */
+        void lock();
+
+        /** @brief exclusive (write) unlock. */
+        void unlock();
+
+        /** @brief shared (read) lock. */
+        void lock_shared();
+
+        /** @brief shared (read) unlock. */
+        void unlock_shared();
+
+    protected:
+#if defined _WIN32 || defined _WIN64
+        SRWLOCK _rwlock;
+#else
+        pthread_rwlock_t _rwlock;
 #endif
     };
 } // namespace gnut
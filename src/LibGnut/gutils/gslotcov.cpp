@@ -0,0 +1,158 @@
+/**
+ * @file         gslotcov.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Covariance matrix with stable slots for adding/removing parameters
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <algorithm>
+#include "gutils/gslotcov.h"
+
+using namespace std;
+
+namespace gnut
+{
+    t_gslotcov::t_gslotcov(SymmetricMatrix& Q) :
+        _Q(Q),
+        _cap(0),
+        _loaded(false),
+        _changed(false)
+    {
+    }
+
+    t_gslotcov::~t_gslotcov()
+    {
+        commit();
+    }
+
+    int t_gslotcov::add(double var)
+    {
+        _load();
+        if (_free.empty())
+        {
+            _grow();
+        }
+        int slot = _free.back();
+        _free.pop_back();
+
+        for (int s = 0; s < _cap; s++)
+        {
+            _at(slot, s) = 0.0;
+        }
+        _at(slot, slot) = var;
+
+        _order.push_back(slot);
+        _changed = true;
+        return _order.size();
+    }
+
+    void t_gslotcov::remove(int index)
+    {
+        _load();
+        _free.push_back(_order[index - 1]);
+        _order.erase(_order.begin() + index - 1);
+        _changed = true;
+    }
+
+    double& t_gslotcov::operator()(int row, int col)
+    {
+        if (!_loaded)
+        {
+            return _Q(row, col);
+        }
+        return _at(_order[row - 1], _order[col - 1]);
+    }
+
+    int t_gslotcov::size() const
+    {
+        return _loaded ? _order.size() : _Q.Nrows();
+    }
+
+    void t_gslotcov::commit()
+    {
+        if (!_loaded)
+        {
+            return;
+        }
+        if (_changed)
+        {
+            int n = _order.size();
+            if (_Q.Nrows() != n)
+            {
+                _Q.ReSize(n);
+            }
+            double* store = _Q.Store();
+            for (int r = 0; r < n; r++)
+            {
+                for (int c = 0; c <= r; c++)
+                {
+                    *store++ = _at(_order[r], _order[c]);
+                }
+            }
+        }
+        _order.clear();
+        _free.clear();
+        _loaded = false;
+        _changed = false;
+    }
+
+    void t_gslotcov::_load()
+    {
+        if (_loaded)
+        {
+            return;
+        }
+        int n = _Q.Nrows();
+
+        // the buffer of the previous epochs is reused, new one only if too small (or far too large)
+        if (_cap <= n || _cap > 4 * max(n, 16))
+        {
+            _cap = max(2 * n, 8);
+            _buf.assign(_cap * _cap, 0.0);
+        }
+
+        // slots 0..n-1 in matrix order, the stale values of free slots are cleared by add()
+        const double* store = _Q.Store();
+        for (int r = 0; r < n; r++)
+        {
+            for (int c = 0; c <= r; c++)
+            {
+                _buf[c * _cap + r] = *store++;
+            }
+        }
+
+        _order.resize(n);
+        for (int s = 0; s < n; s++)
+        {
+            _order[s] = s;
+        }
+        _free.clear();
+        for (int s = _cap - 1; s >= n; s--)
+        {
+            _free.push_back(s);
+        }
+        _loaded = true;
+    }
+
+    void t_gslotcov::_grow()
+    {
+        int cap = 2 * _cap;
+        vector<double> buf(cap * cap, 0.0);
+        for (int r = 0; r < _cap; r++)
+        {
+            copy(_buf.begin() + r * _cap, _buf.begin() + (r + 1) * _cap, buf.begin() + r * cap);
+        }
+        _buf.swap(buf);
+
+        for (int s = cap - 1; s >= _cap; s--)
+        {
+            _free.push_back(s);
+        }
+        _cap = cap;
+    }
+
+} // namespace gnut
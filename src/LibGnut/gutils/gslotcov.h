@@ -0,0 +1,99 @@
+/**
+ * @file         gslotcov.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Covariance matrix with stable slots for adding/removing parameters
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GSLOTCOV_H
+#define GSLOTCOV_H
+
+#include <vector>
+#include "newmat/newmat.h"
+#include "gexport/ExportLibGnut.h"
+
+using namespace std;
+
+namespace gnut
+{
+    /**
+     * @brief covariance matrix with stable slots for adding/removing parameters
+     *
+     * Replaces the sequences of Matrix_remRC/Matrix_addRC (each copying the whole
+     * matrix) when the parameters are synchronized with the observations. The object
+     * is a member of the filter bound to its covariance matrix and lives across epochs.
+     * On the first change after a commit the lower triangle is copied into the slots
+     * of the kept buffer. A removed parameter only drops its slot from the order and
+     * returns it to the free list, a new parameter (appended as the last one) takes a
+     * free slot and clears its row and column. The compact matrix is written back once
+     * by commit(), so all parameters changed before it cost O(n) each instead of O(n^2).
+     * The buffer is reallocated only when it is too small, or released lazily when it
+     * holds more than four times the slots needed.
+     * The indexes are 1-based as in SymmetricMatrix and follow t_gallpar::reIndex().
+     */
+    class LibGnut_LIBRARY_EXPORT t_gslotcov
+    {
+    public:
+        /** @brief constructor, the matrix is copied on the first change after a commit. */
+        explicit t_gslotcov(SymmetricMatrix& Q);
+
+        /** @brief destructor, commits the changes. */
+        virtual ~t_gslotcov();
+
+        /**
+         * @brief append a parameter uncorrelated with the others
+         * @param[in]  var       variance of the new parameter
+         * @return index of the new parameter (the last one)
+         */
+        int add(double var);
+
+        /**
+         * @brief remove the row and column of a parameter, the following ones move up
+         * @param[in]  index     parameter index
+         */
+        void remove(int index);
+
+        /** @brief element of the current matrix (both triangles refer to the same value) */
+        double& operator()(int row, int col);
+
+        /** @brief number of parameters */
+        int size() const;
+
+        /** @brief write the compact matrix back (only if changed), the buffer is kept */
+        void commit();
+
+        /** @brief changes not written back yet */
+        bool pending() const
+        {
+            return _loaded;
+        }
+
+    protected:
+        /** @brief copy the matrix into the slots */
+        void _load();
+
+        /** @brief enlarge the buffer (capacity doubled), slots are kept */
+        void _grow();
+
+        /** @brief buffer element of two slots (upper triangle by slots) */
+        double& _at(int s1, int s2)
+        {
+            return (s1 <= s2) ? _buf[s1 * _cap + s2] : _buf[s2 * _cap + s1];
+        }
+
+        SymmetricMatrix& _Q;  ///< compact matrix
+        vector<double> _buf;  ///< slots (capacity x capacity)
+        int _cap;             ///< capacity of the buffer
+        vector<int> _order;   ///< slot of each parameter
+        vector<int> _free;    ///< free slots
+        bool _loaded;         ///< matrix copied into the slots
+        bool _changed;        ///< parameters added or removed
+    };
+
+} // namespace gnut
+
+#endif
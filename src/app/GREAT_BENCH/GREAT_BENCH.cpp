@@ -0,0 +1,119 @@
+/**
+ * @file         GREAT_BENCH.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Benchmarks and numerical checks of the processing kernels
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include "GREAT_BENCH.h"
+#include "gio/great_log.h"
+
+using namespace std;
+using namespace gnut;
+using namespace great;
+
+namespace great
+{
+    size_t bench_heap()
+    {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+        return mallinfo2().uordblks;
+#elif defined(__GLIBC__)
+        return static_cast<unsigned int>(mallinfo().uordblks);
+#else
+        return 0;
+#endif
+    }
+} // namespace great
+
+namespace
+{
+    struct t_benchcmd
+    {
+        const char* name;
+        int (*run)(const t_gbenchopt&);
+        const char* info;
+    };
+
+    const t_benchcmd bench_cmds[] = {
+        {"obs", bench_obs, "observation store: memory and epoch fetch, map vs columnar"},
+        {"gappy", bench_epoch, "processBatch epochs on gappy data: epoch index vs time_sync polling"},
+        {"outlier", bench_outlier, "outlier satellite removal: sparse re-solve of the kept rows vs dense update"},
+        {"update", bench_update, "filter update: sparse sequential vs dense, t_kalman and t_SRF"},
+        {"lambda", bench_lambda, "LAMBDA search on Q/a pairs (synthetic or -f file), SHRINK vs FI71"},
+        {"slotcov", bench_slotcov, "parameter churn of the covariance: Matrix_remRC/addRC vs slots (-r: epochs)"},
+    };
+
+    void usage()
+    {
+        cout << "Usage: GREAT_BENCH <name> [-check] [-n <size>] [-r <repeat>] [-f <file>]" << endl;
+        for (const t_benchcmd& cmd : bench_cmds)
+        {
+            cout << "  " << cmd.name << "\t" << cmd.info << endl;
+        }
+    }
+} // namespace
+
+// MAIN
+// ----------
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        usage();
+        return 1;
+    }
+
+    t_gbenchopt opt;
+    for (int i = 2; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-check") == 0)
+        {
+            opt.check = true;
+        }
+        else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+        {
+            opt.size = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+        {
+            opt.repeat = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+        {
+            opt.file = argv[++i];
+        }
+        else
+        {
+            usage();
+            return 1;
+        }
+    }
+
+    // only warnings of the libraries, the benchmarks print their own results
+    t_great_log::get_instance().init_logger("", spdlog::level::warn);
+
+    for (const t_benchcmd& cmd : bench_cmds)
+    {
+        if (argv[1] == string(cmd.name))
+        {
+            int irc = cmd.run(opt);
+            cout << cmd.name << (irc == 0 ? ": OK" : ": FAILED") << endl;
+            return irc;
+        }
+    }
+
+    usage();
+    return 1;
+}
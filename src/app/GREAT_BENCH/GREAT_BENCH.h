@@ -0,0 +1,95 @@
+/**
+ * @file         GREAT_BENCH.h
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Benchmarks and numerical checks of the processing kernels
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#ifndef GREAT_BENCH_H
+#define GREAT_BENCH_H
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+namespace great
+{
+    /**
+     * @brief options of one benchmark run
+     *
+     * GREAT_BENCH <name> [-check] [-n <size>] [-r <repeat>] [-f <file>]
+     * -check runs a reduced problem, compares against the reference path and
+     * returns non-zero on mismatch (used by ctest).
+     */
+    struct t_gbenchopt
+    {
+        bool check = false; ///< reduced problem, compare only
+        int size = 0;       ///< problem size, 0: default of the benchmark
+        int repeat = 0;     ///< repetitions, 0: default of the benchmark
+        string file;        ///< optional input file
+    };
+
+    /** @brief wall clock in milliseconds since beg */
+    inline double bench_msec(const chrono::steady_clock::time_point& beg)
+    {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - beg).count();
+    }
+
+    /** @brief reproducible pseudo random numbers (LCG), the same sequence on all platforms */
+    class t_gbenchrnd
+    {
+    public:
+        explicit t_gbenchrnd(unsigned int seed) : _seed(seed)
+        {
+        }
+
+        /** @brief uniform in [0, 1) */
+        double uniform()
+        {
+            _seed = _seed * 1103515245u + 12345u;
+            return ((_seed >> 8) & 0xffffff) / 16777216.0;
+        }
+
+        /** @brief standard normal (Box-Muller) */
+        double normal()
+        {
+            double u1 = 1.0 - uniform();
+            double u2 = uniform();
+            return sqrt(-2.0 * log(u1)) * cos(2.0 * 3.14159265358979323846 * u2);
+        }
+
+    private:
+        unsigned int _seed; ///< state of the generator
+    };
+
+    /** @brief heap bytes in use (0 if not available on the platform) */
+    size_t bench_heap();
+
+    /** @brief observation store: memory and epoch fetch, t_gallobs vs t_gallobscol */
+    int bench_obs(const t_gbenchopt& opt);
+
+    /** @brief processBatch epoch iteration on gappy data, epoch index vs time_sync polling */
+    int bench_epoch(const t_gbenchopt& opt);
+
+    /** @brief outlier satellite removal as in t_gpvtflt vs dense update without its rows */
+    int bench_outlier(const t_gbenchopt& opt);
+
+    /** @brief sparse sequential filter update vs dense update, t_kalman and t_SRF */
+    int bench_update(const t_gbenchopt& opt);
+
+    /** @brief LAMBDA search on Q/a pairs of dimension 10-200, SHRINK vs FI71 */
+    int bench_lambda(const t_gbenchopt& opt);
+
+    /** @brief parameter churn of the filter covariance, Matrix_remRC/addRC vs slots */
+    int bench_slotcov(const t_gbenchopt& opt);
+
+} // namespace great
+
+#endif
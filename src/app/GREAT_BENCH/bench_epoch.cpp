@@ -0,0 +1,200 @@
+/**
+ * @file         bench_epoch.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Epoch iteration of processBatch on gappy data, index vs time_sync polling
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include "GREAT_BENCH.h"
+#include "gall/gallobs.h"
+#include "gproc/gpvtflt.h"
+#include "gset/gsetgen.h"
+#include "gutils/gtimesync.h"
+
+using namespace std;
+using namespace gnut;
+
+namespace great
+{
+    namespace
+    {
+        const string bench_rover = "ROVR";
+        const string bench_base = "BASE";
+
+        /** @brief data every interval seconds with outages of 1 min to 1 h, base with outages up to 5 min */
+        void bench_fill(t_gallobs& gobs, const t_gtime& t0, int nepo, int interval)
+        {
+            unsigned int seed = 20261017;
+            auto rnd = [&seed]() {
+                seed = seed * 1103515245u + 12345u;
+                return static_cast<int>((seed >> 8) & 0xffff);
+            };
+
+            int rover_out = 0, base_out = 0;
+            for (int iepo = 0; iepo < nepo; iepo++)
+            {
+                if (rover_out == 0 && rnd() < 150 * interval / 5)
+                {
+                    rover_out = (60 + rnd() % 3540) / interval + 1;
+                }
+                if (base_out == 0 && rnd() < 100 * interval / 5)
+                {
+                    base_out = (5 + rnd() % 295) / interval + 1;
+                }
+
+                t_gtime t(t0);
+                t.add_secs(interval * iepo);
+                for (int isite = 0; isite < 2; isite++)
+                {
+                    int& out = (isite == 0) ? rover_out : base_out;
+                    if (out > 0)
+                    {
+                        --out;
+                        continue;
+                    }
+                    const string& site = (isite == 0) ? bench_rover : bench_base;
+                    for (int isat = 1; isat <= 8; isat++)
+                    {
+                        shared_ptr<t_gobsgnss> obs = make_shared<t_gobsgnss>(site, "G0" + to_string(isat), t);
+                        obs->addobs(C1C, 2.0e7 + iepo);
+                        obs->addobs(L1C, 1.0e8 + iepo);
+                        gobs.addobs(obs);
+                    }
+                }
+            }
+        }
+
+        /** @brief epoch loop of processBatch before the epoch index: step until time_sync, fetch every sampling epoch */
+        vector<t_gtime> bench_polling(t_gallobs& gobs, const t_gtime& first, const t_gtime& last, double sampling, double scale,
+                                      size_t& npoll)
+        {
+            double subint = 0.1;
+            if (scale > 0)
+            {
+                subint = 1.0 / scale;
+            }
+            if (sampling > 1)
+            {
+                subint = pow(10, floor(log10(sampling)));
+            }
+
+            vector<t_gtime> epochs;
+            vector<t_gsatdata> rover, base;
+            t_gtime now(first);
+            npoll = 0;
+            while (now < last || now == last)
+            {
+                ++npoll;
+                if (now != last)
+                {
+                    if (!time_sync(now, sampling, scale))
+                    {
+                        now.add_dsec(subint / 100);
+                        continue;
+                    }
+                    if (sampling > 1)
+                    {
+                        now.reset_dsec();
+                    }
+                }
+                if (gobs.obs(bench_rover, now, rover) > 0 && gobs.obs(bench_base, now, base) > 0)
+                {
+                    epochs.push_back(now);
+                }
+                now.add_secs(int(sampling));
+            }
+            return epochs;
+        }
+
+        /** @brief epoch loop of processBatch: epochs from the container index, fetch epochs with data only */
+        vector<t_gtime> bench_index(t_gallobs& gobs, const t_gtime& first, const t_gtime& last, double sampling, double scale)
+        {
+            vector<t_gtime> rover_epo = gobs.epochs(bench_rover);
+            vector<t_gtime> base_epo = gobs.epochs(bench_base);
+            vector<t_gtime> sync = t_gpvtflt::sync_epochs(rover_epo, &base_epo, first, last, sampling, scale);
+
+            vector<t_gtime> epochs;
+            vector<t_gsatdata> rover, base;
+            for (const t_gtime& now : sync)
+            {
+                if (gobs.obs(bench_rover, now, rover) > 0 && gobs.obs(bench_base, now, base) > 0)
+                {
+                    epochs.push_back(now);
+                }
+            }
+            return epochs;
+        }
+    } // namespace
+
+    int bench_epoch(const t_gbenchopt& opt)
+    {
+        int span = opt.size > 0 ? opt.size : (opt.check ? 10000 : 86400); // seconds of data
+        int repeat = opt.repeat > 0 ? opt.repeat : (opt.check ? 1 : 5);
+        const double scale = 1.0;
+
+        // data interval and processing sampling [s]
+        const int cases[][2] = {{5, 30}, {30, 30}, {30, 1}};
+        for (const auto& cs : cases)
+        {
+            int interval = cs[0];
+            double sampling = cs[1];
+            int nepo = span / interval;
+
+            t_gsetgen gset;
+            t_gallobs gobs;
+            gobs.gset(&gset);
+            t_gtime first(2200, 0.0, t_gtime::GPS);
+            bench_fill(gobs, first, nepo, interval);
+            t_gtime last(first);
+            last.add_secs(int(sampling) * (interval * (nepo - 1) / int(sampling))); // last sampling epoch
+
+            size_t npoll = 0;
+            vector<t_gtime> epo_poll, epo_index;
+            auto beg = chrono::steady_clock::now();
+            for (int irep = 0; irep < repeat; irep++)
+            {
+                epo_poll = bench_polling(gobs, first, last, sampling, scale, npoll);
+            }
+            double msec_poll = bench_msec(beg);
+
+            beg = chrono::steady_clock::now();
+            for (int irep = 0; irep < repeat; irep++)
+            {
+                epo_index = bench_index(gobs, first, last, sampling, scale);
+            }
+            double msec_index = bench_msec(beg);
+
+            if (epo_poll.size() != epo_index.size())
+            {
+                cout << "gappy: number of processed epochs differs " << epo_poll.size() << " " << epo_index.size() << endl;
+                return 1;
+            }
+            for (size_t i = 0; i < epo_poll.size(); i++)
+            {
+                if (epo_poll[i] != epo_index[i])
+                {
+                    cout << "gappy: epoch " << epo_poll[i].str_ymdhms() << " differs from " << epo_index[i].str_ymdhms() << endl;
+                    return 1;
+                }
+            }
+
+            int nsmp = int(last.diff(first) / sampling) + 1;
+            cout << fixed << setprecision(3);
+            cout << "gappy: data " << interval << " s sampling " << sampling << " s, sampling epochs " << nsmp << " processed "
+                 << epo_index.size() << " (" << 100.0 * epo_index.size() / nsmp << " %) repeat " << repeat << endl;
+            cout << "gappy:   time_sync polling " << setw(10) << msec_poll / repeat << " ms  (" << npoll << " steps)" << endl;
+            cout << "gappy:   epoch index       " << setw(10) << msec_index / repeat << " ms" << endl;
+        }
+        return 0;
+    }
+
+} // namespace great
@@ -0,0 +1,229 @@
+/**
+ * @file         bench_lambda.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        LAMBDA search strategies on ambiguity covariance/float pairs of dimension 10-200
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "GREAT_BENCH.h"
+#include "gambfix/glambda.h"
+#include "newmat/newmat.h"
+#include "newmat/newmatap.h"
+
+using namespace std;
+using namespace great;
+
+namespace great
+{
+    namespace
+    {
+        /** @brief float ambiguities and their covariance (n x n, by rows) */
+        struct t_qapair
+        {
+            int n = 0;
+            vector<double> Q;
+            vector<double> a;
+        };
+
+        /** @brief result of one search */
+        struct t_lambdares
+        {
+            vector<double> a;      ///< fixed ambiguities
+            vector<double> disall; ///< squared norms of the candidates
+            double msec = 0.0;     ///< search time
+        };
+
+        /**
+         * @brief ambiguity pair shaped as after a short float solution
+         *
+         * Q = s * H H' + diag(d): the few geometry parameters correlate all ambiguities
+         * strongly, a = integer + sample of N(0, Q).
+         */
+        t_qapair bench_pair(int n, t_gbenchrnd& rnd)
+        {
+            Matrix H(n, 4);
+            for (int i = 1; i <= n; i++)
+            {
+                for (int j = 1; j <= 4; j++)
+                {
+                    H(i, j) = rnd.normal();
+                }
+            }
+            SymmetricMatrix Q(n);
+            Q << 0.5 * H * H.t();
+            for (int i = 1; i <= n; i++)
+            {
+                Q(i, i) += 0.0004 + 0.002 * rnd.uniform();
+            }
+
+            LowerTriangularMatrix L = Cholesky(Q);
+            ColumnVector z(n);
+            for (int i = 1; i <= n; i++)
+            {
+                z(i) = rnd.normal();
+            }
+            ColumnVector e = L * z;
+
+            t_qapair qa;
+            qa.n = n;
+            qa.Q.resize(n * n);
+            qa.a.resize(n);
+            for (int i = 0; i < n; i++)
+            {
+                qa.a[i] = floor(20.0 * rnd.normal()) + e(i + 1);
+                for (int j = 0; j < n; j++)
+                {
+                    qa.Q[i * n + j] = Q(i + 1, j + 1);
+                }
+            }
+            return qa;
+        }
+
+        /** @brief recorded pairs: n, then a (n values), then Q (n x n by rows), repeated */
+        vector<t_qapair> bench_read(const string& file)
+        {
+            vector<t_qapair> pairs;
+            ifstream inp(file);
+            t_qapair qa;
+            while (inp >> qa.n && qa.n > 0)
+            {
+                qa.a.resize(qa.n);
+                qa.Q.resize(qa.n * qa.n);
+                for (double& v : qa.a)
+                {
+                    inp >> v;
+                }
+                for (double& v : qa.Q)
+                {
+                    inp >> v;
+                }
+                if (!inp)
+                {
+                    break;
+                }
+                pairs.push_back(qa);
+            }
+            return pairs;
+        }
+
+        t_lambdares bench_search(t_glambda& lambda, const t_qapair& qa, int maxcan, int repeat)
+        {
+            int n = qa.n;
+            vector<double> Q(n * n), a(n), cands(n * maxcan), disall(maxcan);
+            int ncan = 0, ipos = 0;
+            double boot = 0.0;
+
+            t_lambdares res;
+            auto beg = chrono::steady_clock::now();
+            for (int irep = 0; irep < repeat; irep++)
+            {
+                // lower triangle by rows, as t_gambiguity passes it
+                for (int i = 0; i < n; i++)
+                {
+                    for (int j = 0; j < n; j++)
+                    {
+                        Q[i * n + j] = (j <= i) ? qa.Q[i * n + j] : 0.0;
+                    }
+                }
+                a = qa.a;
+                ncan = ipos = 0;
+                lambda.LAMBDA4(maxcan, n, Q.data(), a.data(), &ncan, &ipos, cands.data(), disall.data(), &boot);
+            }
+            res.msec = bench_msec(beg) / repeat;
+            res.a = a;
+            res.disall.assign(disall.begin(), disall.begin() + min(ncan, maxcan));
+            return res;
+        }
+    } // namespace
+
+    int bench_lambda(const t_gbenchopt& opt)
+    {
+        const int maxcan = 2;
+        int repeat = opt.repeat > 0 ? opt.repeat : (opt.check ? 1 : 5);
+
+        vector<t_qapair> pairs;
+        if (!opt.file.empty())
+        {
+            pairs = bench_read(opt.file);
+            if (pairs.empty())
+            {
+                cout << "lambda: no Q/a pairs read from " << opt.file << endl;
+                return 1;
+            }
+        }
+        else
+        {
+            vector<int> dims;
+            if (opt.size > 0)
+            {
+                dims.push_back(opt.size);
+            }
+            else if (opt.check)
+            {
+                dims = {10, 20, 40};
+            }
+            else
+            {
+                dims = {10, 20, 50, 100, 150, 200};
+            }
+            t_gbenchrnd rnd(20261017);
+            for (int n : dims)
+            {
+                for (int i = 0; i < 3; i++)
+                {
+                    pairs.push_back(bench_pair(n, rnd));
+                }
+            }
+        }
+
+        t_glambda shrink, fi71;
+        shrink.search(LAMBDA_SEARCH::SHRINK);
+        fi71.search(LAMBDA_SEARCH::FI71);
+
+        int irc = 0;
+        cout << "lambda: candidates " << maxcan << " repeat " << repeat << endl;
+        for (size_t ipair = 0; ipair < pairs.size(); ipair++)
+        {
+            const t_qapair& qa = pairs[ipair];
+            t_lambdares res_s, res_f;
+            try
+            {
+                res_s = bench_search(shrink, qa, maxcan, repeat);
+                res_f = bench_search(fi71, qa, maxcan, repeat);
+            }
+            catch (const char* err)
+            {
+                cout << "lambda: pair " << ipair << " n " << qa.n << " " << err << endl;
+                irc = 1;
+                continue;
+            }
+
+            bool same = res_s.a == res_f.a && res_s.disall.size() == res_f.disall.size();
+            for (size_t k = 0; same && k < res_s.disall.size(); k++)
+            {
+                same = fabs(res_s.disall[k] - res_f.disall[k]) <= 1e-9 * max(1.0, res_f.disall[k]);
+            }
+            if (!same)
+            {
+                irc = 1;
+            }
+
+            cout << fixed << setprecision(4);
+            cout << "lambda:   n " << setw(4) << qa.n << "  SHRINK " << setw(10) << res_s.msec << " ms  FI71 " << setw(10) << res_f.msec
+                 << " ms  ratio " << setprecision(3) << setw(12)
+                 << (res_s.disall.size() > 1 ? res_s.disall[1] / res_s.disall[0] : 0.0)
+                 << (same ? "" : "  candidates differ") << endl;
+        }
+        return irc;
+    }
+
+} // namespace great
@@ -0,0 +1,192 @@
+/**
+ * @file         bench_obs.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Memory and epoch fetch of the map and columnar observation stores
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include "GREAT_BENCH.h"
+#include "gall/gallobs.h"
+#include "gall/gallobscol.h"
+#include "gset/gsetgen.h"
+
+using namespace std;
+using namespace gnut;
+
+namespace great
+{
+    namespace
+    {
+        const string bench_site = "BNCH";
+
+        /** @brief satellites of the synthetic constellation with their signals */
+        vector<pair<string, vector<GOBS>>> bench_sats()
+        {
+            vector<pair<string, vector<GOBS>>> sats;
+            char prn[4];
+            for (int i = 1; i <= 20; i++)
+            {
+                sprintf(prn, "G%02d", i);
+                sats.push_back(make_pair(string(prn), vector<GOBS>{C1C, L1C, C2W, L2W, S1C, S2W}));
+            }
+            for (int i = 1; i <= 10; i++)
+            {
+                sprintf(prn, "E%02d", i);
+                sats.push_back(make_pair(string(prn), vector<GOBS>{C1C, L1C, C5Q, L5Q}));
+            }
+            for (int i = 1; i <= 10; i++)
+            {
+                sprintf(prn, "C%02d", 20 + i);
+                sats.push_back(make_pair(string(prn), vector<GOBS>{C2I, L2I, C6I, L6I}));
+            }
+            return sats;
+        }
+
+        /** @brief fill the store with nepo 30 s epochs, satellites rise and set in turn */
+        void bench_fill(t_gallobs& gobs, int nepo)
+        {
+            vector<pair<string, vector<GOBS>>> sats = bench_sats();
+            t_gtime t0(2200, 0.0, t_gtime::GPS);
+            for (int iepo = 0; iepo < nepo; iepo++)
+            {
+                t_gtime t(t0);
+                t.add_secs(30 * iepo);
+                for (size_t isat = 0; isat < sats.size(); isat++)
+                {
+                    if ((iepo / 240 + isat) % 3 == 0)
+                    {
+                        continue;
+                    }
+                    shared_ptr<t_gobsgnss> obs = make_shared<t_gobsgnss>(bench_site, sats[isat].first, t);
+                    for (size_t iobs = 0; iobs < sats[isat].second.size(); iobs++)
+                    {
+                        obs->addobs(sats[isat].second[iobs], 2.0e7 + 1.0e3 * isat + iepo + 0.001 * iobs);
+                        if (iepo % 97 == 0)
+                        {
+                            obs->addlli(sats[isat].second[iobs], 1);
+                        }
+                    }
+                    gobs.addobs(obs);
+                }
+            }
+        }
+
+        /** @brief same satellites, signals, values and LLI in both epochs */
+        bool bench_same(vector<t_gsatdata> a, vector<t_gsatdata> b)
+        {
+            auto by_sat = [](const t_gsatdata& x, const t_gsatdata& y) { return x.sat() < y.sat(); };
+            sort(a.begin(), a.end(), by_sat);
+            sort(b.begin(), b.end(), by_sat);
+            if (a.size() != b.size())
+            {
+                return false;
+            }
+            for (size_t i = 0; i < a.size(); i++)
+            {
+                vector<GOBS> gobs = a[i].obs();
+                if (a[i].sat() != b[i].sat() || gobs.size() != b[i].obs().size())
+                {
+                    return false;
+                }
+                for (const GOBS& g : gobs)
+                {
+                    if (a[i].getobs(g) != b[i].getobs(g) || a[i].getlli(g) != b[i].getlli(g))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        /** @brief fetch all epochs repeat times, returns [ms] */
+        double bench_fetch(t_gallobs& gobs, const vector<t_gtime>& epochs, int repeat, size_t& nsat)
+        {
+            vector<t_gsatdata> data;
+            nsat = 0;
+            auto beg = chrono::steady_clock::now();
+            for (int irep = 0; irep < repeat; irep++)
+            {
+                for (const t_gtime& t : epochs)
+                {
+                    gobs.obs(bench_site, t, data);
+                    nsat += data.size();
+                }
+            }
+            return bench_msec(beg);
+        }
+    } // namespace
+
+    int bench_obs(const t_gbenchopt& opt)
+    {
+        int nepo = opt.size > 0 ? opt.size : (opt.check ? 120 : 2880);
+        int repeat = opt.repeat > 0 ? opt.repeat : (opt.check ? 1 : 10);
+
+        t_gsetgen gset;
+
+        size_t heap0 = bench_heap();
+        unique_ptr<t_gallobs> gmap(new t_gallobs());
+        gmap->gset(&gset);
+        auto beg = chrono::steady_clock::now();
+        bench_fill(*gmap, nepo);
+        vector<t_gtime> epochs = gmap->epochs(bench_site);
+        double fill_map = bench_msec(beg);
+        size_t heap_map = bench_heap() - heap0;
+
+        size_t heap1 = bench_heap();
+        unique_ptr<t_gallobscol> gcol(new t_gallobscol());
+        gcol->gset(&gset);
+        beg = chrono::steady_clock::now();
+        bench_fill(*gcol, nepo);
+        vector<t_gtime> epochs_col = gcol->epochs(bench_site); // compacts the staged records
+        double fill_col = bench_msec(beg);
+        size_t heap_col = bench_heap() - heap1;
+
+        if (epochs.size() != epochs_col.size())
+        {
+            cout << "obs: number of epochs differs " << epochs.size() << " " << epochs_col.size() << endl;
+            return 1;
+        }
+
+        if (opt.check)
+        {
+            for (const t_gtime& t : epochs)
+            {
+                if (!bench_same(gmap->obs(bench_site, t), gcol->obs(bench_site, t)))
+                {
+                    cout << "obs: epoch " << t.str_ymdhms() << " differs between the stores" << endl;
+                    return 1;
+                }
+            }
+        }
+
+        size_t nsat_map = 0, nsat_col = 0;
+        double fetch_map = bench_fetch(*gmap, epochs, repeat, nsat_map);
+        double fetch_col = bench_fetch(*gcol, epochs, repeat, nsat_col);
+        if (nsat_map != nsat_col)
+        {
+            cout << "obs: number of fetched satellites differs " << nsat_map << " " << nsat_col << endl;
+            return 1;
+        }
+
+        double nfetch = double(epochs.size()) * repeat;
+        cout << fixed << setprecision(3);
+        cout << "obs: epochs " << epochs.size() << " satellites/epoch " << double(nsat_map) / nfetch << " repeat " << repeat << endl;
+        cout << "obs:   map      heap " << setw(12) << heap_map << " B  fill " << setw(10) << fill_map
+             << " ms  fetch " << setw(8) << 1.0e3 * fetch_map / nfetch << " us/epoch" << endl;
+        cout << "obs:   columnar heap " << setw(12) << heap_col << " B  fill " << setw(10) << fill_col
+             << " ms  fetch " << setw(8) << 1.0e3 * fetch_col / nfetch << " us/epoch  arrays " << gcol->memory(bench_site) << " B" << endl;
+        return 0;
+    }
+
+} // namespace great
@@ -0,0 +1,335 @@
+/**
+ * @file         bench_outlier.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Removal of an outlier satellite from the PPP update against a full re-solve
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+#include "GREAT_BENCH.h"
+#include "gproc/gflt.h"
+
+using namespace std;
+using namespace gnut;
+
+namespace great
+{
+    namespace
+    {
+        typedef vector<vector<pair<int, double>>> t_rows;
+
+        /**
+         * @brief undifferenced dual-frequency PPP epoch
+         *
+         * Parameters: X, Y, Z, receiver clock, ZTD, then per satellite slant
+         * ionosphere and two ambiguities. Each satellite gives P1, P2, L1, L2.
+         * Every second satellite is converged, the others are new (large
+         * ionosphere and ambiguity variances).
+         */
+        struct t_pppepoch
+        {
+            int npar = 0;
+            SymmetricMatrix Q; ///< predicted covariance
+            t_rows B;          ///< sparse design rows
+            vector<double> P;  ///< weights
+            vector<double> l;  ///< reduced observations
+        };
+
+        t_pppepoch bench_pppepoch(int nsat, t_gbenchrnd& rnd)
+        {
+            t_pppepoch epo;
+            epo.npar = 5 + 3 * nsat;
+
+            // predicted covariance: diagonal a priori variances with small correlations
+            Matrix L(epo.npar, epo.npar);
+            L = 0.0;
+            for (int i = 1; i <= epo.npar; i++)
+            {
+                double sig = 10.0; // crd
+                if (i == 4)
+                {
+                    sig = 3000.0; // clock (white noise)
+                }
+                else if (i == 5)
+                {
+                    sig = 0.1; // ZTD
+                }
+                else if (i > 5)
+                {
+                    bool iono = (i - 6) % 3 == 0;
+                    bool conv = (i - 6) / 3 % 2 == 1;
+                    sig = iono ? (conv ? 0.05 : 5.0) : (conv ? 0.02 : 30.0); // ionosphere, ambiguities
+                }
+                L(i, i) = sig;
+                for (int j = max(1, i - 3); j < i; j++)
+                {
+                    L(i, j) = 0.1 * sig * rnd.normal();
+                }
+            }
+            epo.Q.ReSize(epo.npar);
+            epo.Q << L * L.t();
+
+            const double f1 = 1575.42, f2 = 1227.60;
+            const double gam2 = (f1 * f1) / (f2 * f2);
+            for (int isat = 0; isat < nsat; isat++)
+            {
+                double ele = 0.2 + 1.2 * rnd.uniform();
+                double azi = 6.283185307179586 * rnd.uniform();
+                double e[3] = {cos(ele) * sin(azi), cos(ele) * cos(azi), sin(ele)};
+                double mf = 1.0 / sin(ele);
+                int ion = 6 + 3 * isat, amb1 = ion + 1, amb2 = ion + 2;
+
+                for (int iobs = 0; iobs < 4; iobs++)
+                {
+                    bool phase = iobs >= 2;
+                    bool frq2 = iobs % 2 == 1;
+                    double ion_coeff = (frq2 ? gam2 : 1.0) * (phase ? -1.0 : 1.0);
+
+                    vector<pair<int, double>> h{{1, -e[0]}, {2, -e[1]}, {3, -e[2]}, {4, 1.0}, {5, mf}, {ion, ion_coeff}};
+                    if (phase)
+                    {
+                        h.push_back(make_pair(frq2 ? amb2 : amb1, 1.0));
+                    }
+                    double sig = (phase ? 0.003 : 0.3) / sin(ele);
+                    epo.B.push_back(h);
+                    epo.P.push_back(1.0 / (sig * sig));
+                    epo.l.push_back(sig * rnd.normal() + (phase ? 0.0 : 0.5 * rnd.normal()));
+                }
+            }
+            return epo;
+        }
+
+        /** @brief dense Kalman update (t_kalman, newmat) with the rows given by use */
+        void bench_dense(const t_pppepoch& epo, const vector<bool>& use, ColumnVector& dx, SymmetricMatrix& Q)
+        {
+            int nobs = 0;
+            for (bool u : use)
+            {
+                nobs += u;
+            }
+            Matrix A(nobs, epo.npar);
+            DiagonalMatrix P(nobs);
+            ColumnVector l(nobs);
+            A = 0.0;
+            int row = 0;
+            for (size_t i = 0; i < epo.B.size(); i++)
+            {
+                if (!use[i])
+                {
+                    continue;
+                }
+                ++row;
+                for (const auto& coeff : epo.B[i])
+                {
+                    A(row, coeff.first) = coeff.second;
+                }
+                P(row) = epo.P[i];
+                l(row) = epo.l[i];
+            }
+            Q = epo.Q;
+            t_kalman flt;
+            flt.update(A, P, l, dx, Q);
+        }
+
+        /** @brief reference re-solve: Kalman update in extended precision, all parameters kept, rows given by use */
+        void bench_resolve(const t_pppepoch& epo, const vector<bool>& use, ColumnVector& dx, SymmetricMatrix& Q)
+        {
+            int n = epo.npar;
+            vector<long double> q(n * n), x(n, 0.0L), u(n);
+            for (int i = 0; i < n; i++)
+            {
+                for (int j = 0; j < n; j++)
+                {
+                    q[i * n + j] = epo.Q(i + 1, j + 1);
+                }
+            }
+            for (size_t k = 0; k < epo.B.size(); k++)
+            {
+                if (!use[k])
+                {
+                    continue;
+                }
+                long double s = 1.0L / epo.P[k], v = epo.l[k];
+                for (int i = 0; i < n; i++)
+                {
+                    u[i] = 0.0L;
+                    for (const auto& coeff : epo.B[k])
+                    {
+                        u[i] += q[i * n + coeff.first - 1] * coeff.second;
+                    }
+                }
+                for (const auto& coeff : epo.B[k])
+                {
+                    s += coeff.second * u[coeff.first - 1];
+                    v -= coeff.second * x[coeff.first - 1];
+                }
+                for (int i = 0; i < n; i++)
+                {
+                    x[i] += u[i] * v / s;
+                    for (int j = 0; j < n; j++)
+                    {
+                        q[i * n + j] -= u[i] * u[j] / s;
+                    }
+                }
+            }
+            dx.ReSize(n);
+            Q.ReSize(n);
+            for (int i = 0; i < n; i++)
+            {
+                dx(i + 1) = x[i];
+                for (int j = 0; j <= i; j++)
+                {
+                    Q(i + 1, j + 1) = q[i * n + j];
+                }
+            }
+        }
+
+        /** @brief largest difference of dx relative to its sigma and of Q relative to sigma_i * sigma_j (parameters in keep) */
+        void bench_diff(const ColumnVector& dx,
+                        const SymmetricMatrix& Q,
+                        const ColumnVector& dx_ref,
+                        const SymmetricMatrix& Q_ref,
+                        const vector<int>& keep,
+                        double& ddx,
+                        double& dQ)
+        {
+            ddx = dQ = 0.0;
+            for (size_t i = 0; i < keep.size(); i++)
+            {
+                int ki = keep[i];
+                double si = sqrt(Q_ref(ki, ki));
+                ddx = max(ddx, fabs(dx(i + 1) - dx_ref(ki)) / si);
+                for (size_t j = 0; j <= i; j++)
+                {
+                    int kj = keep[j];
+                    dQ = max(dQ, fabs(Q(i + 1, j + 1) - Q_ref(ki, kj)) / (si * sqrt(Q_ref(kj, kj))));
+                }
+            }
+        }
+    } // namespace
+
+    int bench_outlier(const t_gbenchopt& opt)
+    {
+        int nsat = opt.size > 0 ? opt.size : (opt.check ? 12 : 40);
+        int repeat = opt.repeat > 0 ? opt.repeat : (opt.check ? 3 : 20);
+        const double tol = 1e-6; // relative to the sigmas of the re-solve
+
+        t_gbenchrnd rnd(20261017);
+        double ddx_max = 0.0, dQ_max = 0.0, ddx_dense = 0.0, dQ_dense = 0.0;
+        double msec_full = 0.0, msec_remove = 0.0, msec_dense = 0.0;
+        int ntest = 0;
+
+        for (int irep = 0; irep < repeat; irep++)
+        {
+            t_pppepoch epo = bench_pppepoch(nsat, rnd);
+            t_kalman flt;
+
+            // update with all observations (the first iteration of the filter)
+            ColumnVector dx_all;
+            SymmetricMatrix Q_all = epo.Q;
+            auto beg = chrono::steady_clock::now();
+            flt.update(epo.B, epo.P, epo.l, dx_all, Q_all);
+            msec_full += bench_msec(beg);
+
+            for (int isat = 0; isat < nsat; isat++)
+            {
+                // outlier satellite: its rows and parameters are removed and the rest is solved
+                // again from the prediction, as t_gpvtflt::_outlierRemove
+                int ion = 6 + 3 * isat;
+                vector<int> keep, pos(epo.npar + 1, 0);
+                for (int i = 1; i <= epo.npar; i++)
+                {
+                    if (i < ion || i > ion + 2)
+                    {
+                        keep.push_back(i);
+                        pos[i] = keep.size();
+                    }
+                }
+                vector<bool> use(epo.B.size(), true);
+                fill(use.begin() + 4 * isat, use.begin() + 4 * isat + 4, false);
+
+                beg = chrono::steady_clock::now();
+                t_rows B_keep;
+                vector<double> P_keep, l_keep;
+                for (size_t i = 0; i < use.size(); i++)
+                {
+                    if (!use[i])
+                    {
+                        continue;
+                    }
+                    vector<pair<int, double>> h;
+                    for (const auto& coeff : epo.B[i])
+                    {
+                        h.push_back(make_pair(pos[coeff.first], coeff.second));
+                    }
+                    B_keep.push_back(h);
+                    P_keep.push_back(epo.P[i]);
+                    l_keep.push_back(epo.l[i]);
+                }
+                SymmetricMatrix Q_rem(keep.size());
+                for (size_t i = 0; i < keep.size(); i++)
+                {
+                    for (size_t j = 0; j <= i; j++)
+                    {
+                        Q_rem(i + 1, j + 1) = epo.Q(keep[i], keep[j]);
+                    }
+                }
+                ColumnVector dx_rem;
+                flt.update(B_keep, P_keep, l_keep, dx_rem, Q_rem);
+                msec_remove += bench_msec(beg);
+
+                // dense update without the rows (reported only)
+                ColumnVector dx_dense;
+                SymmetricMatrix Q_dense;
+                beg = chrono::steady_clock::now();
+                bench_dense(epo, use, dx_dense, Q_dense);
+                msec_dense += bench_msec(beg);
+
+                // reference: re-solve without the rows
+                ColumnVector dx_ref;
+                SymmetricMatrix Q_ref;
+                bench_resolve(epo, use, dx_ref, Q_ref);
+
+                double ddx, dQ;
+                bench_diff(dx_rem, Q_rem, dx_ref, Q_ref, keep, ddx, dQ);
+                ddx_max = max(ddx_max, ddx);
+                dQ_max = max(dQ_max, dQ);
+
+                vector<int> all(epo.npar);
+                for (int i = 0; i < epo.npar; i++)
+                {
+                    all[i] = i + 1;
+                }
+                bench_diff(dx_dense, Q_dense, dx_ref, Q_ref, all, ddx, dQ);
+                ddx_dense = max(ddx_dense, ddx);
+                dQ_dense = max(dQ_dense, dQ);
+                ++ntest;
+            }
+        }
+
+        cout << scientific << setprecision(3);
+        cout << "outlier: parameters " << 5 + 3 * nsat << " observations " << 4 * nsat << " removals " << ntest << endl;
+        cout << "outlier:   removal  max |dx - dx_ref| / sigma " << ddx_max << "  max |Q - Q_ref| / (sigma_i sigma_j) " << dQ_max
+             << "  (tolerance " << tol << ")" << endl;
+        cout << "outlier:   dense    max |dx - dx_ref| / sigma " << ddx_dense << "  max |Q - Q_ref| / (sigma_i sigma_j) " << dQ_dense
+             << endl;
+        cout << fixed << setprecision(4);
+        cout << "outlier:   full update " << msec_full / repeat << " ms  removal (sparse re-solve) " << msec_remove / ntest
+             << " ms  dense re-solve " << msec_dense / ntest << " ms" << endl;
+
+        if (!(ddx_max < tol && dQ_max < tol))
+        {
+            cout << "outlier: state after the removal differs from the re-solve" << endl;
+            return 1;
+        }
+        return 0;
+    }
+
+} // namespace great
@@ -0,0 +1,155 @@
+/**
+ * @file         bench_slotcov.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Parameter churn of the filter covariance: Matrix_remRC/addRC vs slots
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <iomanip>
+#include <iostream>
+
+#include "GREAT_BENCH.h"
+#include "gutils/gmatrixconv.h"
+#include "gutils/gslotcov.h"
+
+using namespace std;
+using namespace gnut;
+
+namespace great
+{
+    namespace
+    {
+        /** @brief parameters removed (1-based, in call order) and variances added in one synchronization */
+        struct t_churn
+        {
+            vector<int> rem;
+            vector<double> add;
+        };
+
+        /** @brief three synchronizations per epoch (system biases, ionosphere, ambiguities) */
+        vector<vector<t_churn>> bench_churn(int npar, int nepo, t_gbenchrnd& rnd)
+        {
+            vector<vector<t_churn>> epochs(nepo, vector<t_churn>(3));
+            for (int iepo = 0; iepo < nepo; iepo++)
+            {
+                for (t_churn& sync : epochs[iepo])
+                {
+                    int nchg = int(8 * rnd.uniform()); // 0-7 satellites set and rise
+                    for (int i = 0; i < nchg; i++)
+                    {
+                        sync.rem.push_back(6 + int((npar - 6 - i) * rnd.uniform()));
+                        sync.add.push_back(100.0 + rnd.uniform());
+                    }
+                }
+            }
+            return epochs;
+        }
+
+        /** @brief stands for the filter update between the epochs, touches all elements */
+        void bench_touch(SymmetricMatrix& Q)
+        {
+            Real* q = Q.Store();
+            for (int i = 0; i < Q.Storage(); i++)
+            {
+                q[i] = 0.999 * q[i] + 1e-6;
+            }
+        }
+    } // namespace
+
+    int bench_slotcov(const t_gbenchopt& opt)
+    {
+        int npar = opt.size > 0 ? opt.size : (opt.check ? 60 : 300);
+        int nepo = opt.repeat > 0 ? opt.repeat : (opt.check ? 50 : 500);
+
+        t_gbenchrnd rnd(20261017);
+        vector<vector<t_churn>> churn = bench_churn(npar, nepo, rnd);
+
+        SymmetricMatrix Q0(npar);
+        for (int i = 1; i <= npar; i++)
+        {
+            for (int j = 1; j < i; j++)
+            {
+                Q0(i, j) = 0.01 * rnd.normal();
+            }
+            Q0(i, i) = 1.0 + rnd.uniform();
+        }
+
+        SymmetricMatrix Q_rc = Q0, Q_local = Q0, Q_member = Q0;
+        t_gslotcov Qslot(Q_member); // lives across the epochs as the filter member
+        double msec_rc = 0.0, msec_local = 0.0, msec_member = 0.0;
+
+        for (int iepo = 0; iepo < nepo; iepo++)
+        {
+            // Matrix_remRC/addRC for each parameter
+            auto beg = chrono::steady_clock::now();
+            for (const t_churn& sync : churn[iepo])
+            {
+                for (int idx : sync.rem)
+                {
+                    Matrix_remRC(Q_rc, idx, idx);
+                }
+                for (double var : sync.add)
+                {
+                    int n = Q_rc.Nrows() + 1;
+                    Matrix_addRC(Q_rc, n, n);
+                    Q_rc(n, n) = var;
+                }
+            }
+            msec_rc += bench_msec(beg);
+
+            // slots created and committed by each synchronization
+            beg = chrono::steady_clock::now();
+            for (const t_churn& sync : churn[iepo])
+            {
+                t_gslotcov Qtmp(Q_local);
+                for (int idx : sync.rem)
+                {
+                    Qtmp.remove(idx);
+                }
+                for (double var : sync.add)
+                {
+                    Qtmp.add(var);
+                }
+            }
+            msec_local += bench_msec(beg);
+
+            // persistent slots, committed once after all synchronizations
+            beg = chrono::steady_clock::now();
+            for (const t_churn& sync : churn[iepo])
+            {
+                for (int idx : sync.rem)
+                {
+                    Qslot.remove(idx);
+                }
+                for (double var : sync.add)
+                {
+                    Qslot.add(var);
+                }
+            }
+            Qslot.commit();
+            msec_member += bench_msec(beg);
+
+            if (!(Q_rc == Q_member) || !(Q_rc == Q_local))
+            {
+                cout << "slotcov: covariance differs from Matrix_remRC/addRC at epoch " << iepo << endl;
+                return 1;
+            }
+
+            bench_touch(Q_rc);
+            bench_touch(Q_local);
+            bench_touch(Q_member);
+        }
+
+        cout << fixed << setprecision(4);
+        cout << "slotcov: parameters " << npar << " epochs " << nepo << " (0-7 changes in each of 3 synchronizations)" << endl;
+        cout << "slotcov:   Matrix_remRC/addRC      " << setw(10) << msec_rc / nepo << " ms/epoch" << endl;
+        cout << "slotcov:   slots per sync call     " << setw(10) << msec_local / nepo << " ms/epoch" << endl;
+        cout << "slotcov:   persistent slots        " << setw(10) << msec_member / nepo << " ms/epoch" << endl;
+        return 0;
+    }
+
+} // namespace great
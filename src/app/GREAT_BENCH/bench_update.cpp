@@ -0,0 +1,195 @@
+/**
+ * @file         bench_update.cpp
+ * @author       GREAT-WHU (https://github.com/GREAT-WHU)
+ * @brief        Sparse sequential filter update against the dense update (t_kalman, t_SRF)
+ * @version      1.0
+ * @date         2026-10-17
+ *
+ * @copyright Copyright (c) 2026, Wuhan University. All rights reserved.
+ *
+ */
+
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+#include "GREAT_BENCH.h"
+#include "gproc/gflt.h"
+
+using namespace std;
+using namespace gnut;
+
+namespace great
+{
+    namespace
+    {
+        typedef vector<vector<pair<int, double>>> t_rows;
+
+        /**
+         * @brief well conditioned update problem
+         *
+         * Every observation sees the first four parameters (position and clock)
+         * and two further ones, as a code or phase row of one satellite.
+         */
+        struct t_updprob
+        {
+            SymmetricMatrix Q; ///< predicted covariance
+            t_rows B;          ///< sparse design rows
+            vector<double> P;  ///< weights
+            vector<double> l;  ///< reduced observations
+        };
+
+        t_updprob bench_updprob(int npar, int nobs, t_gbenchrnd& rnd)
+        {
+            t_updprob prob;
+            Matrix L(npar, npar);
+            L = 0.0;
+            for (int i = 1; i <= npar; i++)
+            {
+                L(i, i) = 1.0 + rnd.uniform();
+                for (int j = max(1, i - 3); j < i; j++)
+                {
+                    L(i, j) = 0.3 * rnd.normal();
+                }
+            }
+            prob.Q.ReSize(npar);
+            prob.Q << L * L.t();
+
+            for (int iobs = 0; iobs < nobs; iobs++)
+            {
+                vector<pair<int, double>> h{{1, rnd.normal()}, {2, rnd.normal()}, {3, rnd.normal()}, {4, 1.0}};
+                int k = 5 + static_cast<int>(rnd.uniform() * (npar - 5));
+                h.push_back(make_pair(k, 1.0));
+                h.push_back(make_pair(k + 1, rnd.normal()));
+                prob.B.push_back(h);
+                prob.P.push_back(1.0 / (0.1 + rnd.uniform()));
+                prob.l.push_back(rnd.normal());
+            }
+            return prob;
+        }
+
+        /** @brief dense update of flt with the rows of prob */
+        void bench_dense_update(t_gflt& flt, const t_updprob& prob, ColumnVector& dx, SymmetricMatrix& Q)
+        {
+            int nobs = prob.B.size();
+            Matrix A(nobs, prob.Q.Nrows());
+            DiagonalMatrix P(nobs);
+            ColumnVector l(nobs);
+            A = 0.0;
+            for (int row = 0; row < nobs; row++)
+            {
+                for (const auto& coeff : prob.B[row])
+                {
+                    A(row + 1, coeff.first) = coeff.second;
+                }
+                P(row + 1) = prob.P[row];
+                l(row + 1) = prob.l[row];
+            }
+            Q = prob.Q;
+            flt.update(A, P, l, dx, Q);
+        }
+
+        /** @brief largest difference of dx relative to its sigma and of Q relative to sigma_i * sigma_j */
+        void bench_cmp(const ColumnVector& dx,
+                       const SymmetricMatrix& Q,
+                       const ColumnVector& dx_ref,
+                       const SymmetricMatrix& Q_ref,
+                       double& ddx,
+                       double& dQ)
+        {
+            ddx = dQ = 0.0;
+            if (dx.Nrows() != dx_ref.Nrows() || Q.Nrows() != Q_ref.Nrows())
+            {
+                ddx = dQ = 1e30;
+                return;
+            }
+            for (int i = 1; i <= Q_ref.Nrows(); i++)
+            {
+                double si = sqrt(Q_ref(i, i));
+                ddx = max(ddx, fabs(dx(i) - dx_ref(i)) / si);
+                for (int j = 1; j <= i; j++)
+                {
+                    dQ = max(dQ, fabs(Q(i, j) - Q_ref(i, j)) / (si * sqrt(Q_ref(j, j))));
+                }
+            }
+        }
+
+        /** @brief sparse vs dense update of one filter, true if they agree */
+        bool bench_filter(const string& name, t_gflt& flt, int npar, int nobs, int repeat, double tol)
+        {
+            t_gbenchrnd rnd(20261017);
+            double ddx_max = 0.0, dQ_max = 0.0, msec_dense = 0.0, msec_sparse = 0.0;
+            for (int irep = 0; irep < repeat; irep++)
+            {
+                t_updprob prob = bench_updprob(npar, nobs, rnd);
+
+                ColumnVector dx_dense;
+                SymmetricMatrix Q_dense;
+                auto beg = chrono::steady_clock::now();
+                bench_dense_update(flt, prob, dx_dense, Q_dense);
+                msec_dense += bench_msec(beg);
+
+                ColumnVector dx_sparse;
+                SymmetricMatrix Q_sparse = prob.Q;
+                beg = chrono::steady_clock::now();
+                flt.update(prob.B, prob.P, prob.l, dx_sparse, Q_sparse);
+                msec_sparse += bench_msec(beg);
+
+                double ddx, dQ;
+                bench_cmp(dx_sparse, Q_sparse, dx_dense, Q_dense, ddx, dQ);
+                ddx_max = max(ddx_max, ddx);
+                dQ_max = max(dQ_max, dQ);
+            }
+
+            // a covariance which is not positive definite is reported by an exception
+            bool npd_thrown = false;
+            SymmetricMatrix Q_npd(npar);
+            Q_npd = 0.0;
+            for (int i = 1; i <= npar; i++)
+            {
+                Q_npd(i, i) = -1.0;
+            }
+            ColumnVector dx_npd;
+            t_updprob prob = bench_updprob(npar, nobs, rnd);
+            try
+            {
+                flt.update(prob.B, prob.P, prob.l, dx_npd, Q_npd);
+            }
+            catch (NPDException&)
+            {
+                npd_thrown = true;
+            }
+
+            cout << scientific << setprecision(3);
+            cout << "update: " << left << setw(7) << name << right << " max |dx_sparse - dx_dense| / sigma " << ddx_max
+                 << "  max |Q_sparse - Q_dense| / (sigma_i sigma_j) " << dQ_max << "  (tolerance " << tol << ")" << endl;
+            cout << fixed << setprecision(4);
+            cout << "update: " << left << setw(7) << name << right << " dense " << msec_dense / repeat << " ms  sparse "
+                 << msec_sparse / repeat << " ms  NPD " << (npd_thrown ? "thrown" : "not thrown") << endl;
+
+            return ddx_max < tol && dQ_max < tol && npd_thrown;
+        }
+    } // namespace
+
+    int bench_update(const t_gbenchopt& opt)
+    {
+        int npar = opt.size > 0 ? opt.size : (opt.check ? 30 : 200);
+        int repeat = opt.repeat > 0 ? opt.repeat : (opt.check ? 3 : 10);
+        int nobs = npar / 2;
+        const double tol = 1e-8;
+
+        cout << "update: parameters " << npar << " observations " << nobs << " repeat " << repeat << endl;
+        t_kalman kalman;
+        t_SRF srf;
+        bool ok = bench_filter("kalman", kalman, npar, nobs, repeat, tol);
+        ok = bench_filter("SRF", srf, npar, nobs, repeat, tol) && ok;
+
+        if (!ok)
+        {
+            cout << "update: sparse update differs from the dense update or misses a covariance not positive definite" << endl;
+            return 1;
+        }
+        return 0;
+    }
+
+} // namespace great
@@ -2,6 +2,8 @@
 #include "gcfg_ppp.h"
 #include <chrono>
 #include <thread>
+#include <atomic>
+#include <algorithm>
 
 using namespace std;
 using namespace gnut;
@@ -32,6 +34,9 @@ int main(int argc, char** argv)
     auto log_name = dynamic_cast<t_gsetout*>(&gset)->log_name();
     t_great_log::get_instance().init_logger(log_name, log_level);
 
+    // Settings used in the epoch loop, read once and shared by all sites
+    shared_ptr<const t_gsetsnap> gsnap = make_shared<const t_gsetsnap>(&gset);
+
     // Check the base station
     bool isBase = dynamic_cast<t_gsetgen*>(&gset)->list_base().size();
 
@@ -52,7 +57,16 @@ int main(int argc, char** argv)
     t_gdata* gdata = nullptr;
     t_gnavde* gde = new t_gnavde;
     t_gpoleut1* gerp = new t_gpoleut1;
-    t_gallobs* gobs = new t_gallobs();
+    // observation container, COLUMNAR keeps per-site epoch arrays instead of nested maps
+    t_gallobs* gobs = nullptr;
+    if (dynamic_cast<t_gsetproc*>(&gset)->obs_store() == "COLUMNAR")
+    {
+        gobs = new t_gallobscol();
+    }
+    else
+    {
+        gobs = new t_gallobs();
+    }
     gobs->gset(&gset);
     t_gallprec* gorb = new t_gallprec();
     t_gallpcv* gpcv = nullptr;
@@ -84,6 +98,7 @@ int main(int argc, char** argv)
 
     // vgppp for the process of ppp with filter
     vector<t_gpvtflt*> vgpvt;
+    vector<string> vbase;
 
     // runepoch for the time costed each epoch
     t_gtime runepoch(t_gtime::GPS);
@@ -134,7 +149,26 @@ int main(int argc, char** argv)
         }
     }
 
+    // Number of worker threads for decoding and processing
+    int nthreads = dynamic_cast<t_gsetproc*>(&gset)->num_threads();
+
+    // Streaming mode: observation files are replayed epoch by epoch during processing
+    bool stream = dynamic_cast<t_gsetproc*>(&gset)->stream();
+    double stream_speed = dynamic_cast<t_gsetproc*>(&gset)->stream_speed();
+    vector<t_gobsstream*> gstream;
+    vector<t_gcoder*> gstream_coder;
+
     // DATA READING
+    // Decoders are prepared here and run by the worker threads below.
+    // t_gallobs, t_gallbias, t_gallpcv and t_gallotl lock themselves, so files for
+    // them are decoded concurrently. Files for the other containers (orbits and clocks
+    // included, whose files overlap at day boundaries and keep the first value) are
+    // decoded one after another in the given order by one job per container.
+    vector<string> gpath;
+    vector<string> gid;
+    vector<IFMT> gfmt;
+    vector<vector<size_t>> gjob;
+    map<t_gdata*, size_t> container_job;
     multimap<IFMT, string>::const_iterator itINP = inp.begin();
     for (size_t i = 0; i < inp.size() && itINP != inp.end(); ++i, ++itINP)
     {
@@ -142,6 +176,8 @@ int main(int argc, char** argv)
         IFMT ifmt(itINP->first);
         string path(itINP->second);
         string id("ID" + int2str(i));
+        tgcoder = 0;
+        tgio = 0;
 
         // For different file format, we prepare different data container and decoder for them.
         if (ifmt == IFMT::RINEXO_INP)
@@ -214,38 +250,149 @@ int main(int argc, char** argv)
         if (path.substr(0, 7) == "file://")
         {
             GREAT_INFO("path is file!");
-            tgio = new t_gfile();
+            tgio = new t_gmmapfile();
             tgio->path(path);
         }
 
-        // READ DATA FROM FILE
-        if (tgcoder)
+        if (!tgcoder || !tgio)
+        {
+            delete tgio;
+            delete tgcoder;
+            continue;
+        }
+
+        // observations of streaming mode go through a replay source instead of the container
+        if (stream && ifmt == IFMT::RINEXO_INP)
         {
-            // Put the file into gcoder
+            delete tgio;
+            t_gobsstream* tgstream = new t_gobsstream(&gset);
+            tgstream->path(path);
+            tgstream->speed(stream_speed);
             tgcoder->clear();
             tgcoder->path(path);
-            // Put the data container into gcoder
-            tgcoder->add_data(id, gdata);
+            tgcoder->add_data(id, tgstream->window());
             tgcoder->add_data("OBJ", gobj);
+            tgstream->coder(tgcoder);
+            gstream.push_back(tgstream);
+            gstream_coder.push_back(tgcoder);
+            continue;
+        }
 
-            // Put the gcoder into the gio
-            // Note, gcoder contain the gdata and gio contain the gcoder
-            tgio->coder(tgcoder);
+        // Put the file into gcoder
+        tgcoder->clear();
+        tgcoder->path(path);
+        // Put the data container into gcoder
+        tgcoder->add_data(id, gdata);
+        tgcoder->add_data("OBJ", gobj);
+
+        // Put the gcoder into the gio
+        // Note, gcoder contain the gdata and gio contain the gcoder
+        tgio->coder(tgcoder);
+
+        gcoder.push_back(tgcoder);
+        gio.push_back(tgio);
+        gpath.push_back(path);
+        gid.push_back(id);
+        gfmt.push_back(ifmt);
+        if (gdata == gobs || gdata == gbia || gdata == gpcv || gdata == gotl)
+        {
+            gjob.push_back(vector<size_t>(1, gio.size() - 1));
+        }
+        else
+        {
+            auto itJOB = container_job.find(gdata);
+            if (itJOB == container_job.end())
+            {
+                itJOB = container_job.insert(make_pair(gdata, gjob.size())).first;
+                gjob.push_back(vector<size_t>());
+            }
+            gjob[itJOB->second].push_back(gio.size() - 1);
+        }
+    }
 
-            runepoch = t_gtime::current_time(t_gtime::GPS);
+    // READ DATA FROM FILES
+    // Observation files are additionally split into epoch blocks decoded in parallel
+    int nobsfile = count(gfmt.begin(), gfmt.end(), IFMT::RINEXO_INP);
+    int nblock = nobsfile > 0 ? max(1, nthreads / nobsfile) : 1;
+    auto read_file = [&](size_t idx)
+    {
+        t_gtime file_beg = t_gtime::current_time(t_gtime::GPS);
 
-            // Read the data from file here
-            tgio->run_read();
-            lstepoch = t_gtime::current_time(t_gtime::GPS);
+        // Read the data from file here
+        t_gmmapfile* tgmmap = dynamic_cast<t_gmmapfile*>(gio[idx]);
+        if (gfmt[idx] == IFMT::RINEXO_INP && nblock > 1 && tgmmap)
+        {
+            string path = gpath[idx], id = gid[idx];
+            tgmmap->run_read(nblock, [&gset, &gobs, &gobj, path, id]() -> t_gcoder*
+            {
+                t_gcoder* tgblock = new t_rinexo(&gset, "", 4096);
+                tgblock->clear();
+                tgblock->path(path);
+                tgblock->add_data(id, gobs);
+                tgblock->add_data("OBJ", gobj);
+                return tgblock;
+            });
+        }
+        else
+        {
+            gio[idx]->run_read();
+        }
+        t_gtime file_end = t_gtime::current_time(t_gtime::GPS);
 
-            // Write the information of reading process to log file
-            GREAT_INFO("READ: " + path + " time: " + dbl2str(lstepoch.diff(runepoch)) + " sec");
+        // Write the information of reading process to log file
+        GREAT_INFO("READ: " + gpath[idx] + " time: " + dbl2str(file_end.diff(file_beg)) + " sec");
 
-            // Delete
-            delete tgio;
-            delete tgcoder;
+        // Delete
+        delete gio[idx];
+        gio[idx] = nullptr;
+        delete gcoder[idx];
+        gcoder[idx] = nullptr;
+    };
+    atomic<size_t> next_job(0);
+    auto read_worker = [&]()
+    {
+        size_t ijob;
+        while ((ijob = next_job++) < gjob.size())
+        {
+            for (size_t idx : gjob[ijob])
+            {
+                read_file(idx);
+            }
+        }
+    };
+
+    int nread = min<int>(nthreads, gjob.size());
+    runepoch = t_gtime::current_time(t_gtime::GPS);
+    if (nread <= 1)
+    {
+        read_worker();
+    }
+    else
+    {
+        for (int ith = 0; ith < nread; ++ith)
+        {
+            gthread.push_back(thread(read_worker));
+        }
+        for (size_t ith = 0; ith < gthread.size(); ++ith)
+        {
+            gthread[ith].join();
         }
+        gthread.clear();
     }
+    lstepoch = t_gtime::current_time(t_gtime::GPS);
+    GREAT_INFO("READ: " + int2str(gio.size()) + " files, threads: " + int2str(max(nread, 1)) + " time: " + dbl2str(lstepoch.diff(runepoch)) + " sec");
+
+    // streams decode their header and first epoch here (receiver objects, site of the stream)
+    map<string, t_gobsstream*> site_stream;
+    for (auto tgstream : gstream)
+    {
+        if (tgstream->open())
+        {
+            site_stream[tgstream->site()] = tgstream;
+            GREAT_INFO("STREAM: " + tgstream->path() + " site: " + tgstream->site());
+        }
+    }
+
     // set antennas for satllites (must be before PCV assigning)
     t_gtime beg = dynamic_cast<t_gsetgen*>(&gset)->beg();
     gobj->read_satinfo(beg);
@@ -309,6 +456,8 @@ int main(int argc, char** argv)
     }
     int nsite = sites.size();
     set<string>::iterator it = sites.begin();
+    // a stream is replayed once into a single-consumer queue, so it feeds only one filter
+    set<string> stream_used;
     while (i < nsite)
     {
         string site_base = "";
@@ -318,15 +467,17 @@ int main(int argc, char** argv)
         {
             site_base = (gset.list_base())[i];
             site = (gset.list_rover())[i];
-            if (gobs->beg_obs(site_base) == LAST_TIME || gobs->end_obs(site_base) == FIRST_TIME || site_base.empty() ||
-                gobs->isSite(site_base) == false)
+            if (stream ? site_stream.count(site_base) == 0
+                       : (gobs->beg_obs(site_base) == LAST_TIME || gobs->end_obs(site_base) == FIRST_TIME || site_base.empty() ||
+                          gobs->isSite(site_base) == false))
             {
                 GREAT_INFO("No two site/data for processing!");
                 i++;
                 continue;
             }
         }
-        if (gobs->beg_obs(site) == LAST_TIME || gobs->end_obs(site) == FIRST_TIME || site.empty() || gobs->isSite(site) == false)
+        if (stream ? site_stream.count(site) == 0
+                   : (gobs->beg_obs(site) == LAST_TIME || gobs->end_obs(site) == FIRST_TIME || site.empty() || gobs->isSite(site) == false))
         {
             GREAT_INFO("No site/data for processing!");
             if (!isBase)
@@ -336,38 +487,114 @@ int main(int argc, char** argv)
             i++;
             continue;
         }
+        if (stream && (stream_used.count(site) || (isBase && stream_used.count(site_base))))
+        {
+            GREAT_WARN("Stream of " + (stream_used.count(site) ? site : site_base) + " already used by another site, " + site + " skipped!");
+            if (!isBase)
+            {
+                it++;
+            }
+            i++;
+            continue;
+        }
+        if (stream)
+        {
+            stream_used.insert(site);
+            if (isBase)
+            {
+                stream_used.insert(site_base);
+            }
+        }
 
-        // Add site data
+        // Add site data (filters are created in the main thread, processed by the workers below)
         vgpvt.push_back(0);
         int idx = vgpvt.size() - 1;
-        vgpvt[idx] = new t_gpvtflt(site, site_base, &gset, data);
+        vgpvt[idx] = new t_gpvtflt(site, site_base, &gset, gsnap, data);
+        vbase.push_back(site_base);
         if (dynamic_cast<t_gsetamb*>(&gset)->fix_mode() != FIX_MODE::NO && !isBase)
         {
             vgpvt[idx]->Add_UPD(gupd);
         }
 
-        t_gtime beg = dynamic_cast<t_gsetgen*>(&gset)->beg();
-        t_gtime end = dynamic_cast<t_gsetgen*>(&gset)->end();
-        GREAT_INFO("PVT processing started ");
-        GREAT_INFO(beg.str_ymdhms("  beg: ") + end.str_ymdhms("  end: "));
+        if (!isBase)
+        {
+            it++;
+        }
+        i++;
+    }
+
+    t_gtime beg_proc = dynamic_cast<t_gsetgen*>(&gset)->beg();
+    t_gtime end_proc = dynamic_cast<t_gsetgen*>(&gset)->end();
 
-        runepoch = t_gtime::current_time(t_gtime::GPS);
+    // Number of sites processed concurrently, never more than the number of sites
+    if (nthreads > int(vgpvt.size()))
+    {
+        nthreads = vgpvt.size();
+    }
+    GREAT_INFO("PVT processing started, sites: " + int2str(vgpvt.size()) + " threads: " + int2str(nthreads));
+    GREAT_INFO(beg_proc.str_ymdhms("  beg: ") + end_proc.str_ymdhms("  end: "));
 
-        // The main processing code : processBatch
-        vgpvt[idx]->processBatch(beg, end, true);
+    // Each worker takes the next unprocessed site until all sites are done.
+    // All data containers are only read here, so they are shared by the workers.
+    atomic<size_t> next_site(0);
+    auto pvt_worker = [&]()
+    {
+        size_t idx;
+        while ((idx = next_site++) < vgpvt.size())
+        {
+            t_gtime site_beg = t_gtime::current_time(t_gtime::GPS);
 
-        // The time when process ends
-        lstepoch = t_gtime::current_time(t_gtime::GPS);
+            if (stream)
+            {
+                // The sources replay the files while the filter takes the epochs
+                t_gobsstream* rover = site_stream.at(vgpvt[idx]->site());
+                t_gobsstream* base = isBase ? site_stream.at(vbase[idx]) : nullptr;
+                thread rover_thread(&t_gobsstream::run_read, rover);
+                thread base_thread;
+                if (base)
+                {
+                    base_thread = thread(&t_gobsstream::run_read, base);
+                }
+                vgpvt[idx]->processStream(beg_proc, end_proc, rover->queue(), base ? base->queue() : nullptr);
+                rover_thread.join();
+                if (base_thread.joinable())
+                {
+                    base_thread.join();
+                }
+            }
+            else
+            {
+                // The main processing code : processBatch
+                vgpvt[idx]->processBatch(beg_proc, end_proc, true);
+            }
 
-        // Write the log file
-        GREAT_INFO(site_base + site + "PVT processing finished : duration  " + dbl2str(lstepoch.diff(runepoch)) + " sec");
+            // The time when process ends
+            t_gtime site_end = t_gtime::current_time(t_gtime::GPS);
 
-        if (!isBase)
+            // Write the log file
+            GREAT_INFO(vgpvt[idx]->site() + " PVT processing finished : duration  " + dbl2str(site_end.diff(site_beg)) + " sec");
+        }
+    };
+
+    runepoch = t_gtime::current_time(t_gtime::GPS);
+    if (nthreads <= 1)
+    {
+        pvt_worker();
+    }
+    else
+    {
+        for (int ith = 0; ith < nthreads; ++ith)
         {
-            it++;
+            gthread.push_back(thread(pvt_worker));
         }
-        i++;
+        for (size_t ith = 0; ith < gthread.size(); ++ith)
+        {
+            gthread[ith].join();
+        }
+        gthread.clear();
     }
+    lstepoch = t_gtime::current_time(t_gtime::GPS);
+    GREAT_INFO("PVT processing of all sites finished : duration  " + dbl2str(lstepoch.diff(runepoch)) + " sec");
 
     // Delete pointer
     for (size_t i = 0; i < gio.size(); ++i)
@@ -380,6 +607,13 @@ int main(int argc, char** argv)
         delete gcoder[i];
     };
     gcoder.clear();
+    for (size_t i = 0; i < gstream.size(); ++i)
+    {
+        delete gstream[i];
+        delete gstream_coder[i];
+    };
+    gstream.clear();
+    gstream_coder.clear();
     for (unsigned int i = 0; i < vgpvt.size(); ++i)
     {
         if (vgpvt[i])
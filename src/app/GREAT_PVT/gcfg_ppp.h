@@ -9,6 +9,7 @@
 #include "gall/gallprec.h"
 #include "gall/gallpcv.h"
 #include "gall/gallobs.h"
+#include "gall/gallobscol.h"
 #include "gall/gallotl.h"
 #include "gall/gallbias.h"
 #include "gproc/gpppflt.h"
@@ -16,6 +17,8 @@
 #include "gio/gio.h"
 #include "spdlog/spdlog.h"
 #include "gio/gfile.h"
+#include "gio/gmmapfile.h"
+#include "gio/gobsstream.h"
 #include "gutils/gtime.h"
 #include "gutils/gtypeconv.h"
 #include "gdata/gdata.h"